@@ -0,0 +1,127 @@
+// Compares the batch conversions (enum_names, to_enums, enum_names_join)
+// with calling enum_name and to_enum once per element, as a column export or
+// ingest would.
+//
+// A column of random values of a 64-value enum is converted in both
+// directions; the best of several runs is reported.
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class instrument {
+  equity_common, equity_preferred, equity_warrant, equity_right,
+  etf_equity, etf_bond, etf_commodity, etf_leveraged,
+  bond_government, bond_municipal, bond_corporate, bond_convertible,
+  bond_zero_coupon, bond_floating, bond_inflation, bond_covered,
+  future_index, future_equity, future_rate, future_bond,
+  future_currency, future_energy, future_metal, future_agriculture,
+  option_index, option_equity, option_rate, option_bond,
+  option_currency, option_energy, option_metal, option_future,
+  swap_rate, swap_basis, swap_currency, swap_credit,
+  swap_total_return, swap_variance, swap_inflation, swap_commodity,
+  fx_spot, fx_forward, fx_swap, fx_ndf,
+  money_deposit, money_repo, money_reverse_repo, money_paper,
+  fund_mutual, fund_hedge, fund_money_market, fund_closed_end,
+  structured_note, structured_certificate, structured_warrant, mbs_pass,
+  mbs_cmo, abs_auto, abs_card, abs_student,
+  cdo_cash, cdo_synthetic, crypto_spot, crypto_future
+};
+
+namespace {
+
+constexpr std::size_t column = std::size_t{1} << 20U;
+constexpr std::size_t runs = 7;
+
+template <typename Fn> auto best_ns(Fn &&convert) -> double {
+  auto best = std::numeric_limits<double>::max();
+  for (std::size_t run = 0; run < runs; ++run) {
+    const auto start = std::chrono::steady_clock::now();
+    convert();
+    const auto stop = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  return best / static_cast<double>(column);
+}
+
+void report(const char *name, double single_ns, double batch_ns) {
+  std::printf("%-10s %12.2f %12.2f %9.2fx\n", name, single_ns, batch_ns,
+              single_ns / batch_ns);
+}
+
+} // namespace
+
+int main() {
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> pick{0, 63};
+  std::vector<instrument> values(column);
+  for (auto &value : values) {
+    value = static_cast<instrument>(pick(rng));
+  }
+
+  std::vector<mgutility::string_view> names(column);
+  std::vector<instrument> parsed(column);
+  std::vector<bool> ok_single(column);
+  std::unique_ptr<bool[]> ok_batch{new bool[column]};
+  std::string joined;
+  std::size_t checksum = 0;
+
+  std::printf("column of %zu values, ns/element\n", column);
+  std::printf("%-10s %12s %12s %10s\n", "operation", "per element", "batch",
+              "speedup");
+
+  const auto names_single = best_ns([&] {
+    for (std::size_t idx = 0; idx < column; ++idx) {
+      names[idx] = mgutility::enum_name(values[idx]);
+    }
+  });
+  const auto names_batch = best_ns([&] {
+    mgutility::enum_names(values.data(), values.size(), names.data());
+  });
+  report("names", names_single, names_batch);
+
+  const auto parse_single = best_ns([&] {
+    for (std::size_t idx = 0; idx < column; ++idx) {
+      auto value = mgutility::to_enum<instrument>(names[idx]);
+      ok_single[idx] = value.has_value();
+      parsed[idx] = value ? *value : instrument{};
+    }
+  });
+  const auto parse_batch = best_ns([&] {
+    checksum += mgutility::to_enums(names.data(), names.size(), parsed.data(),
+                                    ok_batch.get());
+  });
+  report("to_enums", parse_single, parse_batch);
+
+  const auto join_single = best_ns([&] {
+    joined = std::string{};
+    for (std::size_t idx = 0; idx < column; ++idx) {
+      if (idx != 0) {
+        joined += ',';
+      }
+      const auto name = mgutility::enum_name(values[idx]);
+      joined.append(name.data(), name.size());
+    }
+  });
+  const auto join_batch = best_ns([&] {
+    joined = std::string{};
+    mgutility::enum_names_join(values.data(), values.size(), ",", joined);
+  });
+  report("join", join_single, join_batch);
+
+  if (checksum == 0 || parsed != values) {
+    std::puts("unexpected parse results");
+    return 1;
+  }
+}
@@ -0,0 +1,126 @@
+// Compares the single-pass bitmask parser behind to_enum against the previous
+// two-pass approach, which first scanned for the next '|' and then hashed the
+// token again inside the name index lookup.
+//
+// Masks of 1, 4 and 16 names are parsed from a 32-bit flag enum with one name
+// per bit; the best of several runs is reported.
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class bench_flags : std::uint32_t {
+  read_access = 1U << 0U,
+  write_access = 1U << 1U,
+  execute_access = 1U << 2U,
+  append_only = 1U << 3U,
+  create_missing = 1U << 4U,
+  truncate_existing = 1U << 5U,
+  exclusive_lock = 1U << 6U,
+  shared_lock = 1U << 7U,
+  follow_symlinks = 1U << 8U,
+  skip_hidden = 1U << 9U,
+  preserve_times = 1U << 10U,
+  preserve_owner = 1U << 11U,
+  sync_writes = 1U << 12U,
+  direct_io = 1U << 13U,
+  temporary_file = 1U << 14U,
+  close_on_exec = 1U << 15U
+};
+
+template <> struct mgutility::enum_flags<bench_flags> {
+  static constexpr auto value = true;
+};
+
+namespace {
+
+constexpr std::size_t iterations = std::size_t{1} << 18U;
+constexpr std::size_t runs = 15;
+
+// The previous parser: find the next '|' and look the token up on its own.
+auto legacy_parse(mgutility::string_view str) -> std::uint64_t {
+  using cache = mgutility::detail::enum_flag_cache<bench_flags>;
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &index = cache::name_index;
+#else
+  const auto &index = cache::name_index();
+#endif
+  const auto &names = mgutility::detail::get_enum_flags<bench_flags>();
+
+  std::uint64_t bits = 0;
+  std::size_t begin = 0;
+  for (std::size_t pos = 0; pos <= str.size(); ++pos) {
+    if (pos < str.size() && str[pos] != '|') {
+      continue;
+    }
+    const auto slot = index.find(str.substr(begin, pos - begin), names);
+    if (slot == index.npos) {
+      return 0;
+    }
+    bits |= std::uint64_t{1} << (slot - 1);
+    begin = pos + 1;
+  }
+  return bits;
+}
+
+auto current_parse(mgutility::string_view str) -> std::uint64_t {
+  const auto parsed = mgutility::to_enum<bench_flags>(str);
+  return parsed ? static_cast<std::uint64_t>(*parsed) : 0;
+}
+
+auto make_mask(std::size_t tokens) -> std::string {
+  std::string mask;
+  for (std::size_t bit = 0; bit < tokens; ++bit) {
+    if (!mask.empty()) {
+      mask += '|';
+    }
+    const auto name = mgutility::enum_name(static_cast<bench_flags>(1U << bit));
+    mask.append(name.data(), name.size());
+  }
+  return mask;
+}
+
+template <typename Fn>
+auto time_parse(const std::string &mask, Fn &&parse) -> double {
+  auto best = std::numeric_limits<double>::max();
+  std::uint64_t checksum = 0;
+  for (std::size_t run = 0; run < runs; ++run) {
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+      checksum += parse(mgutility::string_view(mask.data(), mask.size()));
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  if (checksum == 0) {
+    std::puts("unexpected failed parses");
+  }
+  return best / static_cast<double>(iterations);
+}
+
+} // namespace
+
+int main() {
+  std::printf("%-8s %8s %14s %14s\n", "tokens", "bytes", "legacy ns/op",
+              "current ns/op");
+  for (std::size_t tokens : {1U, 4U, 16U}) {
+    const auto mask = make_mask(tokens);
+    if (legacy_parse(mask) != current_parse(mask)) {
+      std::printf("mismatch for %s\n", mask.c_str());
+      return 1;
+    }
+    const auto legacy_ns = time_parse(mask, &legacy_parse);
+    const auto current_ns = time_parse(mask, &current_parse);
+    std::printf("%-8zu %8zu %14.2f %14.2f\n", tokens, mask.size(), legacy_ns,
+                current_ns);
+  }
+}
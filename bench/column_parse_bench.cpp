@@ -0,0 +1,169 @@
+// Compares parsing one column of enum names from a large CSV file with
+// std::getline and to_enum per row against parse_enum_column_file, which
+// maps the file and parses it on several threads.
+//
+// A file of the given size (1024 MB by default) is generated first, with
+// about one unknown name in a thousand rows; every parse is checked against
+// the generated values. Usage: column_parse_bench [megabytes] [path]
+
+#include "mgutility/reflection/enum_column.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class instrument {
+  equity_common, equity_preferred, equity_warrant, equity_right,
+  etf_equity, etf_bond, etf_commodity, etf_leveraged,
+  bond_government, bond_municipal, bond_corporate, bond_convertible,
+  bond_zero_coupon, bond_floating, bond_inflation, bond_covered,
+  future_index, future_equity, future_rate, future_bond,
+  future_currency, future_energy, future_metal, future_agriculture,
+  option_index, option_equity, option_rate, option_bond,
+  option_currency, option_energy, option_metal, option_future,
+  swap_rate, swap_basis, swap_currency, swap_credit,
+  swap_total_return, swap_variance, swap_inflation, swap_commodity,
+  fx_spot, fx_forward, fx_swap, fx_ndf,
+  money_deposit, money_repo, money_reverse_repo, money_paper,
+  fund_mutual, fund_hedge, fund_money_market, fund_closed_end,
+  structured_note, structured_certificate, structured_warrant, mbs_pass,
+  mbs_cmo, abs_auto, abs_card, abs_student,
+  cdo_cash, cdo_synthetic, crypto_spot, crypto_future
+};
+
+namespace {
+
+constexpr std::size_t runs = 3;
+
+struct generated {
+  std::vector<instrument> values;
+  std::size_t unknown{0};
+  std::size_t bytes{0};
+};
+
+auto generate(const char *path, std::size_t bytes) -> generated {
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> pick{0, 63};
+  std::uniform_int_distribution<int> qty{1, 100000};
+  std::uniform_int_distribution<int> typo{0, 999};
+
+  generated result{};
+  std::FILE *file = std::fopen(path, "wb");
+  if (file == nullptr) {
+    std::perror(path);
+    std::exit(1);
+  }
+  std::string block = "id,instrument,quantity\n";
+  for (std::size_t row = 1; result.bytes + block.size() < bytes; ++row) {
+    const auto value = static_cast<instrument>(pick(rng));
+    const auto name = mgutility::enum_name(value);
+    block += std::to_string(row);
+    block += ',';
+    block.append(name.data(), name.size());
+    if (typo(rng) == 0) {
+      block += 'x';
+      result.values.push_back(instrument{});
+      ++result.unknown;
+    } else {
+      result.values.push_back(value);
+    }
+    block += ',';
+    block += std::to_string(qty(rng));
+    block += '\n';
+    if (block.size() >= (std::size_t{1} << 20U)) {
+      std::fwrite(block.data(), 1, block.size(), file);
+      result.bytes += block.size();
+      block.clear();
+    }
+  }
+  std::fwrite(block.data(), 1, block.size(), file);
+  result.bytes += block.size();
+  std::fclose(file);
+  return result;
+}
+
+template <typename Fn> auto best_s(std::size_t count, Fn &&parse) -> double {
+  auto best = std::numeric_limits<double>::max();
+  for (std::size_t run = 0; run < count; ++run) {
+    const auto start = std::chrono::steady_clock::now();
+    parse();
+    const auto stop = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double>(stop - start).count());
+  }
+  return best;
+}
+
+void report(const char *name, unsigned threads, double seconds,
+            std::size_t bytes, double baseline) {
+  std::printf("%-10s %8u %10.3f %10.2f %9.2fx\n", name, threads, seconds,
+              static_cast<double>(bytes) / seconds / 1e9, baseline / seconds);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const auto megabytes =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024ULL;
+  const std::string path = argc > 2 ? argv[2] : "enum_column_bench.csv";
+
+  std::printf("generating %llu MB in %s\n", megabytes, path.c_str());
+  const auto data = generate(path.c_str(), megabytes << 20U);
+  std::printf("%zu rows, %zu unknown names\n\n", data.values.size(),
+              data.unknown);
+  std::printf("%-10s %8s %10s %10s %10s\n", "parser", "threads", "seconds",
+              "GB/s", "speedup");
+
+  std::vector<instrument> parsed;
+  std::size_t unknown = 0;
+  const auto getline_s = best_s(1, [&] {
+    parsed.clear();
+    unknown = 0;
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+      const auto first = line.find(',') + 1;
+      const auto field = line.substr(first, line.find(',', first) - first);
+      auto value = mgutility::to_enum<instrument>(field);
+      parsed.push_back(value ? *value : instrument{});
+      unknown += value ? 0 : 1;
+    }
+  });
+  if (parsed != data.values || unknown != data.unknown) {
+    std::puts("unexpected getline results");
+    return 1;
+  }
+  report("getline", 1, getline_s, data.bytes, getline_s);
+
+  mgutility::enum_column_options options{};
+  options.column = 1;
+  options.header = true;
+  const auto hardware = std::max(1U, std::thread::hardware_concurrency());
+  for (unsigned threads = 1;; threads = std::min(threads * 2, hardware)) {
+    options.threads = threads;
+    mgutility::enum_column<instrument> column{};
+    const auto mapped_s = best_s(runs, [&] {
+      column =
+          mgutility::parse_enum_column_file<instrument>(path.c_str(), options);
+    });
+    if (column.values != data.values ||
+        column.unknown_rows.size() != data.unknown) {
+      std::puts("unexpected parse_enum_column_file results");
+      return 1;
+    }
+    report("mmap", threads, mapped_s, data.bytes, getline_s);
+    if (threads == hardware) {
+      break;
+    }
+  }
+  std::remove(path.c_str());
+}
@@ -0,0 +1,512 @@
+// Runtime micro-benchmarks of the public API: enum_name, bitmask enum_name,
+// to_enum, bitmask to_enum, enum_cast and enum_for_each.
+//
+// Every case is measured over enums of 4, 64 and 256 values, with short and
+// long names, and with all hits or half misses. The harness has no
+// dependencies: it times batches with std::chrono, optionally reads Linux
+// perf counters, writes JSON and compares against a stored baseline.
+//
+// Usage: enum_name_bench [--filter text] [--perf] [--json file]
+//                        [--baseline file] [--tolerance fraction]
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Enumerators are generated as prefix + four base-4 digits, so every size
+// keeps the same name shape.
+#define MGB_X4(p) p##0, p##1, p##2, p##3
+#define MGB_X16(p) MGB_X4(p##0), MGB_X4(p##1), MGB_X4(p##2), MGB_X4(p##3)
+#define MGB_X64(p) MGB_X16(p##0), MGB_X16(p##1), MGB_X16(p##2), MGB_X16(p##3)
+#define MGB_X256(p) MGB_X64(p##0), MGB_X64(p##1), MGB_X64(p##2), MGB_X64(p##3)
+
+// NOLINTBEGIN [performance-enum-size]
+enum class short_4 { MGB_X4(s000) };
+enum class short_64 { MGB_X64(s0) };
+enum class short_256 { MGB_X256(s) };
+enum class long_4 { MGB_X4(long_enumerator_name_000) };
+enum class long_64 { MGB_X64(long_enumerator_name_0) };
+enum class long_256 { MGB_X256(long_enumerator_name_) };
+
+enum class bitmask_8 {
+  none = 0,
+  read = 1 << 0,
+  write = 1 << 1,
+  execute = 1 << 2,
+  append = 1 << 3,
+  create = 1 << 4,
+  truncate = 1 << 5,
+  exclusive = 1 << 6,
+  sync = 1 << 7
+};
+// NOLINTEND [performance-enum-size]
+
+constexpr auto operator|(bitmask_8 lhs, bitmask_8 rhs) -> bitmask_8 {
+  return static_cast<bitmask_8>(static_cast<int>(lhs) | static_cast<int>(rhs));
+}
+
+namespace {
+
+constexpr std::size_t batch = 4096;
+constexpr std::size_t runs = 9;
+constexpr double min_run_ns = 2e6;
+
+/**
+ * @brief Reads cycles, instructions and branch misses of this thread.
+ *
+ * Opening the counters fails in many containers and with a restrictive
+ * perf_event_paranoid; the harness then reports time only.
+ */
+class perf_counters {
+public:
+  static constexpr std::size_t count = 3;
+
+  perf_counters() = default;
+  perf_counters(const perf_counters &) = delete;
+  auto operator=(const perf_counters &) -> perf_counters & = delete;
+
+  ~perf_counters() {
+#if defined(__linux__)
+    for (auto fd : fds_) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  auto open() -> bool {
+#if defined(__linux__)
+    const std::uint64_t configs[count] = {PERF_COUNT_HW_CPU_CYCLES,
+                                          PERF_COUNT_HW_INSTRUCTIONS,
+                                          PERF_COUNT_HW_BRANCH_MISSES};
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      perf_event_attr attr{};
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = configs[idx];
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fds_[idx] = static_cast<int>(
+          syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+      if (fds_[idx] < 0) {
+        return false;
+      }
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  void start() {
+#if defined(__linux__)
+    for (auto fd : fds_) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  void stop(std::uint64_t (&values)[count]) {
+#if defined(__linux__)
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      ioctl(fds_[idx], PERF_EVENT_IOC_DISABLE, 0);
+      values[idx] = 0;
+      if (read(fds_[idx], &values[idx], sizeof(values[idx])) !=
+          sizeof(values[idx])) {
+        values[idx] = 0;
+      }
+    }
+#else
+    for (auto &value : values) {
+      value = 0;
+    }
+#endif
+  }
+
+private:
+  int fds_[count] = {-1, -1, -1};
+};
+
+struct result {
+  std::string name;
+  double ns_per_op;
+  double counters[perf_counters::count];
+  bool has_counters;
+};
+
+struct options {
+  std::string filter;
+  std::string json;
+  std::string baseline;
+  double tolerance = 0.25;
+  bool perf = false;
+};
+
+volatile std::size_t sink;
+
+/**
+ * @brief Times one case: `op(i)` is called for i in [0, batch) until a run
+ * takes long enough, and the best run is kept.
+ */
+template <typename Op>
+auto measure(const std::string &name, perf_counters *counters, Op &&op)
+    -> result {
+  std::size_t repeat = 1;
+  for (;;) {
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t checksum = 0;
+    for (std::size_t rep = 0; rep < repeat; ++rep) {
+      for (std::size_t idx = 0; idx < batch; ++idx) {
+        checksum += op(idx);
+      }
+    }
+    sink = checksum;
+    const auto elapsed = std::chrono::duration<double, std::nano>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+    if (elapsed >= min_run_ns || repeat >= (std::size_t{1} << 20U)) {
+      break;
+    }
+    repeat *= 2;
+  }
+
+  result best{name, 0, {0, 0, 0}, counters != nullptr};
+  const auto ops = static_cast<double>(repeat * batch);
+  for (std::size_t run = 0; run < runs; ++run) {
+    std::uint64_t values[perf_counters::count] = {};
+    if (counters != nullptr) {
+      counters->start();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t checksum = 0;
+    for (std::size_t rep = 0; rep < repeat; ++rep) {
+      for (std::size_t idx = 0; idx < batch; ++idx) {
+        checksum += op(idx);
+      }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    if (counters != nullptr) {
+      counters->stop(values);
+    }
+    sink = checksum;
+    const auto ns =
+        std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+    if (run == 0 || ns < best.ns_per_op) {
+      best.ns_per_op = ns;
+      for (std::size_t idx = 0; idx < perf_counters::count; ++idx) {
+        best.counters[idx] = static_cast<double>(values[idx]) / ops;
+      }
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief Picks batch values of an enum of Size values; with misses, every
+ * second value is one past the enumerators and has no name.
+ */
+template <typename Enum, int Size>
+auto pick_values(bool misses) -> std::vector<Enum> {
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> pick{0, Size - 1};
+  std::vector<Enum> values(batch);
+  for (std::size_t idx = 0; idx < batch; ++idx) {
+    const auto miss = misses && idx % 2 == 1;
+    values[idx] = static_cast<Enum>(miss ? Size + pick(rng) % 8 : pick(rng));
+  }
+  return values;
+}
+
+auto to_views(const std::vector<std::string> &strings)
+    -> std::vector<mgutility::string_view> {
+  std::vector<mgutility::string_view> views;
+  views.reserve(strings.size());
+  for (const auto &str : strings) {
+    views.emplace_back(str.data(), str.size());
+  }
+  return views;
+}
+
+/**
+ * @brief Names of the batch values; a miss is a name of the same length
+ * with its last character changed.
+ */
+template <typename Enum, int Size>
+auto pick_names(bool misses) -> std::vector<std::string> {
+  const auto values = pick_values<Enum, Size>(false);
+  std::vector<std::string> names;
+  names.reserve(batch);
+  for (std::size_t idx = 0; idx < batch; ++idx) {
+    const auto name = mgutility::enum_name(values[idx]);
+    names.emplace_back(name.data(), name.size());
+    if (misses && idx % 2 == 1) {
+      names.back().back() = '#';
+    }
+  }
+  return names;
+}
+
+template <typename Enum, int Size>
+void run_enum(const char *label, const options &opts, perf_counters *counters,
+              std::vector<result> &results) {
+  for (const auto misses : {false, true}) {
+    const auto suffix = std::string{"/"} + label + (misses ? "/miss50" : "/hit");
+
+    auto name = "enum_name" + suffix;
+    if (name.find(opts.filter) != std::string::npos) {
+      const auto values = pick_values<Enum, Size>(misses);
+      results.push_back(measure(name, counters, [&values](std::size_t idx) {
+        return mgutility::enum_name(values[idx]).size();
+      }));
+    }
+
+    name = "to_enum" + suffix;
+    if (name.find(opts.filter) != std::string::npos) {
+      const auto strings = pick_names<Enum, Size>(misses);
+      const auto views = to_views(strings);
+      results.push_back(measure(name, counters, [&views](std::size_t idx) {
+        auto value = mgutility::to_enum<Enum>(views[idx]);
+        return value ? static_cast<std::size_t>(*value) + 1 : 0;
+      }));
+    }
+
+    name = "enum_cast" + suffix;
+    if (name.find(opts.filter) != std::string::npos) {
+      const auto values = pick_values<Enum, Size>(misses);
+      std::vector<int> ints(values.size());
+      for (std::size_t idx = 0; idx < values.size(); ++idx) {
+        ints[idx] = static_cast<int>(values[idx]);
+      }
+      results.push_back(measure(name, counters, [&ints](std::size_t idx) {
+        auto value = mgutility::enum_cast<Enum>(ints[idx]);
+        return value ? static_cast<std::size_t>(*value) + 1 : 0;
+      }));
+    }
+  }
+
+  const auto name = std::string{"enum_for_each/"} + label;
+  if (name.find(opts.filter) != std::string::npos) {
+    // One op is one element visited.
+    auto res = measure(name, counters, [](std::size_t idx) {
+      if (idx % Size != 0) {
+        return std::size_t{0};
+      }
+      std::size_t total = 0;
+      for (auto &&pair : mgutility::enum_for_each<Enum>()) {
+        total += static_cast<std::size_t>(pair.first) +
+                 static_cast<mgutility::string_view>(pair.second).size();
+      }
+      return total;
+    });
+    results.push_back(res);
+  }
+}
+
+void run_bitmask(const options &opts, perf_counters *counters,
+                 std::vector<result> &results) {
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<int> pick{1, 255};
+  std::vector<bitmask_8> values(batch);
+  std::vector<std::string> strings(batch);
+  for (std::size_t idx = 0; idx < batch; ++idx) {
+    values[idx] = static_cast<bitmask_8>(pick(rng));
+    const auto name = mgutility::enum_name(values[idx]);
+    strings[idx].assign(name.data(), name.size());
+  }
+  const auto views = to_views(strings);
+
+  if (std::string{"bitmask_enum_name"}.find(opts.filter) !=
+      std::string::npos) {
+    results.push_back(
+        measure("bitmask_enum_name", counters, [&values](std::size_t idx) {
+          return mgutility::enum_name(values[idx]).size();
+        }));
+  }
+  if (std::string{"bitmask_to_enum"}.find(opts.filter) != std::string::npos) {
+    results.push_back(
+        measure("bitmask_to_enum", counters, [&views](std::size_t idx) {
+          auto value = mgutility::to_enum<bitmask_8>(views[idx]);
+          return value ? static_cast<std::size_t>(*value) : 0;
+        }));
+  }
+}
+
+auto compiler_name() -> std::string {
+#if defined(__clang__)
+  return "clang " __clang_version__;
+#elif defined(__GNUC__)
+  return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+  return "msvc " + std::to_string(_MSC_VER);
+#else
+  return "unknown";
+#endif
+}
+
+void write_json(const std::string &path, const std::vector<result> &results) {
+  std::ofstream out(path);
+  out << "{\n  \"standard\": " << MGUTILITY_CPLUSPLUS << ",\n"
+      << "  \"compiler\": \"" << compiler_name() << "\",\n"
+      << "  \"results\": [\n";
+  for (std::size_t idx = 0; idx < results.size(); ++idx) {
+    const auto &res = results[idx];
+    out << "    {\"name\": \"" << res.name
+        << "\", \"ns_per_op\": " << res.ns_per_op;
+    if (res.has_counters) {
+      out << ", \"cycles_per_op\": " << res.counters[0]
+          << ", \"instructions_per_op\": " << res.counters[1]
+          << ", \"branch_misses_per_op\": " << res.counters[2];
+    }
+    out << "}" << (idx + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n}\n";
+}
+
+/**
+ * @brief Reads the (name, ns_per_op) pairs of a file written by write_json.
+ */
+auto read_baseline(const std::string &path)
+    -> std::vector<std::pair<std::string, double>> {
+  std::ifstream in(path);
+  std::stringstream text;
+  text << in.rdbuf();
+  const auto json = text.str();
+
+  std::vector<std::pair<std::string, double>> entries;
+  const std::string name_key = "\"name\": \"";
+  const std::string ns_key = "\"ns_per_op\": ";
+  for (auto pos = json.find(name_key); pos != std::string::npos;
+       pos = json.find(name_key, pos)) {
+    pos += name_key.size();
+    const auto end = json.find('"', pos);
+    const auto ns_pos = json.find(ns_key, end);
+    if (end == std::string::npos || ns_pos == std::string::npos) {
+      break;
+    }
+    entries.emplace_back(json.substr(pos, end - pos),
+                         std::strtod(json.c_str() + ns_pos + ns_key.size(),
+                                     nullptr));
+    pos = ns_pos;
+  }
+  return entries;
+}
+
+auto compare_baseline(const options &opts, const std::vector<result> &results)
+    -> int {
+  const auto baseline = read_baseline(opts.baseline);
+  if (baseline.empty()) {
+    std::fprintf(stderr, "cannot read baseline %s\n", opts.baseline.c_str());
+    return 2;
+  }
+  auto regressions = 0;
+  std::printf("\n%-36s %10s %10s %8s\n", "case", "baseline", "current",
+              "change");
+  for (const auto &res : results) {
+    const auto entry = std::find_if(
+        baseline.begin(), baseline.end(),
+        [&res](const std::pair<std::string, double> &item) {
+          return item.first == res.name;
+        });
+    if (entry == baseline.end() || entry->second <= 0) {
+      continue;
+    }
+    const auto change = res.ns_per_op / entry->second - 1.0;
+    const auto regressed = change > opts.tolerance;
+    regressions += regressed ? 1 : 0;
+    std::printf("%-36s %10.2f %10.2f %+7.1f%%%s\n", res.name.c_str(),
+                entry->second, res.ns_per_op, change * 100.0,
+                regressed ? "  REGRESSION" : "");
+  }
+  return regressions == 0 ? 0 : 1;
+}
+
+auto parse_options(int argc, char **argv, options &opts) -> bool {
+  for (auto idx = 1; idx < argc; ++idx) {
+    const std::string arg = argv[idx];
+    const auto has_value = idx + 1 < argc;
+    if (arg == "--perf") {
+      opts.perf = true;
+    } else if (arg == "--filter" && has_value) {
+      opts.filter = argv[++idx];
+    } else if (arg == "--json" && has_value) {
+      opts.json = argv[++idx];
+    } else if (arg == "--baseline" && has_value) {
+      opts.baseline = argv[++idx];
+    } else if (arg == "--tolerance" && has_value) {
+      opts.tolerance = std::strtod(argv[++idx], nullptr);
+    } else {
+      std::fprintf(stderr,
+                   "usage: %s [--filter text] [--perf] [--json file] "
+                   "[--baseline file] [--tolerance fraction]\n",
+                   argv[0]);
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  options opts;
+  if (!parse_options(argc, argv, opts)) {
+    return 2;
+  }
+
+  perf_counters counters;
+  const auto use_counters = opts.perf && counters.open();
+  if (opts.perf && !use_counters) {
+    std::fprintf(stderr, "perf counters unavailable, reporting time only\n");
+  }
+  auto *active = use_counters ? &counters : nullptr;
+
+  std::vector<result> results;
+  run_enum<short_4, 4>("4/short", opts, active, results);
+  run_enum<short_64, 64>("64/short", opts, active, results);
+  run_enum<short_256, 256>("256/short", opts, active, results);
+  run_enum<long_4, 4>("4/long", opts, active, results);
+  run_enum<long_64, 64>("64/long", opts, active, results);
+  run_enum<long_256, 256>("256/long", opts, active, results);
+  run_bitmask(opts, active, results);
+
+  std::printf("C++ %ld, %s\n", static_cast<long>(MGUTILITY_CPLUSPLUS),
+              compiler_name().c_str());
+  std::printf("%-36s %10s", "case", "ns/op");
+  if (use_counters) {
+    std::printf(" %10s %10s %10s", "cycles", "instr", "br-miss");
+  }
+  std::printf("\n");
+  for (const auto &res : results) {
+    std::printf("%-36s %10.2f", res.name.c_str(), res.ns_per_op);
+    if (res.has_counters) {
+      std::printf(" %10.2f %10.2f %10.3f", res.counters[0], res.counters[1],
+                  res.counters[2]);
+    }
+    std::printf("\n");
+  }
+
+  if (!opts.json.empty()) {
+    write_json(opts.json, results);
+  }
+  return opts.baseline.empty() ? 0 : compare_baseline(opts, results);
+}
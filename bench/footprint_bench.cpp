@@ -0,0 +1,177 @@
+// Compares the memory footprint and lookup cost of the packed name table
+// against the previous layout (a 16-byte string_view per slot plus a
+// 16-byte (offset, length) pair per slot).
+//
+// Every enum spreads 16 values over the default 256-slot range and many enums
+// are looked up in random order, so the working set of the previous layout
+// spills out of L1 into L2 while the packed tables of the same enums do not.
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t enum_count = 128;
+constexpr std::size_t lookups = std::size_t{1} << 22U;
+constexpr std::size_t cache_line = 64;
+
+template <std::size_t I> struct bench_enum {
+  // NOLINTNEXTLINE [performance-enum-size]
+  enum class type {
+    first_value = 0,
+    second_value = 16,
+    third_value = 32,
+    fourth_value = 48,
+    fifth_value = 64,
+    sixth_value = 80,
+    seventh_value = 96,
+    eighth_value = 112,
+    ninth_value = 128,
+    tenth_value = 144,
+    eleventh_value = 160,
+    twelfth_value = 176,
+    thirteenth_value = 192,
+    fourteenth_value = 208,
+    fifteenth_value = 224,
+    sixteenth_value = 240
+  };
+};
+
+constexpr auto slots = static_cast<std::size_t>(
+    mgutility::enum_range<bench_enum<0>::type>::max -
+    mgutility::enum_range<bench_enum<0>::type>::min);
+
+using legacy_names = std::array<mgutility::string_view, slots>;
+using legacy_ranges = std::array<mgutility::pair<std::size_t, std::size_t>,
+                                 slots>;
+
+template <std::size_t I>
+auto packed_lookup(int value) -> mgutility::string_view {
+  return mgutility::enum_name(static_cast<typename bench_enum<I>::type>(value));
+}
+
+template <std::size_t I> auto packed_bytes() -> std::size_t {
+  using type = typename bench_enum<I>::type;
+  return sizeof(mgutility::detail::get_enum_array<type>());
+}
+
+template <std::size_t I> auto legacy_table() -> legacy_names {
+  using type = typename bench_enum<I>::type;
+  const auto &table = mgutility::detail::get_enum_array<type>();
+  legacy_names names{};
+  for (std::size_t slot = 0; slot < slots; ++slot) {
+    names[slot] = table[slot];
+  }
+  return names;
+}
+
+using lookup_fn = mgutility::string_view (*)(int);
+
+template <std::size_t... I>
+auto packed_lookups(mgutility::detail::index_sequence<I...> /*unused*/)
+    -> std::array<lookup_fn, enum_count> {
+  return {{&packed_lookup<I>...}};
+}
+
+template <std::size_t... I>
+auto packed_sizes(mgutility::detail::index_sequence<I...> /*unused*/)
+    -> std::array<std::size_t, enum_count> {
+  return {{packed_bytes<I>()...}};
+}
+
+template <std::size_t... I>
+auto legacy_tables(mgutility::detail::index_sequence<I...> /*unused*/)
+    -> std::vector<legacy_names> {
+  return {legacy_table<I>()...};
+}
+
+auto legacy_store() -> const std::vector<legacy_names> & {
+  static const auto tables =
+      legacy_tables(mgutility::detail::make_index_sequence<enum_count>{});
+  return tables;
+}
+
+template <std::size_t I>
+auto legacy_lookup(int value) -> mgutility::string_view {
+  return legacy_store()[I][static_cast<std::size_t>(value)];
+}
+
+template <std::size_t... I>
+auto legacy_lookups(mgutility::detail::index_sequence<I...> /*unused*/)
+    -> std::array<lookup_fn, enum_count> {
+  return {{&legacy_lookup<I>...}};
+}
+
+template <typename Fn>
+auto time_lookups(const std::vector<std::pair<std::size_t, int>> &keys,
+                  Fn &&lookup) -> double {
+  std::size_t checksum = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto &key : keys) {
+    checksum += lookup(key.first, key.second).size();
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  if (checksum == 0) {
+    std::puts("unexpected empty lookups");
+  }
+  return std::chrono::duration<double, std::nano>(stop - start).count() /
+         static_cast<double>(keys.size());
+}
+
+auto lines(std::size_t bytes) -> std::size_t {
+  return (bytes + cache_line - 1) / cache_line;
+}
+
+} // namespace
+
+int main() {
+  using sequence = mgutility::detail::make_index_sequence<enum_count>;
+
+  const auto packed = packed_lookups(sequence{});
+  const auto sizes = packed_sizes(sequence{});
+  const auto legacy = legacy_lookups(sequence{});
+
+  std::size_t packed_total = 0;
+  for (auto size : sizes) {
+    packed_total += size;
+  }
+  const auto legacy_bytes = sizeof(legacy_names) + sizeof(legacy_ranges);
+  const auto legacy_total = legacy_bytes * enum_count;
+
+  std::printf("enums: %zu, slots per enum: %zu\n", enum_count, slots);
+  std::printf("%-8s %12s %12s %14s\n", "layout", "bytes/enum", "lines/enum",
+              "working set");
+  std::printf("%-8s %12zu %12zu %11zu KB\n", "legacy", legacy_bytes,
+              lines(legacy_bytes), legacy_total / 1024);
+  std::printf("%-8s %12zu %12zu %11zu KB\n", "packed", sizes[0],
+              lines(sizes[0]), packed_total / 1024);
+
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<std::size_t> pick_enum{0, enum_count - 1};
+  std::uniform_int_distribution<int> pick_value{0, 15};
+  std::vector<std::pair<std::size_t, int>> keys(lookups);
+  for (auto &key : keys) {
+    key = {pick_enum(rng), pick_value(rng) * 16};
+  }
+
+  const auto legacy_ns =
+      time_lookups(keys, [&legacy](std::size_t idx, int value) {
+        return legacy[idx](value);
+      });
+  const auto packed_ns =
+      time_lookups(keys, [&packed](std::size_t idx, int value) {
+        return packed[idx](value);
+      });
+
+  std::printf("\nrandom enum_name lookups over all enums\n");
+  std::printf("%-8s %9.2f ns/op\n", "legacy", legacy_ns);
+  std::printf("%-8s %9.2f ns/op\n", "packed", packed_ns);
+}
@@ -0,0 +1,136 @@
+// Compares to_enum on the padded name layout (MGUTILITY_ENUM_NAME_PADDED_SLOTS,
+// set for this target) with the default lookup: a byte-wise FNV-1a hash, one
+// perfect hash probe and a memcmp.
+//
+// The enum has 256 short names; lookups hit random names, and misses use
+// names of the same shape that are not in the enum. The best of several runs
+// is reported.
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class event {
+  net_read, net_write, net_open, net_close, net_sync, net_flush,
+  net_error, net_retry, net_timeout, net_reset, net_start, net_stop,
+  net_pause, net_resume, net_alloc, net_free, net_lock, net_unlock,
+  net_wait, net_signal, net_send, net_recv, net_bind, net_listen,
+  net_accept, net_connect, net_map, net_unmap, net_load, net_store,
+  net_query, net_commit, disk_read, disk_write, disk_open, disk_close,
+  disk_sync, disk_flush, disk_error, disk_retry, disk_timeout, disk_reset,
+  disk_start, disk_stop, disk_pause, disk_resume, disk_alloc, disk_free,
+  disk_lock, disk_unlock, disk_wait, disk_signal, disk_send, disk_recv,
+  disk_bind, disk_listen, disk_accept, disk_connect, disk_map, disk_unmap,
+  disk_load, disk_store, disk_query, disk_commit, cpu_read, cpu_write,
+  cpu_open, cpu_close, cpu_sync, cpu_flush, cpu_error, cpu_retry,
+  cpu_timeout, cpu_reset, cpu_start, cpu_stop, cpu_pause, cpu_resume,
+  cpu_alloc, cpu_free, cpu_lock, cpu_unlock, cpu_wait, cpu_signal,
+  cpu_send, cpu_recv, cpu_bind, cpu_listen, cpu_accept, cpu_connect,
+  cpu_map, cpu_unmap, cpu_load, cpu_store, cpu_query, cpu_commit,
+  mem_read, mem_write, mem_open, mem_close, mem_sync, mem_flush,
+  mem_error, mem_retry, mem_timeout, mem_reset, mem_start, mem_stop,
+  mem_pause, mem_resume, mem_alloc, mem_free, mem_lock, mem_unlock,
+  mem_wait, mem_signal, mem_send, mem_recv, mem_bind, mem_listen,
+  mem_accept, mem_connect, mem_map, mem_unmap, mem_load, mem_store,
+  mem_query, mem_commit, gpu_read, gpu_write, gpu_open, gpu_close,
+  gpu_sync, gpu_flush, gpu_error, gpu_retry, gpu_timeout, gpu_reset,
+  gpu_start, gpu_stop, gpu_pause, gpu_resume, gpu_alloc, gpu_free,
+  gpu_lock, gpu_unlock, gpu_wait, gpu_signal, gpu_send, gpu_recv,
+  gpu_bind, gpu_listen, gpu_accept, gpu_connect, gpu_map, gpu_unmap,
+  gpu_load, gpu_store, gpu_query, gpu_commit, io_read, io_write,
+  io_open, io_close, io_sync, io_flush, io_error, io_retry,
+  io_timeout, io_reset, io_start, io_stop, io_pause, io_resume,
+  io_alloc, io_free, io_lock, io_unlock, io_wait, io_signal,
+  io_send, io_recv, io_bind, io_listen, io_accept, io_connect,
+  io_map, io_unmap, io_load, io_store, io_query, io_commit,
+  fs_read, fs_write, fs_open, fs_close, fs_sync, fs_flush,
+  fs_error, fs_retry, fs_timeout, fs_reset, fs_start, fs_stop,
+  fs_pause, fs_resume, fs_alloc, fs_free, fs_lock, fs_unlock,
+  fs_wait, fs_signal, fs_send, fs_recv, fs_bind, fs_listen,
+  fs_accept, fs_connect, fs_map, fs_unmap, fs_load, fs_store,
+  fs_query, fs_commit, db_read, db_write, db_open, db_close,
+  db_sync, db_flush, db_error, db_retry, db_timeout, db_reset,
+  db_start, db_stop, db_pause, db_resume, db_alloc, db_free,
+  db_lock, db_unlock, db_wait, db_signal, db_send, db_recv,
+  db_bind, db_listen, db_accept, db_connect, db_map, db_unmap,
+  db_load, db_store, db_query, db_commit
+};
+
+namespace {
+
+constexpr std::size_t lookups = std::size_t{1} << 20U;
+constexpr std::size_t runs = 7;
+
+auto default_find(mgutility::string_view name) -> std::size_t {
+  using cache = mgutility::detail::enum_array_cache<event, 0, 256>;
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &index = cache::name_index;
+#else
+  const auto &index = cache::name_index();
+#endif
+  return index.find(name, mgutility::detail::get_enum_array<event>());
+}
+
+auto padded_find(mgutility::string_view name) -> std::size_t {
+  auto value = mgutility::to_enum<event>(name);
+  return value ? static_cast<std::size_t>(*value)
+               : static_cast<std::size_t>(-1);
+}
+
+template <typename Fn>
+auto best_ns(const std::vector<mgutility::string_view> &names, Fn &&find)
+    -> double {
+  auto best = std::numeric_limits<double>::max();
+  std::size_t checksum = 0;
+  for (std::size_t run = 0; run < runs; ++run) {
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &name : names) {
+      checksum += find(name);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::nano>(stop - start).count());
+  }
+  if (checksum == 0) {
+    std::puts("unexpected lookups");
+  }
+  return best / static_cast<double>(names.size());
+}
+
+} // namespace
+
+int main() {
+#if !defined(MGUTILITY_ENUM_NAME_PADDED)
+  std::puts("padded name layout is not available on this target");
+#endif
+  std::vector<std::string> hits;
+  std::vector<std::string> misses;
+  for (int value = 0; value < 256; ++value) {
+    const auto name = mgutility::enum_name(static_cast<event>(value));
+    hits.emplace_back(name.data(), name.size());
+    misses.push_back(hits.back());
+    misses.back().back() = '#';
+  }
+
+  std::mt19937 rng{42};
+  std::uniform_int_distribution<std::size_t> pick{0, 255};
+  std::printf("%-6s %12s %12s\n", "miss%", "default ns", "padded ns");
+  for (auto miss_percent : {0U, 50U}) {
+    std::vector<mgutility::string_view> names(lookups);
+    for (std::size_t idx = 0; idx < lookups; ++idx) {
+      const auto &pool = idx % 100 < miss_percent ? misses : hits;
+      const auto &name = pool[pick(rng)];
+      names[idx] = mgutility::string_view(name.data(), name.size());
+    }
+    std::printf("%-6u %12.2f %12.2f\n", miss_percent,
+                best_ns(names, &default_find), best_ns(names, &padded_find));
+  }
+}
@@ -29,7 +29,9 @@ SOFTWARE.
 #include "mgutility/std/fixed_string.hpp"
 
 // NOLINTNEXTLINE [unused-includes]
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <utility>
 
 namespace mgutility {
@@ -39,15 +41,16 @@ namespace detail {
  * @brief Alias template for a string or string view type based on the presence
  * of a bitwise OR operator.
  *
- * If the type T supports the bitwise OR operator, the alias is a std::string.
- * Otherwise, it is a mgutility::string_view.
+ * If the type T supports the bitwise OR operator or is marked as enum_flags,
+ * the alias is a fixed_string. Otherwise, it is a mgutility::string_view.
  *
  * @tparam T The type to check.
  */
 template <typename T>
 // NOLINTNEXTLINE [modernize-type-traits]
 using string_or_view_t = typename std::conditional<
-    has_bit_or<T>::value, mgutility::fixed_string<enum_name_buffer<T>::size>,
+    has_bit_or<T>::value || enum_flags<T>::value,
+    mgutility::fixed_string<enum_name_buffer<T>::size>,
     mgutility::string_view>::type;
 
 /**
@@ -63,43 +66,45 @@ using enum_pair = std::pair<Enum, detail::string_or_view_t<Enum>>;
 /**
  * @brief A class template for iterating over enum values.
  *
+ * Only the named values are visited, in ascending order; they come from a
+ * list built with the name table, so iteration costs one step per
+ * enumerator whatever the width of enum_range<Enum>.
+ *
  * @tparam Enum The enum type.
  */
 template <typename Enum> class enum_for_each {
-  using value_type = const detail::enum_pair<Enum>;
+  using value_type = detail::enum_pair<Enum>;
   using size_type = std::size_t;
 
   /**
-   * @brief An iterator for enum values.
+   * @brief A random access iterator over the named enum values.
    */
   struct enum_iter {
-    using const_iter_type = int;
-    using iter_type = detail::remove_const_t<const_iter_type>;
-    using iterator_category = std::forward_iterator_tag;
-    using value_type = const detail::enum_pair<Enum>;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = detail::enum_pair<Enum>;
     using difference_type = std::ptrdiff_t;
-    using pointer = value_type *;
-    using reference = value_type &;
+    using pointer = void;
+    using reference = value_type;
 
     /**
      * @brief Default constructor initializing the iterator to the default
      * position.
      */
-    enum_iter() : m_pos{} {}
+    constexpr enum_iter() noexcept : m_pos{} {}
 
     /**
      * @brief Constructor initializing the iterator to a specific position.
      *
-     * @param value The initial position of the iterator.
+     * @param pos The position among the named values.
      */
-    explicit enum_iter(iter_type value) : m_pos{value} {}
+    constexpr explicit enum_iter(difference_type pos) noexcept : m_pos{pos} {}
 
     /**
      * @brief Pre-increment operator.
      *
      * @return A reference to the incremented iterator.
      */
-    auto operator++() -> enum_iter & {
+    MGUTILITY_CNSTXPR auto operator++() noexcept -> enum_iter & {
       ++m_pos;
       return *this;
     }
@@ -109,29 +114,167 @@ template <typename Enum> class enum_for_each {
      *
      * @return A copy of the iterator before incrementing.
      */
-    auto operator++(int) -> enum_iter {
-      m_pos++;
+    MGUTILITY_CNSTXPR auto operator++(int) noexcept -> enum_iter {
+      auto prev = *this;
+      ++m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Pre-decrement operator.
+     *
+     * @return A reference to the decremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator--() noexcept -> enum_iter & {
+      --m_pos;
       return *this;
     }
 
+    /**
+     * @brief Post-decrement operator.
+     *
+     * @return A copy of the iterator before decrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator--(int) noexcept -> enum_iter {
+      auto prev = *this;
+      --m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Advances the iterator.
+     *
+     * @param offset The number of values to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator+=(difference_type offset) noexcept
+        -> enum_iter & {
+      m_pos += offset;
+      return *this;
+    }
+
+    /**
+     * @brief Moves the iterator back.
+     *
+     * @param offset The number of values to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator-=(difference_type offset) noexcept
+        -> enum_iter & {
+      m_pos -= offset;
+      return *this;
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param iter The iterator.
+     * @param offset The number of values to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(const enum_iter &iter,
+                                    difference_type offset) noexcept
+        -> enum_iter {
+      return enum_iter{iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param offset The number of values to move by.
+     * @param iter The iterator.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(difference_type offset,
+                                    const enum_iter &iter) noexcept
+        -> enum_iter {
+      return enum_iter{iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets a copy of an iterator moved back.
+     *
+     * @param iter The iterator.
+     * @param offset The number of values to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator-(const enum_iter &iter,
+                                    difference_type offset) noexcept
+        -> enum_iter {
+      return enum_iter{iter.m_pos - offset};
+    }
+
+    /**
+     * @brief Gets the distance between two iterators.
+     *
+     * @param lhs The later iterator.
+     * @param rhs The earlier iterator.
+     * @return The number of values between the iterators.
+     */
+    friend constexpr auto operator-(const enum_iter &lhs,
+                                    const enum_iter &rhs) noexcept
+        -> difference_type {
+      return lhs.m_pos - rhs.m_pos;
+    }
+
+    /**
+     * @brief Equality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are equal, otherwise false.
+     */
+    constexpr auto operator==(const enum_iter &other) const noexcept -> bool {
+      return m_pos == other.m_pos;
+    }
+
     /**
      * @brief Inequality comparison operator.
      *
      * @param other The other iterator to compare with.
      * @return True if the iterators are not equal, otherwise false.
      */
-    auto operator!=(const enum_iter &other) const -> bool {
+    constexpr auto operator!=(const enum_iter &other) const noexcept -> bool {
       return m_pos != other.m_pos;
     }
 
     /**
-     * @brief Equality comparison operator.
+     * @brief Less-than comparison operator.
      *
      * @param other The other iterator to compare with.
-     * @return True if the iterators are equal, otherwise false.
+     * @return True if this iterator comes first, otherwise false.
      */
-    auto operator==(const enum_iter &other) const -> bool {
-      return m_pos == other.m_pos;
+    constexpr auto operator<(const enum_iter &other) const noexcept -> bool {
+      return m_pos < other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator comes last, otherwise false.
+     */
+    constexpr auto operator>(const enum_iter &other) const noexcept -> bool {
+      return m_pos > other.m_pos;
+    }
+
+    /**
+     * @brief Less-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come last, otherwise false.
+     */
+    constexpr auto operator<=(const enum_iter &other) const noexcept -> bool {
+      return m_pos <= other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come first, otherwise false.
+     */
+    constexpr auto operator>=(const enum_iter &other) const noexcept -> bool {
+      return m_pos >= other.m_pos;
     }
 
     /**
@@ -139,47 +282,74 @@ template <typename Enum> class enum_for_each {
      *
      * @return The current enum pair.
      */
-    auto operator*() const -> value_type;
+    MGUTILITY_CNSTXPR auto operator*() const noexcept -> value_type;
+
+    /**
+     * @brief Subscript operator.
+     *
+     * @param offset The offset from the current position.
+     * @return The enum pair at that offset.
+     */
+    MGUTILITY_CNSTXPR auto operator[](difference_type offset) const noexcept
+        -> value_type {
+      return *(*this + offset);
+    }
 
   private:
-    iter_type m_pos; /**< The current position of the iterator. */
+    difference_type m_pos; /**< The position among the named values. */
   };
 
 public:
+  using iterator = enum_iter;
+  using const_iterator = enum_iter;
+
   /**
    * @brief Default constructor.
    */
-  enum_for_each() = default;
+  constexpr enum_for_each() noexcept = default;
 
   /**
-   * @brief Returns an iterator to the beginning of the enum range.
+   * @brief Returns an iterator to the first named value.
    *
-   * @return A reference to the beginning iterator.
+   * @return The beginning iterator.
    */
-  auto begin() -> enum_iter & { return m_begin; }
+  constexpr auto begin() const noexcept -> enum_iter { return enum_iter{}; }
 
   /**
-   * @brief Returns an iterator to the end of the enum range.
+   * @brief Returns an iterator past the last named value.
    *
-   * @return A reference to the end iterator.
+   * @return The end iterator.
    */
-  auto end() -> enum_iter & { return m_end; }
+  MGUTILITY_CNSTXPR auto end() const noexcept -> enum_iter {
+    return enum_iter{static_cast<typename enum_iter::difference_type>(size())};
+  }
 
   /**
-   * @brief Returns the size of the enum range.
+   * @brief Returns the number of named values.
    *
-   * @return The size of the enum range.
+   * @return The number of named values.
    */
-  auto size() -> std::size_t {
-    return static_cast<int>(enum_range<Enum>::max) -
-           static_cast<int>(enum_range<Enum>::min) + 1;
+  MGUTILITY_CNSTXPR auto size() const noexcept -> size_type;
+
+  /**
+   * @brief Checks whether the enum has no named values.
+   *
+   * @return True if there is no named value, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto empty() const noexcept -> bool {
+    return size() == 0;
   }
 
-private:
-  enum_iter m_begin{
-      static_cast<int>(enum_range<Enum>::min)}; /**< The beginning iterator. */
-  enum_iter m_end{static_cast<int>(enum_range<Enum>::max) +
-                  1}; /**< The end iterator. */
+  /**
+   * @brief Gets a named value and its name.
+   *
+   * @param idx The position of the value, in ascending order.
+   * @return The enum pair.
+   */
+  MGUTILITY_CNSTXPR auto operator[](size_type idx) const noexcept
+      -> value_type {
+    return begin()[static_cast<typename enum_iter::difference_type>(idx)];
+  }
 };
 } // namespace mgutility
 
@@ -0,0 +1,206 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_FORMAT_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_FORMAT_HPP
+
+#include "meta.hpp"
+#include "mgutility/_common/definitions.hpp"
+#include "mgutility/std/string_view.hpp"
+
+#include <cstddef>
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
+
+/**
+ * @brief How an enum formatter writes a value.
+ */
+enum class enum_presentation : char {
+  name,   /**< `{}` or `{:...s}`: the name, through the string formatter. */
+  quoted, /**< `{:...q}`: the name in double quotes. */
+  value   /**< `{:...d}`, `x`, `X`, `o`, `b` or `B`: the underlying value. */
+};
+
+/**
+ * @brief The format spec of an enum formatter.
+ *
+ * The fill, alignment and width are only kept for quoted output; the other
+ * presentations hand the spec to the formatter of the name or the value.
+ */
+struct enum_format_spec {
+  enum_presentation presentation{enum_presentation::name};
+  char fill{' '};        /**< The fill character. */
+  char align{'<'};       /**< '<', '^' or '>'. */
+  std::size_t width{};   /**< The minimum width, 0 for none. */
+};
+
+/**
+ * @brief Finds the end of a format spec, skipping nested replacement fields
+ * such as `{:{}}`.
+ *
+ * @param begin The start of the spec.
+ * @param end The end of the format string.
+ * @return The position of the closing '}', or end.
+ */
+template <typename It>
+MGUTILITY_CNSTXPR auto find_spec_end(It begin, It end) noexcept -> It {
+  std::size_t depth = 0;
+  for (; begin != end; ++begin) {
+    if (*begin == '{') {
+      ++depth;
+    } else if (*begin == '}') {
+      if (depth == 0) {
+        return begin;
+      }
+      --depth;
+    }
+  }
+  return begin;
+}
+
+/**
+ * @brief Picks the presentation of a format spec from its type character.
+ *
+ * @param begin The start of the spec.
+ * @param last The position of the closing '}'.
+ * @return The presentation.
+ */
+template <typename It>
+MGUTILITY_CNSTXPR auto enum_presentation_of(It begin, It last) noexcept
+    -> enum_presentation {
+  if (begin == last) {
+    return enum_presentation::name;
+  }
+  auto type = last;
+  --type;
+  switch (*type) {
+  case 'd':
+  case 'x':
+  case 'X':
+  case 'o':
+  case 'b':
+  case 'B':
+    return enum_presentation::value;
+  case 'q':
+    return enum_presentation::quoted;
+  default:
+    return enum_presentation::name;
+  }
+}
+
+/**
+ * @brief Checks whether a character is a format alignment.
+ *
+ * @param chr The character.
+ * @return True for '<', '^' and '>', otherwise false.
+ */
+constexpr auto is_format_align(char chr) noexcept -> bool {
+  return chr == '<' || chr == '^' || chr == '>';
+}
+
+/**
+ * @brief Parses the `[[fill]align][width]q` spec of quoted output.
+ *
+ * @param begin The start of the spec.
+ * @param last The position of the closing '}'.
+ * @param spec The spec to fill in.
+ * @return True if the spec is valid, otherwise false.
+ */
+template <typename It>
+MGUTILITY_CNSTXPR auto parse_quoted_spec(It begin, It last,
+                                         enum_format_spec &spec) noexcept
+    -> bool {
+  --last; // the 'q'
+  auto next = begin;
+  if (next != last) {
+    ++next;
+  }
+  if (begin != last && next != last && is_format_align(*next)) {
+    spec.fill = *begin;
+    spec.align = *next;
+    begin = ++next;
+  } else if (begin != last && is_format_align(*begin)) {
+    spec.align = *begin;
+    ++begin;
+  }
+  for (; begin != last && *begin >= '0' && *begin <= '9'; ++begin) {
+    spec.width = spec.width * 10 + static_cast<std::size_t>(*begin - '0');
+  }
+  return begin == last;
+}
+
+/**
+ * @brief Writes fill characters.
+ *
+ * @param out The output iterator.
+ * @param fill The fill character.
+ * @param count The number of characters.
+ * @return The output iterator past the fill.
+ */
+template <typename OutputIt>
+auto write_fill(OutputIt out, char fill, std::size_t count) -> OutputIt {
+  for (; count > 0; --count) {
+    *out++ = fill;
+  }
+  return out;
+}
+
+/**
+ * @brief Writes a name in double quotes, escaping quotes and backslashes,
+ * padded as the spec says.
+ *
+ * @param name The name.
+ * @param spec The spec.
+ * @param out The output iterator.
+ * @return The output iterator past the name.
+ */
+template <typename OutputIt>
+auto write_quoted(mgutility::string_view name, const enum_format_spec &spec,
+                  OutputIt out) -> OutputIt {
+  auto size = name.size() + 2;
+  for (std::size_t idx = 0; idx < name.size(); ++idx) {
+    size += name[idx] == '"' || name[idx] == '\\' ? 1 : 0;
+  }
+  const auto pad = spec.width > size ? spec.width - size : 0;
+  const auto before =
+      spec.align == '>' ? pad : spec.align == '^' ? pad / 2 : 0;
+
+  out = write_fill(out, spec.fill, before);
+  *out++ = '"';
+  for (std::size_t idx = 0; idx < name.size(); ++idx) {
+    if (name[idx] == '"' || name[idx] == '\\') {
+      *out++ = '\\';
+    }
+    *out++ = name[idx];
+  }
+  *out++ = '"';
+  return write_fill(out, spec.fill, pad - before);
+}
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_FORMAT_HPP
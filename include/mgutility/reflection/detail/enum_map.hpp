@@ -0,0 +1,567 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_MAP_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_MAP_HPP
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+namespace mgutility {
+
+/**
+ * @brief An element of an enum_map seen through its iterator.
+ *
+ * Supports structured bindings as `auto [key, name, value]`.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Ref The reference type of the mapped value.
+ */
+template <typename Enum, typename Ref> struct enum_map_entry {
+  Enum key;                              /**< The enum value. */
+  detail::string_or_view_t<Enum> name;   /**< The name of the enum value. */
+  Ref value;                             /**< The mapped value. */
+};
+
+/**
+ * @brief A fixed-size map from the named values of an enum to values.
+ *
+ * The values are stored in a contiguous array indexed by the dense ordinal
+ * of enum_index(), so lookups are a table load and iteration visits the
+ * named values in ascending order without hashing. Every named value has
+ * an element, value-initialized on construction.
+ *
+ * operator[] requires a named key: an unnamed one has no element and is
+ * caught by an assertion in debug builds. Use at(), which throws, or find(),
+ * which returns nullptr, when the key may be unnamed.
+ *
+ * The array holds enum_count<Enum>() elements in C++14 and later; C++11
+ * does not know the count at compile time and sizes it for the whole range
+ * instead.
+ *
+ * @tparam Enum The enum type.
+ * @tparam T The mapped type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ */
+template <typename Enum, typename T,
+          int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+class enum_map {
+  static constexpr auto capacity = detail::enum_capacity<Enum, Min, Max>();
+
+  using array_type = std::array<T, capacity == 0 ? 1 : capacity>;
+
+  /**
+   * @brief A random access iterator over the elements.
+   *
+   * @tparam Map The map type, const for a const iterator.
+   * @tparam Ref The reference type of the mapped value.
+   */
+  template <typename Map, typename Ref> class map_iter {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = enum_map_entry<Enum, Ref>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    /**
+     * @brief Default constructor, creating a singular iterator.
+     */
+    constexpr map_iter() noexcept : m_map{}, m_pos{} {}
+
+    /**
+     * @brief Constructor initializing the iterator to a position of a map.
+     *
+     * @param map The map.
+     * @param pos The position among the named values.
+     */
+    constexpr map_iter(Map *map, difference_type pos) noexcept
+        : m_map{map}, m_pos{pos} {}
+
+    /**
+     * @brief Pre-increment operator.
+     *
+     * @return A reference to the incremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator++() noexcept -> map_iter & {
+      ++m_pos;
+      return *this;
+    }
+
+    /**
+     * @brief Post-increment operator.
+     *
+     * @return A copy of the iterator before incrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator++(int) noexcept -> map_iter {
+      auto prev = *this;
+      ++m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Pre-decrement operator.
+     *
+     * @return A reference to the decremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator--() noexcept -> map_iter & {
+      --m_pos;
+      return *this;
+    }
+
+    /**
+     * @brief Post-decrement operator.
+     *
+     * @return A copy of the iterator before decrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator--(int) noexcept -> map_iter {
+      auto prev = *this;
+      --m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Advances the iterator.
+     *
+     * @param offset The number of elements to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator+=(difference_type offset) noexcept
+        -> map_iter & {
+      m_pos += offset;
+      return *this;
+    }
+
+    /**
+     * @brief Moves the iterator back.
+     *
+     * @param offset The number of elements to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator-=(difference_type offset) noexcept
+        -> map_iter & {
+      m_pos -= offset;
+      return *this;
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param iter The iterator.
+     * @param offset The number of elements to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(const map_iter &iter,
+                                    difference_type offset) noexcept
+        -> map_iter {
+      return map_iter{iter.m_map, iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param offset The number of elements to move by.
+     * @param iter The iterator.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(difference_type offset,
+                                    const map_iter &iter) noexcept
+        -> map_iter {
+      return map_iter{iter.m_map, iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets a copy of an iterator moved back.
+     *
+     * @param iter The iterator.
+     * @param offset The number of elements to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator-(const map_iter &iter,
+                                    difference_type offset) noexcept
+        -> map_iter {
+      return map_iter{iter.m_map, iter.m_pos - offset};
+    }
+
+    /**
+     * @brief Gets the distance between two iterators of the same map.
+     *
+     * @param lhs The later iterator.
+     * @param rhs The earlier iterator.
+     * @return The number of elements between the iterators.
+     */
+    friend constexpr auto operator-(const map_iter &lhs,
+                                    const map_iter &rhs) noexcept
+        -> difference_type {
+      return lhs.m_pos - rhs.m_pos;
+    }
+
+    /**
+     * @brief Equality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are equal, otherwise false.
+     */
+    constexpr auto operator==(const map_iter &other) const noexcept -> bool {
+      return m_pos == other.m_pos;
+    }
+
+    /**
+     * @brief Inequality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are not equal, otherwise false.
+     */
+    constexpr auto operator!=(const map_iter &other) const noexcept -> bool {
+      return m_pos != other.m_pos;
+    }
+
+    /**
+     * @brief Less-than comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator comes first, otherwise false.
+     */
+    constexpr auto operator<(const map_iter &other) const noexcept -> bool {
+      return m_pos < other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator comes last, otherwise false.
+     */
+    constexpr auto operator>(const map_iter &other) const noexcept -> bool {
+      return m_pos > other.m_pos;
+    }
+
+    /**
+     * @brief Less-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come last, otherwise false.
+     */
+    constexpr auto operator<=(const map_iter &other) const noexcept -> bool {
+      return m_pos <= other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come first, otherwise false.
+     */
+    constexpr auto operator>=(const map_iter &other) const noexcept -> bool {
+      return m_pos >= other.m_pos;
+    }
+
+    /**
+     * @brief Dereference operator.
+     *
+     * @return The key, its name and a reference to the mapped value.
+     */
+    MGUTILITY_CNSTXPR auto operator*() const noexcept -> value_type {
+      const auto idx = static_cast<std::size_t>(m_pos);
+      auto pair = detail::enum_value_at<Enum, Min, Max>(idx);
+      return value_type{pair.first, pair.second, m_map->m_values[idx]};
+    }
+
+    /**
+     * @brief Subscript operator.
+     *
+     * @param offset The offset from the current position.
+     * @return The element at that offset.
+     */
+    MGUTILITY_CNSTXPR auto operator[](difference_type offset) const noexcept
+        -> value_type {
+      return *(*this + offset);
+    }
+
+  private:
+    Map *m_map;            /**< The map iterated over. */
+    difference_type m_pos; /**< The position among the named values. */
+  };
+
+public:
+  using key_type = Enum;
+  using mapped_type = T;
+  using size_type = std::size_t;
+  using iterator = map_iter<enum_map, T &>;
+  using const_iterator = map_iter<const enum_map, const T &>;
+
+  /**
+   * @brief Default constructor, value-initializing every element.
+   */
+  constexpr enum_map() noexcept(noexcept(T{})) : m_values{} {}
+
+  /**
+   * @brief Returns the number of elements, one per named value.
+   *
+   * @return The number of elements.
+   */
+  MGUTILITY_CNSTXPR auto size() const noexcept -> size_type {
+    return enum_count<Enum, Min, Max>();
+  }
+
+  /**
+   * @brief Checks whether the enum has no named values.
+   *
+   * @return True if the map has no element, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto empty() const noexcept -> bool { return size() == 0; }
+
+  /**
+   * @brief Checks whether an enum value has an element.
+   *
+   * @param key The enum value.
+   * @return True if the value is named, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto contains(Enum key) const noexcept -> bool {
+    return enum_index<Enum, Min, Max>(key).has_value();
+  }
+
+  /**
+   * @brief Gets the element of a named value.
+   *
+   * @param key The enum value, which must be named.
+   * @return A reference to the mapped value.
+   */
+  MGUTILITY_CNSTXPR auto operator[](Enum key) noexcept -> T & {
+    return m_values[named_index(key)];
+  }
+
+  /**
+   * @brief Gets the element of a named value.
+   *
+   * @param key The enum value, which must be named.
+   * @return A const reference to the mapped value.
+   */
+  MGUTILITY_CNSTXPR auto operator[](Enum key) const noexcept -> const T & {
+    return m_values[named_index(key)];
+  }
+
+  /**
+   * @brief Gets the element of an enum value, checking that it is named.
+   *
+   * @param key The enum value.
+   * @return A reference to the mapped value.
+   * @throws std::out_of_range if the value is not named.
+   */
+  auto at(Enum key) -> T & { return m_values[checked_index(key)]; }
+
+  /**
+   * @brief Gets the element of an enum value, checking that it is named.
+   *
+   * @param key The enum value.
+   * @return A const reference to the mapped value.
+   * @throws std::out_of_range if the value is not named.
+   */
+  auto at(Enum key) const -> const T & { return m_values[checked_index(key)]; }
+
+  /**
+   * @brief Finds the element of an enum value.
+   *
+   * @param key The enum value.
+   * @return A pointer to the mapped value, nullptr if the value is not named.
+   */
+  MGUTILITY_CNSTXPR auto find(Enum key) noexcept -> T * {
+    auto index = enum_index<Enum, Min, Max>(key);
+    return index ? &m_values[*index] : nullptr;
+  }
+
+  /**
+   * @brief Finds the element of an enum value.
+   *
+   * @param key The enum value.
+   * @return A pointer to the mapped value, nullptr if the value is not named.
+   */
+  MGUTILITY_CNSTXPR auto find(Enum key) const noexcept -> const T * {
+    auto index = enum_index<Enum, Min, Max>(key);
+    return index ? &m_values[*index] : nullptr;
+  }
+
+  /**
+   * @brief Finds the element of an enum value by its name.
+   *
+   * The name is looked up with to_enum().
+   *
+   * @param name The name of the enum value.
+   * @return A pointer to the mapped value, nullptr if no named value has
+   * that name.
+   */
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view name) noexcept -> T * {
+    auto key = to_enum<Enum, Min, Max>(name);
+    return key ? find(*key) : nullptr;
+  }
+
+  /**
+   * @brief Finds the element of an enum value by its name.
+   *
+   * The name is looked up with to_enum().
+   *
+   * @param name The name of the enum value.
+   * @return A pointer to the mapped value, nullptr if no named value has
+   * that name.
+   */
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view name) const noexcept
+      -> const T * {
+    auto key = to_enum<Enum, Min, Max>(name);
+    return key ? find(*key) : nullptr;
+  }
+
+  /**
+   * @brief Gets the mapped values, in the order of the named values.
+   *
+   * @return A pointer to the first of size() values.
+   */
+  MGUTILITY_CNSTXPR auto data() noexcept -> T * { return m_values.data(); }
+
+  /**
+   * @brief Gets the mapped values, in the order of the named values.
+   *
+   * @return A pointer to the first of size() values.
+   */
+  MGUTILITY_CNSTXPR auto data() const noexcept -> const T * {
+    return m_values.data();
+  }
+
+  /**
+   * @brief Assigns a value to every element.
+   *
+   * @param value The value.
+   */
+  MGUTILITY_CNSTXPR void fill(const T &value) {
+    for (size_type idx = 0; idx < size(); ++idx) {
+      m_values[idx] = value;
+    }
+  }
+
+  /**
+   * @brief Returns an iterator to the first element.
+   *
+   * @return The beginning iterator.
+   */
+  MGUTILITY_CNSTXPR auto begin() noexcept -> iterator {
+    return iterator{this, 0};
+  }
+
+  /**
+   * @brief Returns an iterator past the last element.
+   *
+   * @return The end iterator.
+   */
+  MGUTILITY_CNSTXPR auto end() noexcept -> iterator {
+    return iterator{this, static_cast<std::ptrdiff_t>(size())};
+  }
+
+  /**
+   * @brief Returns a const iterator to the first element.
+   *
+   * @return The beginning iterator.
+   */
+  MGUTILITY_CNSTXPR auto begin() const noexcept -> const_iterator {
+    return const_iterator{this, 0};
+  }
+
+  /**
+   * @brief Returns a const iterator past the last element.
+   *
+   * @return The end iterator.
+   */
+  MGUTILITY_CNSTXPR auto end() const noexcept -> const_iterator {
+    return const_iterator{this, static_cast<std::ptrdiff_t>(size())};
+  }
+
+private:
+  /**
+   * @brief Gets the dense ordinal of a key that must be named.
+   *
+   * @param key The enum value.
+   * @return The dense ordinal of the value.
+   */
+  static MGUTILITY_CNSTXPR auto named_index(Enum key) noexcept -> std::size_t {
+    auto index = enum_index<Enum, Min, Max>(key);
+    assert(index.has_value() && "enum_map::operator[] needs a named key");
+    return index.value_or(0);
+  }
+
+  /**
+   * @brief Gets the dense ordinal of a key, checking that it is named.
+   *
+   * @param key The enum value.
+   * @return The dense ordinal of the value.
+   * @throws std::out_of_range if the value is not named.
+   */
+  static auto checked_index(Enum key) -> std::size_t {
+    auto index = enum_index<Enum, Min, Max>(key);
+    if (!index) {
+      throw std::out_of_range("enum_map::at: the key is not a named value");
+    }
+    return *index;
+  }
+
+  array_type m_values; /**< The mapped values, by dense ordinal. */
+};
+
+/**
+ * @brief A perfect hash of the values of an enum, usable as the Hash of
+ * unordered containers.
+ *
+ * A named value hashes to its dense ordinal, below enum_count(), so named
+ * values never collide. Any other value hashes to enum_count() plus its
+ * underlying bits, which stays clear of the ordinals unless the sum wraps
+ * around (64-bit values close to the top of the type).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+struct enum_hash {
+  /**
+   * @brief Hashes an enum value.
+   *
+   * @param key The enum value.
+   * @return The hash of the value.
+   */
+  MGUTILITY_CNSTXPR auto operator()(Enum key) const noexcept -> std::size_t {
+    auto index = enum_index<Enum, Min, Max>(key);
+    return index ? *index
+                 : enum_count<Enum, Min, Max>() +
+                       static_cast<std::size_t>(detail::flag_value(key));
+  }
+};
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_MAP_HPP
@@ -0,0 +1,570 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_HASH_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_HASH_HPP
+
+#include "meta.hpp"
+#include "mgutility/_common/definitions.hpp"
+#include "mgutility/std/string_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
+
+/**
+ * @brief The initial value of the FNV-1a name hash.
+ */
+constexpr std::uint64_t name_hash_seed = 0xcbf29ce484222325ULL;
+
+/**
+ * @brief Feeds one character into the FNV-1a name hash.
+ *
+ * Lets a parser hash a name while it scans for the end of it.
+ *
+ * @param hash The hash of the characters before.
+ * @param chr The next character.
+ * @return The hash including the character.
+ */
+constexpr auto name_hash_step(std::uint64_t hash, char chr) noexcept
+    -> std::uint64_t {
+  return (hash ^ static_cast<unsigned char>(chr)) * 0x100000001b3ULL;
+}
+
+/**
+ * @brief Computes the 64-bit FNV-1a hash of a name.
+ *
+ * This is the only pass over the input bytes during a name lookup; both the
+ * bucket and the final table position are derived from this value.
+ *
+ * @param str The name to hash.
+ * @return The hash value.
+ */
+MGUTILITY_CNSTXPR inline auto name_hash(mgutility::string_view str) noexcept
+    -> std::uint64_t {
+  std::uint64_t hash = name_hash_seed;
+  for (std::size_t i = 0; i < str.size(); ++i) {
+    hash = name_hash_step(hash, str[i]);
+  }
+  return hash;
+}
+
+/**
+ * @brief Defines MGUTILITY_IS_CONSTANT_EVALUATED() where the compiler can
+ * tell constant evaluation apart, so memcmp and vector code stay out of
+ * constant evaluation.
+ */
+#if MGUTILITY_CPLUSPLUS == 201103L
+#define MGUTILITY_IS_CONSTANT_EVALUATED() false
+#elif (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) ||           \
+    (defined(__clang__) && __clang_major__ >= 9) ||                            \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define MGUTILITY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+/**
+ * @brief Compares two names for equality.
+ *
+ * Both std::string_view and the pre-C++17 fallback end up in a length check
+ * followed by a single memcmp at runtime. C++14 also builds its name tables
+ * in constant expressions, where memcmp is not allowed, so it compares
+ * characters one by one there.
+ *
+ * @param lhs The left-hand side name.
+ * @param rhs The right-hand side name.
+ * @return True if the names are equal, otherwise false.
+ */
+MGUTILITY_CNSTXPR inline auto equal_names(mgutility::string_view lhs,
+                                          mgutility::string_view rhs) noexcept
+    -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return lhs == rhs;
+#else
+#if MGUTILITY_CPLUSPLUS == 201402L
+#if defined(MGUTILITY_IS_CONSTANT_EVALUATED)
+  if (MGUTILITY_IS_CONSTANT_EVALUATED()) {
+#endif
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (std::size_t pos = 0; pos < lhs.size(); ++pos) {
+      if (lhs[pos] != rhs[pos]) {
+        return false;
+      }
+    }
+    return true;
+#if defined(MGUTILITY_IS_CONSTANT_EVALUATED)
+  }
+#endif
+#endif
+  return lhs.size() == rhs.size() &&
+         std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+#endif
+}
+
+/**
+ * @brief Folds an ASCII upper-case letter to lower case.
+ *
+ * @param chr The character.
+ * @return The lower-case letter, or chr if it is not an upper-case letter.
+ */
+constexpr auto fold_ascii(char chr) noexcept -> char {
+  return chr >= 'A' && chr <= 'Z' ? static_cast<char>(chr - 'A' + 'a') : chr;
+}
+
+/**
+ * @brief Compares two names for equality, ignoring ASCII case.
+ *
+ * @param lhs The left-hand side name.
+ * @param rhs The right-hand side name.
+ * @return True if the names are equal after folding, otherwise false.
+ */
+MGUTILITY_CNSTXPR inline auto
+equal_folded_names(mgutility::string_view lhs,
+                   mgutility::string_view rhs) noexcept -> bool {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (std::size_t idx = 0; idx < lhs.size(); ++idx) {
+    if (fold_ascii(lhs[idx]) != fold_ascii(rhs[idx])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief The hash an enum_name_hash_index is built with by default.
+ */
+struct fnv_name_hasher {
+  /**
+   * @brief Hashes a name.
+   *
+   * @param str The name.
+   * @return The name_hash() of the name.
+   */
+  static MGUTILITY_CNSTXPR auto hash(mgutility::string_view str) noexcept
+      -> std::uint64_t {
+    return name_hash(str);
+  }
+
+  /**
+   * @brief Feeds one character into the hash, for parsers that hash while
+   * scanning.
+   *
+   * @param hash The hash of the characters before.
+   * @param chr The next character.
+   * @return The hash including the character.
+   */
+  static constexpr auto step(std::uint64_t hash, char chr) noexcept
+      -> std::uint64_t {
+    return name_hash_step(hash, chr);
+  }
+
+  /**
+   * @brief Maps a character the way the index sees it.
+   *
+   * @param chr The character.
+   * @return The character itself.
+   */
+  static constexpr auto fold(char chr) noexcept -> char { return chr; }
+
+  /**
+   * @brief Compares two names the way the index matches them.
+   *
+   * @param lhs The left-hand side name.
+   * @param rhs The right-hand side name.
+   * @return True if the names are equal, otherwise false.
+   */
+  static MGUTILITY_CNSTXPR auto equal(mgutility::string_view lhs,
+                                      mgutility::string_view rhs) noexcept
+      -> bool {
+    return equal_names(lhs, rhs);
+  }
+};
+
+/**
+ * @brief The hash of the case-insensitive name index.
+ *
+ * Hashes and compares names with ASCII letters folded to lower case, so the
+ * input is folded on the fly and never copied.
+ */
+struct folded_name_hasher {
+  /**
+   * @brief Hashes a name, ignoring ASCII case.
+   *
+   * @param str The name.
+   * @return The name_hash() of the folded name.
+   */
+  static MGUTILITY_CNSTXPR auto hash(mgutility::string_view str) noexcept
+      -> std::uint64_t {
+    std::uint64_t hash = name_hash_seed;
+    for (std::size_t i = 0; i < str.size(); ++i) {
+      hash = name_hash_step(hash, fold_ascii(str[i]));
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Feeds one character into the hash, ignoring ASCII case.
+   *
+   * @param hash The hash of the characters before.
+   * @param chr The next character.
+   * @return The hash including the folded character.
+   */
+  static constexpr auto step(std::uint64_t hash, char chr) noexcept
+      -> std::uint64_t {
+    return name_hash_step(hash, fold_ascii(chr));
+  }
+
+  /**
+   * @brief Maps a character the way the index sees it.
+   *
+   * @param chr The character.
+   * @return The character folded to lower case.
+   */
+  static constexpr auto fold(char chr) noexcept -> char {
+    return fold_ascii(chr);
+  }
+
+  /**
+   * @brief Compares two names, ignoring ASCII case.
+   *
+   * @param lhs The left-hand side name.
+   * @param rhs The right-hand side name.
+   * @return True if the names are equal after folding, otherwise false.
+   */
+  static MGUTILITY_CNSTXPR auto equal(mgutility::string_view lhs,
+                                      mgutility::string_view rhs) noexcept
+      -> bool {
+    return equal_folded_names(lhs, rhs);
+  }
+};
+
+/**
+ * @brief Maps a 32-bit value onto [0, range) without a division.
+ *
+ * @param value The value to reduce.
+ * @param range The size of the target range.
+ * @return The reduced value.
+ */
+constexpr auto reduce_range(std::uint32_t value, std::size_t range) noexcept
+    -> std::size_t {
+  return static_cast<std::size_t>((static_cast<std::uint64_t>(value) *
+                                   static_cast<std::uint64_t>(range)) >>
+                                  32U);
+}
+
+/**
+ * @brief Picks the bucket of a name hash.
+ *
+ * FNV-1a leaves its high bits almost untouched by the last characters, so
+ * names sharing a long prefix would pile into a few buckets; one multiply
+ * spreads the low bits into the word the bucket is taken from.
+ *
+ * @param hash The name hash.
+ * @param range The number of buckets.
+ * @return The bucket index.
+ */
+constexpr auto hash_bucket(std::uint64_t hash, std::size_t range) noexcept
+    -> std::size_t {
+  return reduce_range(
+      static_cast<std::uint32_t>((hash * 0x9e3779b97f4a7c15ULL) >> 32U), range);
+}
+
+/**
+ * @brief Remixes a name hash with a bucket displacement.
+ *
+ * @param hash The name hash.
+ * @param disp The displacement of the bucket the name falls into.
+ * @return The mixed 32-bit value used to pick the table position.
+ */
+MGUTILITY_CNSTXPR inline auto displace(std::uint64_t hash,
+                                       std::uint32_t disp) noexcept
+    -> std::uint32_t {
+  hash += static_cast<std::uint64_t>(disp) * 0x9e3779b97f4a7c15ULL;
+  hash ^= hash >> 33U;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33U;
+  return static_cast<std::uint32_t>(hash);
+}
+
+/**
+ * @brief Minimal perfect hash index from enum names to slots of the reflected
+ * range.
+ *
+ * Built with the hash-and-displace scheme: every name hashes into one of
+ * `size` buckets, and each bucket stores a displacement that sends all of its
+ * names to distinct, free table positions. A lookup is one hash, one table
+ * probe and one compare against the name table. Only small integers are
+ * stored; the names themselves stay in the name table.
+ *
+ * @tparam N The capacity of the index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash, a type with a static hash(string_view) and a
+ * static equal(string_view, string_view).
+ */
+template <std::size_t N, std::size_t Slots,
+          typename Hasher = fnv_name_hasher>
+struct enum_name_hash_index {
+  static constexpr auto npos = static_cast<std::size_t>(-1);
+  static constexpr auto max_displacement = 64U * N + 1024U;
+
+  using displacement_type = uint_fit_t<max_displacement>;
+  using slot_type = uint_fit_t<Slots>;
+
+  std::size_t size{};    /**< Number of names in the index. */
+  bool collision_free{}; /**< Every name resolves to its own slot. */
+  constant_array<displacement_type, N> displacements{}; /**< Per bucket. */
+  constant_array<slot_type, N> slots{}; /**< Range slot, Slots if unused. */
+
+  /**
+   * @brief Finds the slot of a name.
+   *
+   * @param str The name to look up.
+   * @param names The name table the index was built from.
+   * @return The slot of the name within the reflected range, or npos.
+   */
+  template <typename Names>
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view str,
+                              const Names &names) const noexcept
+      -> std::size_t {
+    return find(str, Hasher::hash(str), names);
+  }
+
+  /**
+   * @brief Finds the slot of a name whose hash is already known.
+   *
+   * @param str The name to look up.
+   * @param hash The Hasher::hash() of the name.
+   * @param names The name table the index was built from.
+   * @return The slot of the name within the reflected range, or npos.
+   */
+  template <typename Names>
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view str, std::uint64_t hash,
+                              const Names &names) const noexcept
+      -> std::size_t {
+    if (size == 0 || str.empty()) {
+      return npos;
+    }
+    const auto bucket = hash_bucket(hash, size);
+    const auto pos = reduce_range(displace(hash, displacements[bucket]), size);
+    const auto slot = static_cast<std::size_t>(slots[pos]);
+    return slot < Slots && Hasher::equal(names[slot], str) ? slot : npos;
+  }
+};
+
+#if MGUTILITY_CPLUSPLUS == 201103L
+/**
+ * @brief A work array of make_name_hash_index (C++11).
+ *
+ * C++11 builds the index at runtime, sized for the whole range, so the work
+ * arrays are allocated instead of taking several megabytes of stack.
+ *
+ * @tparam T The element type.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N> struct hash_work_array : std::vector<T> {
+  hash_work_array() : std::vector<T>(N) {}
+};
+#else
+/**
+ * @brief A work array of make_name_hash_index, assignable in a constant
+ * expression.
+ *
+ * @tparam T The element type.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N>
+using hash_work_array = constant_array<T, N>;
+#endif
+
+/**
+ * @brief Builds the perfect hash index for a name table.
+ *
+ * Buckets are placed largest first; for each one the displacement is
+ * increased until all of its names land on free positions. When a name
+ * occurs more than once, the lowest slot wins, matching a front-to-back
+ * search. The result is verified by looking every name up again, and
+ * `collision_free` reports whether that succeeded.
+ *
+ * @tparam N The capacity of the index, at least the number of names.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash of the index.
+ * @param names The name table, indexed by slot.
+ * @return The hash index.
+ */
+template <std::size_t N, std::size_t Slots,
+          typename Hasher = fnv_name_hasher, typename Names>
+MGUTILITY_CNSTXPR auto make_name_hash_index(const Names &names) noexcept
+    -> enum_name_hash_index<N, Slots, Hasher> {
+  using index_type = enum_name_hash_index<N, Slots, Hasher>;
+  using displacement_type = typename index_type::displacement_type;
+  using slot_type = typename index_type::slot_type;
+  index_type index{};
+
+  hash_work_array<std::size_t, N> key_slots{};
+  hash_work_array<std::uint64_t, N> hashes{};
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < Slots && count < N; ++slot) {
+    if (!names[slot].empty()) {
+      key_slots[count] = slot;
+      hashes[count] = Hasher::hash(names[slot]);
+      ++count;
+    }
+  }
+
+  index.size = count;
+  for (std::size_t pos = 0; pos < N; ++pos) {
+    index.slots[pos] = static_cast<slot_type>(Slots);
+  }
+
+  // Counting sort of the names by bucket, keeping slot order inside buckets.
+  hash_work_array<std::size_t, N + 1> bucket_start{};
+  for (std::size_t key = 0; key < count; ++key) {
+    ++bucket_start[hash_bucket(hashes[key], count) + 1];
+  }
+  std::size_t max_bucket = 0;
+  for (std::size_t bucket = 0; bucket < count; ++bucket) {
+    max_bucket = bucket_start[bucket + 1] > max_bucket
+                     ? bucket_start[bucket + 1]
+                     : max_bucket;
+    bucket_start[bucket + 1] += bucket_start[bucket];
+  }
+
+  hash_work_array<std::size_t, N> order{};
+  hash_work_array<std::size_t, N> cursor{};
+  for (std::size_t bucket = 0; bucket < count; ++bucket) {
+    cursor[bucket] = bucket_start[bucket];
+  }
+  for (std::size_t key = 0; key < count; ++key) {
+    const auto bucket = hash_bucket(hashes[key], count);
+    order[cursor[bucket]++] = key;
+  }
+
+  hash_work_array<bool, N> taken{};
+  hash_work_array<std::size_t, N> positions{};
+  const auto max_disp = static_cast<std::uint32_t>(64U * count + 1024U);
+
+  for (auto bucket_size = max_bucket; bucket_size > 0; --bucket_size) {
+    for (std::size_t bucket = 0; bucket < count; ++bucket) {
+      const auto first = bucket_start[bucket];
+      const auto last = bucket_start[bucket + 1];
+      if (last - first != bucket_size) {
+        continue;
+      }
+
+      std::uint32_t disp = 0;
+      for (; disp < max_disp; ++disp) {
+        auto placed = true;
+        for (auto idx = first; idx < last && placed; ++idx) {
+          const auto key = order[idx];
+          positions[idx] = index_type::npos;
+          auto duplicate = false;
+          for (auto prev = first; prev < idx && !duplicate; ++prev) {
+            duplicate = hashes[order[prev]] == hashes[key] &&
+                        Hasher::equal(names[key_slots[order[prev]]],
+                                      names[key_slots[key]]);
+          }
+          if (duplicate) {
+            continue;
+          }
+          const auto pos = reduce_range(displace(hashes[key], disp), count);
+          placed = !taken[pos];
+          for (auto prev = first; prev < idx && placed; ++prev) {
+            placed = positions[prev] != pos;
+          }
+          positions[idx] = pos;
+        }
+        if (placed) {
+          break;
+        }
+      }
+
+      if (disp == max_disp) {
+        return index;
+      }
+
+      index.displacements[bucket] = static_cast<displacement_type>(disp);
+      for (auto idx = first; idx < last; ++idx) {
+        const auto pos = positions[idx];
+        if (pos != index_type::npos) {
+          taken[pos] = true;
+          index.slots[pos] = static_cast<slot_type>(key_slots[order[idx]]);
+        }
+      }
+    }
+  }
+
+  auto resolved = true;
+  for (std::size_t key = 0; key < count && resolved; ++key) {
+    const auto slot = index.find(names[key_slots[key]], names);
+    resolved = slot != index_type::npos &&
+               Hasher::equal(names[slot], names[key_slots[key]]);
+  }
+  index.collision_free = resolved;
+
+  return index;
+}
+
+/**
+ * @brief Checks that every name of a table is found as itself.
+ *
+ * An index whose Hasher::equal is looser than equality, like the
+ * case-insensitive one, merges names that only differ in what it ignores;
+ * the lowest slot wins, so the other names would silently resolve to a
+ * different value.
+ *
+ * @tparam N The capacity of the index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash of the index.
+ * @param index The hash index.
+ * @param names The name table the index was built from.
+ * @return True if no two distinct names match each other, otherwise false.
+ */
+template <std::size_t N, std::size_t Slots, typename Hasher, typename Names>
+MGUTILITY_CNSTXPR auto
+names_unambiguous(const enum_name_hash_index<N, Slots, Hasher> &index,
+                  const Names &names) noexcept -> bool {
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    if (names[slot].empty()) {
+      continue;
+    }
+    const auto found = index.find(names[slot], names);
+    if (found == index.npos || !equal_names(names[found], names[slot])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_HASH_HPP
@@ -27,6 +27,10 @@ SOFTWARE.
 
 // NOLINTNEXTLINE [unused-includes]
 #include "enum_for_each.hpp"
+#include "enum_name_hash.hpp"
+#include "enum_name_overlay.hpp"
+#include "enum_name_padded.hpp"
+#include "enum_name_prefix.hpp"
 #include "meta.hpp"
 #include "mgutility/_common/definitions.hpp"
 #include "mgutility/std/fixed_string.hpp"
@@ -38,6 +42,8 @@ SOFTWARE.
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <string>
+#include <type_traits>
 
 /**
  * @brief Checks for MSVC compiler version.
@@ -87,28 +93,237 @@ namespace detail {
 #define MGUTILITY_STRLEN(x) sizeof(x) - 1
 #endif
 
+template <typename T, int Min, int Max>
+using enum_name_array =
+    std::array<mgutility::string_view, static_cast<std::size_t>(Max - Min)>;
+
+template <typename T>
+using enum_flag_array = std::array<mgutility::string_view, flag_bits<T>() + 1>;
+
+template <typename Enum, int Lo, std::size_t Count> struct enum_name_chunk;
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
 /**
- * @brief Parse result for enum names.
+ * @brief Names parsed from a probe signature in a constant expression, and
+ * where the token after them starts.
  *
- * Templated on the underlying type U instead of the enum type itself,
- * so all enums with the same underlying type (e.g., all 'int'-based enums)
- * share the same struct type. The strings buffer is a fixed size
- * (MGUTILITY_GLOBAL_ENUM_BLOB_SIZE) rather than a per-enum-type
- * fixed_string, reducing template bloat.
+ * @tparam Count The number of names.
+ */
+template <std::size_t Count> struct parsed_names {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  mgutility::string_view items[Count == 0 ? 1 : Count]; /**< The names. */
+  std::size_t next; /**< The position of the token after the names. */
+};
+
+/**
+ * @brief Finds a character in a string.
  *
- * @tparam U The underlying type of the enum (e.g., int, unsigned int).
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
+ * @param str The string.
+ * @param chr The character.
+ * @param pos The position to start from.
+ * @return The position of the character, or the size of the string.
+ */
+constexpr auto find_char(mgutility::string_view str, char chr,
+                         std::size_t pos) noexcept -> std::size_t {
+  return pos >= str.size() || str[pos] == chr ? pos
+                                              : find_char(str, chr, pos + 1);
+}
+
+/**
+ * @brief Finds the last occurrence of a character before a position.
+ *
+ * @param str The string.
+ * @param chr The character.
+ * @param pos The position to search back from.
+ * @return The position of the character, or the size of the string.
+ */
+constexpr auto find_last_char(mgutility::string_view str, char chr,
+                              std::size_t pos) noexcept -> std::size_t {
+  return pos == 0                ? str.size()
+         : str[pos - 1] == chr ? pos - 1
+                               : find_last_char(str, chr, pos - 1);
+}
+
+/**
+ * @brief Checks whether a token is a value printed as a cast, i.e. a value
+ * without a name.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return True if the token has a parenthesis, otherwise false.
+ */
+constexpr auto is_cast_token(mgutility::string_view str, std::size_t first,
+                             std::size_t last) noexcept -> bool {
+  return first != last && (str[first] == '(' || str[first] == ')' ||
+                           is_cast_token(str, first + 1, last));
+}
+
+/**
+ * @brief Skips the scope qualifiers of a token.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return The position after the last ':' of the token, or first.
+ */
+constexpr auto skip_scope(mgutility::string_view str, std::size_t first,
+                          std::size_t last) noexcept -> std::size_t {
+  return last == first || str[last - 1] == ':'
+             ? last
+             : skip_scope(str, first, last - 1);
+}
+
+/**
+ * @brief Skips the blanks at the front of a token.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return The position of the first non-blank character, or last.
+ */
+constexpr auto skip_front_blanks(mgutility::string_view str,
+                                 std::size_t first, std::size_t last) noexcept
+    -> std::size_t {
+  return first < last && str[first] == ' '
+             ? skip_front_blanks(str, first + 1, last)
+             : first;
+}
+
+/**
+ * @brief Skips the blanks at the back of a token.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return The position past the last non-blank character, or first.
+ */
+constexpr auto skip_back_blanks(mgutility::string_view str,
+                                std::size_t first, std::size_t last) noexcept
+    -> std::size_t {
+  return last > first && str[last - 1] == ' '
+             ? skip_back_blanks(str, first, last - 1)
+             : last;
+}
+
+/**
+ * @brief Gets the name of a token without its blanks.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the name.
+ * @param last The position past the token.
+ * @return The name.
+ */
+constexpr auto trimmed_token(mgutility::string_view str, std::size_t first,
+                             std::size_t last) noexcept
+    -> mgutility::string_view {
+  return mgutility::string_view(str.data() + first,
+                                skip_back_blanks(str, first, last) - first);
+}
+
+/**
+ * @brief Gets the name of the value printed as a token of a probe signature.
+ *
+ * Mirrors enum_type::parse_names(): the part after the last scope qualifier
+ * is kept, and a value printed as a cast has no name.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position of the separator after the token.
+ * @return The name, or an empty string_view for a value without a name.
+ */
+constexpr auto token_name(mgutility::string_view str, std::size_t first,
+                          std::size_t last) noexcept
+    -> mgutility::string_view {
+  return is_cast_token(str, first, last)
+             ? mgutility::string_view{}
+             : trimmed_token(
+                   str,
+                   skip_front_blanks(str, skip_scope(str, first, last), last),
+                   last);
+}
+
+/**
+ * @brief Joins two runs of parsed names.
+ *
+ * @param left The first names.
+ * @param right The names following them.
+ * @return The names of both runs, ending where the right one ends.
+ */
+template <std::size_t Left, std::size_t Right, std::size_t... L,
+          std::size_t... R>
+constexpr auto join_names(const parsed_names<Left> &left,
+                          const parsed_names<Right> &right,
+                          index_sequence<L...> /*unused*/,
+                          index_sequence<R...> /*unused*/) noexcept
+    -> parsed_names<Left + Right> {
+  return parsed_names<Left + Right>{{left.items[L]..., right.items[R]...},
+                                    right.next};
+}
+
+/**
+ * @brief Splits the tokens of a probe signature into names in a C++11
+ * constant expression.
+ *
+ * C++11 constexpr functions cannot loop, so the tokens are split in halves:
+ * the recursion is only log2(Count) calls deep apart from the characters of
+ * a single token, and every character is visited once.
+ *
+ * @tparam Count The number of tokens to split.
+ */
+template <std::size_t Count> struct name_splitter {
+  static constexpr auto half = Count / 2;
+
+  /**
+   * @brief Splits tokens into names.
+   *
+   * @param str The probe signature.
+   * @param pos The position of the first token.
+   * @return The names of the tokens.
+   */
+  static constexpr auto split(mgutility::string_view str,
+                              std::size_t pos) noexcept
+      -> parsed_names<Count> {
+    return append(name_splitter<half>::split(str, pos), str);
+  }
+
+private:
+  static constexpr auto append(const parsed_names<half> &left,
+                               mgutility::string_view str) noexcept
+      -> parsed_names<Count> {
+    return join_names(left, name_splitter<Count - half>::split(str, left.next),
+                      make_probe_sequence<half>{},
+                      make_probe_sequence<Count - half>{});
+  }
+};
+
+/**
+ * @brief Specialization of name_splitter for a single token.
  */
-template <typename U, int Min, int Max> struct enum_name_parse_result {
-  static constexpr auto size = std::size_t{Max - Min};
-  fixed_string<MGUTILITY_GLOBAL_ENUM_BLOB_SIZE> strings;
-  std::array<pair<std::size_t, std::size_t>, size> ranges;
+template <> struct name_splitter<1> {
+  static constexpr auto split(mgutility::string_view str,
+                              std::size_t pos) noexcept -> parsed_names<1> {
+    return token(str, pos, find_char(str, ',', pos));
+  }
+
+private:
+  static constexpr auto token(mgutility::string_view str, std::size_t pos,
+                              std::size_t sep) noexcept -> parsed_names<1> {
+    return parsed_names<1>{{token_name(str, pos, sep)},
+                           sep < str.size() ? sep + 1 : sep};
+  }
 };
 
-template <typename T, int Min, int Max>
-using enum_name_array =
-    std::array<mgutility::string_view, static_cast<std::size_t>(Max - Min)>;
+/**
+ * @brief Specialization of name_splitter for no token.
+ */
+template <> struct name_splitter<0> {
+  static constexpr auto split(mgutility::string_view /*unused*/,
+                              std::size_t pos) noexcept -> parsed_names<0> {
+    return parsed_names<0>{{}, pos};
+  }
+};
+#endif
 
 /**
  * @brief Provides functionality to extract and parse enum names at
@@ -124,10 +339,10 @@ private:
    * @return The raw string_view from __PRETTY_FUNCTION__.
    */
   template <typename Enum, Enum... e>
-  MGUTILITY_CNSTXPR static auto
+  constexpr static auto
   raw_name(detail::enum_sequence<Enum, e...> /*unused*/) noexcept
       -> mgutility::string_view {
-#if defined(__GNUC__) && !defined(__clang__) && MGUTILITY_CPLUSPLUS >= 201402L
+#if defined(__GNUC__) && !defined(__clang__)
 #define PREFIX                                                                 \
   MGUTILITY_STRLEN("static constexpr mgutility::string_view "                  \
                    "mgutility::detail::enum_type::raw_name(mgutility::detail:" \
@@ -158,20 +373,22 @@ private:
   }
 
   /**
-   * @brief Parses the enum name from the raw string based on compiler.
+   * @brief Parses the names of probed values from the raw string based on
+   * compiler.
+   *
+   * The probe must end with one extra value so that every parsed value is
+   * followed by a separator. The parsed names are views into the raw string;
+   * nothing is copied.
    *
-   * @param str The raw string from __PRETTY_FUNCTION__.
-   * @return The parsed enum name.
+   * @tparam Count The number of probed values to parse.
+   * @param str The raw string of the probe.
+   * @param result The array of names, indexed by slot.
+   * @param first The slot of the first probed value in the array.
    */
-  template <typename Enum, int Min, int Max>
-  MGUTILITY_CNSTXPR static auto parse() noexcept
-      -> enum_name_parse_result<detail::underlying_type_t<Enum>, Min, Max> {
-    using U = detail::underlying_type_t<Enum>;
-    using result_type = enum_name_parse_result<U, Min, Max>;
-
-    MGUTILITY_CNSTXPR auto str =
-        raw_name<Enum>(detail::make_enum_sequence<Enum, Min, Max>{});
-
+  template <std::size_t Count, typename Names>
+  MGUTILITY_CNSTXPR static void parse_names(mgutility::string_view str,
+                                            Names &result,
+                                            std::size_t first) noexcept {
 #if defined(__clang__) || defined(__GNUC__)
 #if defined(__clang__)
     auto end = str.rfind(']');
@@ -185,7 +402,7 @@ private:
     // MSVC: different format
     auto pos = str.find(',');
     if (pos == mgutility::string_view::npos)
-      return {};
+      return;
 
     ++pos;
 
@@ -193,222 +410,2497 @@ private:
     auto enum_names = str.substr(pos, end - pos);
 
 #else
-    return {};
+    return;
 #endif
 
-    if (enum_names.empty()) {
-      return {};
-    }
-
-    result_type result{};
-
+    // One pass over the characters: a ',' ends a token, a '(' or ')' marks a
+    // value without a name (printed as a cast), and only the part after the
+    // last scope qualifier is kept.
+    const auto *const chars = enum_names.data();
+    const auto size = enum_names.size();
+    std::size_t begin = 0;
     std::size_t idx = 0;
-
-    while (!enum_names.empty() && idx < result.ranges.size()) {
-      auto pos = enum_names.find(',');
-      if (pos != mgutility::string_view::npos) {
-        auto token = enum_names.substr(0, pos);
-
-        // remove whitespace
-        while (!token.empty() && token.front() == ' ') {
-          token = token.substr(1);
-        }
-
-        while (!token.empty() && token.back() == ' ') {
-          token = token.substr(0, token.size() - 1);
+    auto unnamed = false;
+
+    for (std::size_t pos = 0; pos < size; ++pos) {
+      switch (chars[pos]) {
+      case ':':
+        begin = pos + 1;
+        break;
+      case '(':
+      case ')':
+        unnamed = true;
+        break;
+      case ',': {
+        if (!unnamed) {
+          auto last = pos;
+          // remove whitespace
+          while (begin < last && chars[begin] == ' ') {
+            ++begin;
+          }
+          while (last > begin && chars[last - 1] == ' ') {
+            --last;
+          }
+          result[first + idx] =
+              mgutility::string_view(chars + begin, last - begin);
         }
-
-        std::size_t begin = token.find('(');
-        std::size_t end = token.rfind(')');
-        if (begin != mgutility::string_view::npos ||
-            end != mgutility::string_view::npos) {
-          result.ranges[idx++] = {0, 0};
-          enum_names = enum_names.substr(pos + 1);
-          continue;
+        if (++idx == Count) {
+          return;
         }
+        begin = pos + 1;
+        unnamed = false;
+        break;
+      }
+      default:
+        break;
+      }
+    }
+  }
 
-        std::size_t start = 0;
-        if (token.find(':') != mgutility::string_view::npos) {
-          start = token.find(':') + 2;
-          token = token.substr(start);
-        }
+#if MGUTILITY_CPLUSPLUS <= 201402L
+  /**
+   * @brief Gets the part of a probe signature that holds the probed values,
+   * the way parse_names() cuts it.
+   *
+   * @param str The raw string of the probe.
+   * @return The probed values, separated by ','.
+   */
+  static constexpr auto probe_body(mgutility::string_view str) noexcept
+      -> mgutility::string_view {
+#if defined(__clang__)
+    return str.substr(0, find_last_char(str, ']', str.size()));
+#elif defined(__GNUC__)
+    return str.substr(0, find_last_char(str, ';', str.size()));
+#elif defined(_MSC_VER)
+    return find_char(str, ',', 0) == str.size()
+               ? mgutility::string_view{}
+               : str.substr(find_char(str, ',', 0) + 1,
+                            find_last_char(str, '>', str.size()) -
+                                find_char(str, ',', 0) - 1);
+#else
+    return mgutility::string_view{};
+#endif
+  }
+#endif
 
-        // Write into the fixed-size global buffer
-        auto offset = result.strings.size();
-        result.strings.append(token);
-        result.ranges[idx++] = {offset, token.size()};
+  /**
+   * @brief Parses the names of one chunk of the range.
+   *
+   * The chunk is probed with one value past its end so that every value of
+   * the chunk is followed by a separator.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @param result The array of names, indexed by slot.
+   * @param first The slot of Lo in the array.
+   */
+  template <typename Enum, int Lo, std::size_t Count, typename Names>
+  MGUTILITY_CNSTXPR static void parse_chunk(Names &result,
+                                            std::size_t first) noexcept {
+    parse_names<Count>(
+        raw_name<Enum>(
+            detail::make_enum_sequence<Enum, Lo,
+                                       Lo + static_cast<int>(Count)>{}),
+        result, first);
+  }
 
-        enum_names = enum_names.substr(pos + 1);
-        continue;
-      }
-      enum_names = {};
+  /**
+   * @brief Loads the names of one chunk of the range into an array.
+   *
+   * From C++17 on the chunk is parsed in a constant evaluation of its own
+   * (see enum_name_chunk) and only its stored names are copied here, so the
+   * evaluation of a whole range never walks the probe signatures.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @param result The array of names, indexed by slot.
+   * @param first The slot of Lo in the array.
+   */
+  template <typename Enum, int Lo, std::size_t Count, typename Names>
+  MGUTILITY_CNSTXPR static void load_chunk(Names &result,
+                                           std::size_t first) noexcept {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    for (std::size_t idx = 0; idx < Count; ++idx) {
+      result[first + idx] = enum_name_chunk<Enum, Lo, Count>::names[idx];
     }
+#else
+    parse_chunk<Enum, Lo, Count>(result, first);
+#endif
+  }
+
+  /**
+   * @brief Parses every chunk of the range into one array.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Min The minimum enum value.
+   * @tparam Slots The number of slots in the range.
+   * @tparam Chunk The chunk numbers.
+   * @param result The array of names, indexed by slot.
+   */
+  template <typename Enum, int Min, std::size_t Slots, typename Names,
+            std::size_t... Chunk>
+  MGUTILITY_CNSTXPR static void
+  parse_chunks(Names &result, index_sequence<Chunk...> /*unused*/) noexcept {
+    constexpr auto chunk = static_cast<std::size_t>(MGUTILITY_ENUM_PROBE_CHUNK);
+    // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+    const int expand[] = {
+        0, (load_chunk<Enum, Min + static_cast<int>(Chunk * chunk),
+                       (Slots - Chunk * chunk < chunk ? Slots - Chunk * chunk
+                                                      : chunk)>(
+                result, Chunk * chunk),
+            0)...};
+    static_cast<void>(expand);
+  }
 
+  /**
+   * @brief Parses the enum names of a range chunk by chunk.
+   *
+   * Each chunk of MGUTILITY_ENUM_PROBE_CHUNK values gets its own probe
+   * function, so the length of a single signature and the work of parsing it
+   * stay bounded however wide the range is; only the merge grows with the
+   * range.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Min The minimum enum value.
+   * @tparam Max The maximum enum value.
+   * @return The parsed enum names, indexed by slot.
+   */
+  template <typename Enum, int Min, int Max>
+  MGUTILITY_CNSTXPR static auto parse() noexcept
+      -> enum_name_array<Enum, Min, Max> {
+    static_assert(MGUTILITY_ENUM_PROBE_CHUNK > 0,
+                  "MGUTILITY_ENUM_PROBE_CHUNK must be positive!");
+    constexpr auto slots = static_cast<std::size_t>(Max - Min);
+    constexpr auto chunk = static_cast<std::size_t>(MGUTILITY_ENUM_PROBE_CHUNK);
+
+    enum_name_array<Enum, Min, Max> result{};
+    parse_chunks<Enum, Min, slots>(
+        result, make_probe_sequence<(slots + chunk - 1) / chunk>{});
     return result;
   }
 
 public:
   /**
-   * @brief Gets the name of the enum value, checking custom names first.
+   * @brief Gets the reflected names of the enum values in a range.
    *
    * @tparam Enum The enum type.
-   * @tparam e The enum value.
-   * @return The name of the enum value.
+   * @tparam Min The minimum enum value.
+   * @tparam Max The maximum enum value.
+   * @return The reflected names, indexed by slot.
    */
   template <typename Enum, int Min, int Max>
   MGUTILITY_CNSTXPR static auto name() noexcept
-      -> enum_name_parse_result<detail::underlying_type_t<Enum>, Min, Max> {
+      -> enum_name_array<Enum, Min, Max> {
     return parse<Enum, Min, Max>();
   }
+
+  /**
+   * @brief Gets the reflected names of one chunk of a range.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @return The reflected names, indexed from Lo, as views into the probe
+   * signature.
+   */
+  template <typename Enum, int Lo, std::size_t Count>
+  MGUTILITY_CNSTXPR static auto chunk() noexcept
+      -> std::array<mgutility::string_view, Count> {
+    std::array<mgutility::string_view, Count> result{};
+    parse_chunk<Enum, Lo, Count>(result, 0);
+    return result;
+  }
+
+  /**
+   * @brief Gets the reflected names of 0 and of each single bit of a flag
+   * enum.
+   *
+   * @tparam Enum The enum type.
+   * @return The reflected names: slot 0 holds the name of 0 and slot n + 1
+   * the name of bit n.
+   */
+  template <typename Enum>
+  MGUTILITY_CNSTXPR static auto flags() noexcept -> enum_flag_array<Enum> {
+    enum_flag_array<Enum> result{};
+    parse_names<flag_bits<Enum>() + 1>(
+        raw_name<Enum>(detail::make_flag_sequence<Enum>{}), result, 0);
+    return result;
+  }
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+  /**
+   * @brief Gets the reflected names of one chunk of a range in a constant
+   * expression.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @return The names of the chunk.
+   */
+  template <typename Enum, int Lo, std::size_t Count>
+  static constexpr auto constant_chunk() noexcept -> parsed_names<Count> {
+    return name_splitter<Count>::split(
+        probe_body(raw_name<Enum>(
+            detail::make_enum_sequence<Enum, Lo,
+                                       Lo + static_cast<int>(Count)>{})),
+        0);
+  }
+
+  /**
+   * @brief Gets the reflected names of 0 and of each single bit of a flag
+   * enum in a constant expression.
+   *
+   * @tparam Enum The enum type.
+   * @return The reflected names: slot 0 holds the name of 0 and slot n + 1
+   * the name of bit n.
+   */
+  template <typename Enum>
+  static constexpr auto constant_flags() noexcept
+      -> parsed_names<flag_bits<Enum>() + 1> {
+    return name_splitter<flag_bits<Enum>() + 1>::split(
+        probe_body(raw_name<Enum>(detail::make_flag_sequence<Enum>{})), 0);
+  }
+#endif
 };
 
 /**
- * @brief Caches an array of enum names for a given enum sequence.
+ * @brief Total length and count of a set of enum names.
+ */
+struct enum_name_stats {
+  std::size_t size;  /**< Sum of the name lengths. */
+  std::size_t count; /**< Number of non-empty names. */
+};
+
+/**
+ * @brief Measures the names that a name table will have to store.
  *
- * @tparam Enum The enum type.
- * @tparam Seq The enum sequence.
+ * @param names The array of names, indexed by slot.
+ * @return The total length and the count of the names.
  */
-template <typename Enum, int Min, int Max> struct enum_array_cache;
+template <typename Names>
+MGUTILITY_CNSTXPR auto measure_names(const Names &names) noexcept
+    -> enum_name_stats {
+  enum_name_stats stats{0, 0};
+  for (std::size_t slot = 0; slot < names.size(); ++slot) {
+    stats.size += names[slot].size();
+    stats.count += names[slot].empty() ? 0 : 1;
+  }
+  return stats;
+}
 
 /**
- * @brief Specialization of enum_array_cache for enum_sequence.
+ * @brief Enum names stored back-to-back in a blob sized exactly to them.
  *
- * @tparam Enum The enum type.
- * @tparam Is The enum values.
+ * Names are kept in slot order, so one offset per slot is enough: the name of
+ * a slot spans from its offset to the offset of the next slot, and empty
+ * slots have a zero-length span. Offsets use the smallest unsigned type that
+ * can address the blob, so a lookup touches one small offset array and the
+ * blob.
+ *
+ * @tparam Size The total length of the names.
+ * @tparam Slots The number of slots in the reflected range.
  */
-template <typename Enum, int Min, int Max> struct enum_array_cache {
-  using underlying = detail::underlying_type_t<Enum>;
-  using parse_result_t = enum_name_parse_result<underlying, Min, Max>;
+template <std::size_t Size, std::size_t Slots> struct enum_name_table {
+  using offset_type = uint_fit_t<Size>;
 
-#if MGUTILITY_CPLUSPLUS > 201402L
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  char strings[Size == 0 ? 1 : Size];
+  std::array<offset_type, Slots + 1> offsets;
 
-  static constexpr auto parse_result =
-      enum_type::template name<Enum, Min, Max>();
+  /**
+   * @brief Gets the name stored for a slot.
+   *
+   * @param slot The slot within the reflected range.
+   * @return The name, or an empty view if the slot has none.
+   */
+  constexpr auto operator[](std::size_t slot) const noexcept
+      -> mgutility::string_view {
+    return mgutility::string_view(
+        strings + offsets[slot],
+        static_cast<std::size_t>(offsets[slot + 1] - offsets[slot]));
+  }
 
-#else
-  // C++11: lazy runtime array
-  static parse_result_t &value() {
-    static parse_result_t arr = enum_type::template name<Enum, Min, Max>();
+  /**
+   * @brief Gets the number of slots.
+   *
+   * @return The number of slots in the reflected range.
+   */
+  static constexpr auto size() noexcept -> std::size_t { return Slots; }
 
-    return arr;
+  /**
+   * @brief Gets the number of bytes the stored names occupy.
+   *
+   * @return The sum of the stored name lengths.
+   */
+  constexpr auto stored_size() const noexcept -> std::size_t {
+    return offsets[Slots];
   }
-#endif
-
-  static MGUTILITY_CNSTXPR auto
-  apply_custom(const parse_result_t &result) noexcept
-      -> enum_name_array<Enum, Min, Max> {
-    enum_name_array<Enum, Min, Max> arr{};
+};
 
-    for (std::size_t idx = 0; idx < result.ranges.size(); ++idx) {
-      arr[idx] = result.strings.view().substr(result.ranges[idx].first,
-                                              result.ranges[idx].second);
+/**
+ * @brief Copies names into an exactly sized name table.
+ *
+ * A name that does not fit is dropped rather than truncated, which makes
+ * stored_size() fall short of the measured size.
+ *
+ * @tparam Size The blob size, as measured by measure_names().
+ * @tparam Slots The number of slots in the reflected range.
+ * @param names The array of names, indexed by slot.
+ * @return The name table.
+ */
+template <std::size_t Size, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_name_table(const Names &names) noexcept
+    -> enum_name_table<Size, Slots> {
+  using offset_type = typename enum_name_table<Size, Slots>::offset_type;
+  enum_name_table<Size, Slots> table{};
+  std::size_t cursor = 0;
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    const auto name = names[slot];
+    table.offsets[slot] = static_cast<offset_type>(cursor);
+    if (cursor + name.size() > Size) {
+      continue;
     }
-
-#if MGUTILITY_CPLUSPLUS >= 201402L
-    constexpr auto map = mgutility::custom_enum<Enum>::map;
-    for (const auto &pair : map) {
-#else
-    for (const auto &pair : mgutility::custom_enum<Enum>::map) {
-#endif
-      if (pair.first >= static_cast<Enum>(Min) &&
-          pair.first < static_cast<Enum>(Max)) {
-        arr[static_cast<std::size_t>(pair.first) - Min] = pair.second;
-      }
+    for (std::size_t i = 0; i < name.size(); ++i) {
+      table.strings[cursor + i] = name[i];
     }
-
-    return arr;
+    cursor += name.size();
   }
-};
+  table.offsets[Slots] = static_cast<offset_type>(cursor);
+  return table;
+}
 
+#if MGUTILITY_CPLUSPLUS > 201402L
 /**
- * @brief Gets an array of enum names for the enum type within the specified
- * range.
+ * @brief The names of one probe chunk, copied out of its probe signature.
+ *
+ * Every chunk is measured and stored in its own constant evaluations, which
+ * keeps the constexpr operation count of each evaluation bounded by the chunk
+ * size. The tables only exist at compile time.
  *
  * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @return An array of string_views containing the enum names.
+ * @tparam Lo The first enum value of the chunk.
+ * @tparam Count The number of enum values in the chunk.
  */
-template <typename Enum, int Min = mgutility::enum_range<Enum>::min,
-          int Max = mgutility::enum_range<Enum>::max>
-MGUTILITY_CNSTXPR auto get_enum_array() noexcept
-    -> enum_name_array<Enum, Min, Max> {
-#if MGUTILITY_CPLUSPLUS > 201402L
-  constexpr auto &cache = enum_array_cache<Enum, Min, Max>::parse_result;
-  return enum_array_cache<Enum, Min, Max>::apply_custom(cache);
+template <typename Enum, int Lo, std::size_t Count> struct enum_name_chunk {
+  static constexpr auto stats =
+      measure_names(enum_type::template chunk<Enum, Lo, Count>());
+
+  static constexpr auto names = make_name_table<stats.size, Count>(
+      enum_type::template chunk<Enum, Lo, Count>());
+};
 #else
-  return enum_array_cache<Enum, Min, Max>::apply_custom(
-      enum_array_cache<Enum, Min, Max>::value());
-#endif
-}
+/**
+ * @brief The names of one probe chunk, as views into its probe signature.
+ *
+ * Every chunk is parsed in a constant evaluation of its own, which keeps the
+ * constexpr operation count of each evaluation bounded by the chunk size.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Lo The first enum value of the chunk.
+ * @tparam Count The number of enum values in the chunk.
+ */
+template <typename Enum, int Lo, std::size_t Count> struct enum_name_chunk {
+  static constexpr parsed_names<Count> names =
+      enum_type::template constant_chunk<Enum, Lo, Count>();
+};
+
+template <typename Enum, int Lo, std::size_t Count>
+constexpr parsed_names<Count> enum_name_chunk<Enum, Lo, Count>::names;
 
 /**
- * @brief Converts a string to an enum value.
+ * @brief The reflected names of 0 and of each single bit of a flag enum, as
+ * views into their probe signature.
  *
  * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @param str The string view representing the enum name.
- * @return An optional enum value.
  */
-template <typename Enum, int Min, int Max>
-MGUTILITY_CNSTXPR inline auto to_enum_impl(mgutility::string_view str) noexcept
-    -> mgutility::optional<Enum> {
-  MGUTILITY_CNSTXPR_CLANG_WA auto arr = get_enum_array<Enum, Min, Max>();
+template <typename Enum> struct enum_flag_chunk {
+  static constexpr parsed_names<flag_bits<Enum>() + 1> names =
+      enum_type::template constant_flags<Enum>();
+};
 
-  const auto index{detail::find(arr, str)};
-  return index == 0 ? mgutility::nullopt
-                    : mgutility::optional<Enum>{static_cast<Enum>(index + Min)};
-}
+template <typename Enum>
+constexpr parsed_names<flag_bits<Enum>() + 1> enum_flag_chunk<Enum>::names;
 
 /**
- * @brief Converts a string to an enum bitmask value.
+ * @brief Points at the name tables of the chunks of a range, so that the
+ * name of any slot can be read in a constant expression without copying the
+ * chunks into one table first.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Slots The number of slots in the range.
+ * @tparam Seq The chunk numbers.
+ */
+template <typename Enum, int Min, std::size_t Slots,
+          typename Seq = make_probe_sequence<
+              (Slots + MGUTILITY_ENUM_PROBE_CHUNK - 1) /
+              MGUTILITY_ENUM_PROBE_CHUNK>>
+struct enum_chunk_index;
+
+/**
+ * @brief Specialization of enum_chunk_index for the chunk numbers.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Slots The number of slots in the range.
+ * @tparam Chunk The chunk numbers.
+ */
+template <typename Enum, int Min, std::size_t Slots, std::size_t... Chunk>
+struct enum_chunk_index<Enum, Min, Slots, index_sequence<Chunk...>> {
+  static constexpr auto chunk =
+      static_cast<std::size_t>(MGUTILITY_ENUM_PROBE_CHUNK);
+
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  static constexpr const mgutility::string_view
+      *chunks[sizeof...(Chunk) == 0 ? 1 : sizeof...(Chunk)] = {
+          enum_name_chunk<Enum, Min + static_cast<int>(Chunk * chunk),
+                          (Slots - Chunk * chunk < chunk ? Slots - Chunk * chunk
+                                                         : chunk)>::names
+              .items...};
+
+  /**
+   * @brief Gets the reflected name of a slot.
+   *
+   * @param slot The slot.
+   * @return The name, as a view into the probe signature of its chunk.
+   */
+  static constexpr auto name(std::size_t slot) noexcept
+      -> mgutility::string_view {
+    return chunks[slot / chunk][slot % chunk];
+  }
+};
+
+template <typename Enum, int Min, std::size_t Slots, std::size_t... Chunk>
+// NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+constexpr const mgutility::string_view
+    *enum_chunk_index<Enum, Min, Slots, index_sequence<Chunk...>>::chunks
+        [sizeof...(Chunk) == 0 ? 1 : sizeof...(Chunk)];
+#endif
+
+/**
+ * @brief Gets the bits of an enum value, without sign extension.
+ *
+ * @tparam Enum The enum type.
+ * @param value The enum value.
+ * @return The bits of the value.
+ */
+template <typename Enum>
+constexpr auto flag_value(Enum value) noexcept -> std::uint64_t {
+  return static_cast<std::uint64_t>(static_cast<flag_type_t<Enum>>(value));
+}
+
+/**
+ * @brief Gets the enum value of a set of bits.
+ *
+ * @tparam Enum The enum type.
+ * @param bits The bits of the value.
+ * @return The enum value.
+ */
+template <typename Enum>
+constexpr auto flag_enum(std::uint64_t bits) noexcept -> Enum {
+  return static_cast<Enum>(static_cast<underlying_type_t<Enum>>(
+      static_cast<flag_type_t<Enum>>(bits)));
+}
+
+/**
+ * @brief Gets the slot of a flag value in a flag name table.
+ *
+ * @param bits The bits of the value.
+ * @return 0 for no bits, n + 1 for the single bit n, otherwise npos.
+ */
+constexpr auto flag_slot(std::uint64_t bits) noexcept -> std::size_t {
+  return bits == 0                   ? 0
+         : (bits & (bits - 1)) == 0 ? count_trailing_zeros(bits) + 1
+                                    : static_cast<std::size_t>(-1);
+}
+
+/**
+ * @brief A composite mask of a bitmask enum and its name.
+ */
+struct enum_mask {
+  std::uint64_t mask;          /**< The bits of the composite value. */
+  mgutility::string_view name; /**< The name of the composite value. */
+};
+
+/**
+ * @brief Precomputed masks used to format the values of a bitmask enum.
+ *
+ * Every bit of the underlying type maps to the slot of its name, so the set
+ * bits of a value are resolved one by one with count-trailing-zeros. Named
+ * values with several bits set are kept apart, ordered by popcount from the
+ * widest down, to be matched greedily before the single bits.
+ *
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Composites The capacity of the composite list.
+ */
+template <std::size_t Bits, std::size_t Slots, std::size_t Composites>
+struct enum_mask_list {
+  using slot_type = uint_fit_t<Slots>;
+
+  constant_array<slot_type, Bits> bit_slots{}; /**< Slots if unnamed. */
+  constant_array<enum_mask, Composites> composites{}; /**< Widest first. */
+  std::size_t composite_count{}; /**< Number of composites in the list. */
+
+  /**
+   * @brief Adds a named value to the list.
+   *
+   * A single bit keeps the first slot it is given; a composite is inserted
+   * after the composites with at least as many bits.
+   *
+   * @param bits The bits of the value.
+   * @param name The name of the value.
+   * @param slot The slot of the name in the name table.
+   */
+  MGUTILITY_CNSTXPR void add(std::uint64_t bits, mgutility::string_view name,
+                             std::size_t slot) noexcept {
+    if (bits == 0 || name.empty()) {
+      return;
+    }
+    if ((bits & (bits - 1)) == 0) {
+      auto &bit_slot = bit_slots[count_trailing_zeros(bits)];
+      if (bit_slot == static_cast<slot_type>(Slots)) {
+        bit_slot = static_cast<slot_type>(slot);
+      }
+      return;
+    }
+    if (composite_count == Composites) {
+      return;
+    }
+    auto pos = composite_count++;
+    for (; pos > 0 && count_bits(composites[pos - 1].mask) < count_bits(bits);
+         --pos) {
+      composites[pos] = composites[pos - 1];
+    }
+    composites[pos] = enum_mask{bits, name};
+  }
+};
+
+/**
+ * @brief Creates an empty mask list, with every bit unnamed.
+ *
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Composites The capacity of the composite list.
+ * @return The mask list.
+ */
+template <std::size_t Bits, std::size_t Slots, std::size_t Composites>
+MGUTILITY_CNSTXPR auto make_mask_list() noexcept
+    -> enum_mask_list<Bits, Slots, Composites> {
+  using list_type = enum_mask_list<Bits, Slots, Composites>;
+  list_type list{};
+  for (std::size_t bit = 0; bit < Bits; ++bit) {
+    list.bit_slots[bit] = static_cast<typename list_type::slot_type>(Slots);
+  }
+  return list;
+}
+
+/**
+ * @brief Counts the named values of a range with several bits set.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @param names The name table, indexed by slot.
+ * @return The number of composite values.
+ */
+template <typename Enum, int Min, typename Names>
+MGUTILITY_CNSTXPR auto count_range_composites(const Names &names) noexcept
+    -> std::size_t {
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < names.size(); ++slot) {
+    count += !names[slot].empty() &&
+                     count_bits(flag_value(static_cast<Enum>(
+                         Min + static_cast<int>(slot)))) > 1
+                 ? 1
+                 : 0;
+  }
+  return count;
+}
+
+/**
+ * @brief Builds the mask list of a bitmask enum reflected over a range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Composites The capacity of the composite list.
+ * @param names The name table, indexed by slot.
+ * @return The mask list.
+ */
+template <typename Enum, int Min, std::size_t Slots, std::size_t Composites,
+          typename Names>
+MGUTILITY_CNSTXPR auto make_range_masks(const Names &names) noexcept
+    -> enum_mask_list<flag_bits<Enum>(), Slots, Composites> {
+  auto list = make_mask_list<flag_bits<Enum>(), Slots, Composites>();
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    list.add(flag_value(static_cast<Enum>(Min + static_cast<int>(slot))),
+             names[slot], slot);
+  }
+  return list;
+}
+
+/**
+ * @brief Gets the number of entries in the custom names map of an enum.
+ *
+ * @tparam Enum The enum type.
+ * @return The number of custom names.
+ */
+template <typename Enum>
+constexpr auto custom_map_size() noexcept -> std::size_t {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+  return mgutility::custom_enum<Enum>::map.size();
+#else
+  return sizeof(mgutility::custom_enum<Enum>::map) /
+         sizeof(mgutility::custom_enum<Enum>::map[0]);
+#endif
+}
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+/**
+ * @brief Gets an entry of the custom names map of an enum.
+ *
+ * @tparam Enum The enum type.
+ * @param idx The index of the entry.
+ * @return The entry.
+ */
+template <typename Enum>
+constexpr auto custom_map_entry(std::size_t idx) noexcept
+    -> const mgutility::pair<Enum, const char *> & {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+  return mgutility::custom_enum<Enum>::map.begin()[idx];
+#else
+  return mgutility::custom_enum<Enum>::map[idx];
+#endif
+}
+
+/**
+ * @brief Resolves the name of a range slot against the custom names map.
+ *
+ * The map is searched from its last entry, so that a later entry wins as it
+ * does in enum_array_cache::apply_custom().
+ *
+ * @tparam Enum The enum type.
+ * @param value The value of the slot.
+ * @param name The reflected name of the slot.
+ * @param count The number of map entries left to search.
+ * @return The custom name of the value if it has one, otherwise name.
+ */
+template <typename Enum>
+constexpr auto custom_range_name(Enum value, mgutility::string_view name,
+                                 std::size_t count) noexcept
+    -> mgutility::string_view {
+  return count == 0 ? name
+         : custom_map_entry<Enum>(count - 1).first == value
+             ? mgutility::string_view(custom_map_entry<Enum>(count - 1).second)
+             : custom_range_name(value, name, count - 1);
+}
+
+/**
+ * @brief Resolves the name of a flag slot against the custom names map.
+ *
+ * @tparam Enum The enum type.
+ * @param slot The flag slot.
+ * @param name The reflected name of the slot.
+ * @param count The number of map entries left to search.
+ * @return The custom name of the slot if it has one, otherwise name.
+ */
+template <typename Enum>
+constexpr auto custom_flag_name(std::size_t slot, mgutility::string_view name,
+                                std::size_t count) noexcept
+    -> mgutility::string_view {
+  return count == 0 ? name
+         : flag_slot(flag_value(custom_map_entry<Enum>(count - 1).first)) ==
+                 slot
+             ? mgutility::string_view(custom_map_entry<Enum>(count - 1).second)
+             : custom_flag_name<Enum>(slot, name, count - 1);
+}
+
+/**
+ * @brief Builds the name table of a range in a constant expression, custom
+ * names applied.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam I The slots.
+ * @return The resolved name table.
+ */
+template <typename Enum, int Min, int Max, std::size_t... I>
+constexpr auto make_constant_names(index_sequence<I...> /*unused*/) noexcept
+    -> enum_name_array<Enum, Min, Max> {
+  return enum_name_array<Enum, Min, Max>{{custom_range_name(
+      static_cast<Enum>(Min + static_cast<int>(I)),
+      enum_chunk_index<Enum, Min, sizeof...(I)>::name(I),
+      custom_map_size<Enum>())...}};
+}
+
+/**
+ * @brief Builds the flag name table of a flag enum in a constant expression,
+ * custom names applied.
+ *
+ * @tparam Enum The enum type.
+ * @tparam I The flag slots.
+ * @param names The reflected names, indexed by flag slot.
+ * @return The resolved flag name table.
+ */
+template <typename Enum, std::size_t... I>
+constexpr auto make_constant_flags(const parsed_names<sizeof...(I)> &names,
+                                   index_sequence<I...> /*unused*/) noexcept
+    -> enum_flag_array<Enum> {
+  return enum_flag_array<Enum>{{custom_flag_name<Enum>(
+      I, names.items[I], custom_map_size<Enum>())...}};
+}
+#endif
+
+/**
+ * @brief Builds the mask list of a flag enum.
+ *
+ * Bit n is named by slot n + 1 of the flag name table; composites come from
+ * the custom names map, which is the only source of names with several bits
+ * set.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Slots The number of slots of the flag name table.
+ * @param names The flag name table, indexed by flag slot.
+ * @return The mask list.
+ */
+template <typename Enum, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_flag_masks(const Names &names) noexcept
+    -> enum_mask_list<flag_bits<Enum>(), Slots, custom_map_size<Enum>()> {
+  auto list =
+      make_mask_list<flag_bits<Enum>(), Slots, custom_map_size<Enum>()>();
+  for (std::size_t slot = 1; slot < Slots; ++slot) {
+    list.add(std::uint64_t{1} << (slot - 1), names[slot], slot);
+  }
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+  constexpr auto map = mgutility::custom_enum<Enum>::map;
+  for (const auto &pair : map) {
+#else
+  for (const auto &pair : mgutility::custom_enum<Enum>::map) {
+#endif
+    const auto bits = flag_value(pair.first);
+    if (count_bits(bits) > 1) {
+      list.add(bits, pair.second, Slots);
+    }
+  }
+  return list;
+}
+
+#if MGUTILITY_CPLUSPLUS < 201402L
+/**
+ * @brief The mask list of a bitmask enum as a constant aggregate (C++11).
+ *
+ * Same layout as enum_mask_list, without its default member initializers, so
+ * that it can be brace-initialized from packs in a constant expression.
+ *
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Composites The number of composites.
+ */
+template <std::size_t Bits, std::size_t Slots, std::size_t Composites>
+struct constant_mask_list {
+  using slot_type = uint_fit_t<Slots>;
+
+  std::array<slot_type, Bits> bit_slots;     /**< Slots if the bit is unnamed. */
+  std::array<enum_mask, Composites> composites; /**< Widest first. */
+  std::size_t composite_count; /**< Number of composites in the list. */
+};
+
+/**
+ * @brief The named values of a range, as a source of masks (C++11).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Slots The number of slots in the range.
+ */
+template <typename Enum, int Min, std::size_t Slots> struct range_mask_source {
+  static constexpr auto size = Slots;
+
+  static constexpr auto bits(std::size_t slot) noexcept -> std::uint64_t {
+    return flag_value(static_cast<Enum>(Min + static_cast<int>(slot)));
+  }
+
+  static constexpr auto name(std::size_t slot) noexcept
+      -> mgutility::string_view {
+    return custom_range_name(static_cast<Enum>(Min + static_cast<int>(slot)),
+                             enum_chunk_index<Enum, Min, Slots>::name(slot),
+                             custom_map_size<Enum>());
+  }
+
+  /**
+   * @brief Gets the popcount of a named composite, 0 for any other slot.
+   */
+  static constexpr auto width(std::size_t slot) noexcept -> std::size_t {
+    return count_bits(bits(slot)) > 1 && !name(slot).empty()
+               ? count_bits(bits(slot))
+               : 0;
+  }
+
+  static constexpr auto item(std::size_t slot) noexcept -> enum_mask {
+    return enum_mask{bits(slot), name(slot)};
+  }
+
+  static constexpr auto named_slot(long long slot) noexcept -> std::size_t {
+    return slot >= 0 && slot < static_cast<long long>(Slots) &&
+                   !name(static_cast<std::size_t>(slot)).empty()
+               ? static_cast<std::size_t>(slot)
+               : Slots;
+  }
+
+  /**
+   * @brief Gets the slot that names a single bit, Slots if it is unnamed.
+   */
+  static constexpr auto bit_slot(std::size_t bit) noexcept -> std::size_t {
+    return named_slot(static_cast<long long>(static_cast<underlying_type_t<Enum>>(
+                          flag_enum<Enum>(std::uint64_t{1} << bit))) -
+                      Min);
+  }
+};
+
+/**
+ * @brief The named values of a flag enum, as a source of masks (C++11).
+ *
+ * Single bits are named by the flag slots, composites by the custom names
+ * map.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct flag_mask_source {
+  static constexpr auto size = custom_map_size<Enum>();
+
+  static constexpr auto bits(std::size_t idx) noexcept -> std::uint64_t {
+    return flag_value(custom_map_entry<Enum>(idx).first);
+  }
+
+  static constexpr auto name(std::size_t idx) noexcept
+      -> mgutility::string_view {
+    return mgutility::string_view(custom_map_entry<Enum>(idx).second);
+  }
+
+  static constexpr auto width(std::size_t idx) noexcept -> std::size_t {
+    return count_bits(bits(idx)) > 1 && !name(idx).empty()
+               ? count_bits(bits(idx))
+               : 0;
+  }
+
+  static constexpr auto item(std::size_t idx) noexcept -> enum_mask {
+    return enum_mask{bits(idx), name(idx)};
+  }
+
+  static constexpr auto bit_slot(std::size_t bit) noexcept -> std::size_t {
+    return custom_flag_name<Enum>(bit + 1,
+                                  enum_flag_chunk<Enum>::names.items[bit + 1],
+                                  custom_map_size<Enum>())
+                   .empty()
+               ? flag_bits<Enum>() + 1
+               : bit + 1;
+  }
+};
+
+/**
+ * @brief Counts and selects the composites of a mask source by width in a
+ * constant expression (C++11).
+ *
+ * C++11 constexpr functions cannot loop, so ranges are halved instead, which
+ * keeps the recursion depth logarithmic in the size of the source.
+ *
+ * @tparam Source The mask source.
+ */
+template <typename Source> struct composite_search {
+  /**
+   * @brief Counts the composites of a width in [first, last).
+   */
+  static constexpr auto count(std::size_t width, std::size_t first,
+                              std::size_t last) noexcept -> std::size_t {
+    return last - first == 0 ? 0
+           : last - first == 1
+               ? (Source::width(first) == width ? 1 : 0)
+               : count(width, first, first + (last - first) / 2) +
+                     count(width, first + (last - first) / 2, last);
+  }
+
+  /**
+   * @brief Finds the nth composite of a width in [first, last).
+   */
+  static constexpr auto select(std::size_t width, std::size_t nth,
+                               std::size_t first, std::size_t last) noexcept
+      -> std::size_t {
+    return last - first == 1
+               ? first
+               : select_half(width, nth, first, first + (last - first) / 2,
+                             last,
+                             count(width, first, first + (last - first) / 2));
+  }
+
+  static constexpr auto select_half(std::size_t width, std::size_t nth,
+                                    std::size_t first, std::size_t mid,
+                                    std::size_t last, std::size_t left) noexcept
+      -> std::size_t {
+    return nth < left ? select(width, nth, first, mid)
+                      : select(width, nth - left, mid, last);
+  }
+};
+
+/**
+ * @brief The number of composites of each width of a mask source (C++11).
+ *
+ * @tparam Source The mask source.
+ * @tparam Seq The widths, 0 to 64.
+ */
+template <typename Source, typename Seq = make_probe_sequence<65>>
+struct composite_widths;
+
+/**
+ * @brief Specialization of composite_widths for the widths.
+ *
+ * @tparam Source The mask source.
+ * @tparam Width The widths.
+ */
+template <typename Source, std::size_t... Width>
+struct composite_widths<Source, index_sequence<Width...>> {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  static constexpr std::size_t counts[sizeof...(Width)] = {
+      (Width < 2 ? 0
+                 : composite_search<Source>::count(Width, 0, Source::size))...};
+
+  /**
+   * @brief Counts the composites no wider than a width.
+   */
+  static constexpr auto total(std::size_t width) noexcept -> std::size_t {
+    return width < 2 ? 0 : counts[width] + total(width - 1);
+  }
+
+  /**
+   * @brief Gets the nth composite, widest first and in source order within
+   * a width, counting from the given width down.
+   */
+  static constexpr auto nth(std::size_t idx, std::size_t width) noexcept
+      -> enum_mask {
+    return idx < counts[width]
+               ? Source::item(composite_search<Source>::select(
+                     width, idx, 0, Source::size))
+               : nth(idx - counts[width], width - 1);
+  }
+};
+
+template <typename Source, std::size_t... Width>
+// NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+constexpr std::size_t
+    composite_widths<Source, index_sequence<Width...>>::counts
+        [sizeof...(Width)];
+
+/**
+ * @brief Builds the mask list of a mask source in a constant expression
+ * (C++11), in the order enum_mask_list::add() gives.
+ *
+ * @tparam Source The mask source.
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam BitSeq The bits.
+ * @tparam CompositeSeq The composite positions.
+ */
+template <typename Source, std::size_t Bits, std::size_t Slots,
+          typename BitSeq = make_probe_sequence<Bits>,
+          typename CompositeSeq =
+              make_probe_sequence<composite_widths<Source>::total(64)>>
+struct constant_masks;
+
+/**
+ * @brief Specialization of constant_masks for the bits and composite
+ * positions.
+ *
+ * @tparam Source The mask source.
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Bit The bits.
+ * @tparam Composite The composite positions.
+ */
+template <typename Source, std::size_t Bits, std::size_t Slots,
+          std::size_t... Bit, std::size_t... Composite>
+struct constant_masks<Source, Bits, Slots, index_sequence<Bit...>,
+                      index_sequence<Composite...>> {
+  using list_type = constant_mask_list<Bits, Slots, sizeof...(Composite)>;
+
+  static constexpr list_type list{
+      {{static_cast<typename list_type::slot_type>(
+          Source::bit_slot(Bit))...}},
+      {{composite_widths<Source>::nth(Composite, 64)...}},
+      sizeof...(Composite)};
+};
+
+template <typename Source, std::size_t Bits, std::size_t Slots,
+          std::size_t... Bit, std::size_t... Composite>
+constexpr typename constant_masks<Source, Bits, Slots, index_sequence<Bit...>,
+                                  index_sequence<Composite...>>::list_type
+    constant_masks<Source, Bits, Slots, index_sequence<Bit...>,
+                   index_sequence<Composite...>>::list;
+#endif
+
+/**
+ * @brief The named values of an enum, in ascending order.
+ *
+ * @tparam T The stored item, a slot of a range or the bits of a flag value.
+ * @tparam N The capacity of the list.
+ */
+template <typename T, std::size_t N> struct enum_value_list {
+  static constexpr auto capacity = N;
+
+  std::size_t size{};       /**< Number of values in the list. */
+  constant_array<T, N> items{}; /**< The values, ascending. */
+
+  /**
+   * @brief Adds a value to the list, after the values not greater than it.
+   *
+   * @param item The value.
+   */
+  MGUTILITY_CNSTXPR void insert(T item) noexcept {
+    if (size == N) {
+      return;
+    }
+    auto pos = size++;
+    for (; pos > 0 && items[pos - 1] > item; --pos) {
+      items[pos] = items[pos - 1];
+    }
+    items[pos] = item;
+  }
+};
+
+/**
+ * @brief Lists the named slots of a range, in slot order.
+ *
+ * @tparam N The capacity of the list, at least the number of names.
+ * @tparam Slots The number of slots in the reflected range.
+ * @param names The name table, indexed by slot.
+ * @return The list of named slots.
+ */
+template <std::size_t N, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_slot_list(const Names &names) noexcept
+    -> enum_value_list<uint_fit_t<Slots>, N> {
+  enum_value_list<uint_fit_t<Slots>, N> list{};
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    if (!names[slot].empty()) {
+      list.insert(static_cast<uint_fit_t<Slots>>(slot));
+    }
+  }
+  return list;
+}
+
+/**
+ * @brief Lists the named values of a flag enum, ascending by their bits.
+ *
+ * Covers 0 and the single bits named in the flag name table, and the
+ * composites of the mask list.
+ *
+ * @tparam N The capacity of the list, at least the number of names.
+ * @param names The flag name table, indexed by flag slot.
+ * @param masks The mask list of the flag enum.
+ * @return The list of named values.
+ */
+template <std::size_t N, typename Names, typename Masks>
+MGUTILITY_CNSTXPR auto make_flag_value_list(const Names &names,
+                                            const Masks &masks) noexcept
+    -> enum_value_list<std::uint64_t, N> {
+  enum_value_list<std::uint64_t, N> list{};
+  for (std::size_t slot = 0; slot < names.size(); ++slot) {
+    if (!names[slot].empty()) {
+      list.insert(slot == 0 ? 0 : std::uint64_t{1} << (slot - 1));
+    }
+  }
+  for (std::size_t idx = 0; idx < masks.composite_count; ++idx) {
+    list.insert(masks.composites[idx].mask);
+  }
+  return list;
+}
+
+/**
+ * @brief Counts, for every slot of a range, the named slots before it.
+ *
+ * Slot s is named when entries s and s + 1 differ, so the table answers
+ * both the ordinal of a value and its neighbours in O(1).
+ *
+ * @tparam N The number of names in the range.
+ * @tparam Slots The number of slots in the reflected range.
+ * @param names The name table, indexed by slot.
+ * @return The rank table, with one more entry than there are slots.
+ */
+template <std::size_t N, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_rank_table(const Names &names) noexcept
+    -> constant_array<uint_fit_t<N>, Slots + 1> {
+  constant_array<uint_fit_t<N>, Slots + 1> ranks{};
+  std::size_t rank = 0;
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    ranks[slot] = static_cast<uint_fit_t<N>>(rank);
+    rank += !names[slot].empty() && rank < N ? 1 : 0;
+  }
+  ranks[Slots] = static_cast<uint_fit_t<N>>(rank);
+  return ranks;
+}
+
+/**
+ * @brief Appends the hexadecimal form of a value, with a 0x prefix.
+ *
+ * @param str The string to append to.
+ * @param value The value.
+ */
+template <typename String>
+MGUTILITY_CNSTXPR void append_hex(String &str, std::uint64_t value) noexcept {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  char digits[18]{'0', 'x'};
+  std::size_t nibbles = 1;
+  while (nibbles < 16 && (value >> (4U * nibbles)) != 0) {
+    ++nibbles;
+  }
+  for (std::size_t idx = 0; idx < nibbles; ++idx) {
+    digits[2 + idx] =
+        "0123456789abcdef"[(value >> (4U * (nibbles - 1 - idx))) & 0xFU];
+  }
+  str.append(mgutility::string_view(digits, 2 + nibbles));
+}
+
+/**
+ * @brief Writes names into a caller provided buffer.
+ *
+ * Every name is copied with one memcpy, cut at the end of the buffer, and
+ * every byte is counted, so `size` ends up as the number of bytes the whole
+ * text needs.
+ */
+struct buffer_sink {
+  char *out;        /**< The buffer. */
+  std::size_t cap;  /**< The capacity of the buffer. */
+  std::size_t size; /**< The number of bytes appended so far. */
+
+  /**
+   * @brief Appends a string, as much of it as fits.
+   *
+   * @param str The string.
+   * @return This sink.
+   */
+  auto append(mgutility::string_view str) noexcept -> buffer_sink & {
+    if (size < cap) {
+      const auto len = (std::min)(str.size(), cap - size);
+      std::memcpy(out + size, str.data(), len);
+    }
+    size += str.size();
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes names through an output iterator.
+ *
+ * @tparam OutputIt The output iterator type.
+ */
+template <typename OutputIt> struct iterator_sink {
+  OutputIt out; /**< The position to write the next character to. */
+
+  /**
+   * @brief Appends a string.
+   *
+   * @param str The string.
+   * @return This sink.
+   */
+  MGUTILITY_CNSTXPR auto append(mgutility::string_view str)
+      -> iterator_sink & {
+    out = std::copy(str.data(), str.data() + str.size(), out);
+    return *this;
+  }
+};
+
+/**
+ * @brief Appends names to a std::string.
+ */
+struct string_sink {
+  std::string &str; /**< The string to append to. */
+
+  /**
+   * @brief Appends a string.
+   *
+   * @param name The string.
+   * @return This sink.
+   */
+  auto append(mgutility::string_view name) -> string_sink & {
+    str.append(name.data(), name.size());
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes names into a fixed_string, cut at its capacity.
+ *
+ * fixed_string::append does not check the room left, so every string is cut
+ * to it first: a text longer than the buffer keeps its leading bytes, as
+ * enum_name_to does with a char buffer.
+ *
+ * @tparam N The capacity of the fixed_string, its terminator included.
+ */
+template <std::size_t N> struct fixed_string_sink {
+  static_assert(N > 0, "The name buffer needs room for its terminator!");
+
+  mgutility::fixed_string<N> &str; /**< The string to append to. */
+
+  /**
+   * @brief Appends a string, as much of it as fits.
+   *
+   * @param name The string.
+   * @return This sink.
+   */
+  MGUTILITY_CNSTXPR auto append(mgutility::string_view name) noexcept
+      -> fixed_string_sink & {
+    const auto room = N - 1 - str.size();
+    str.append(mgutility::string_view(
+        name.data(), name.size() < room ? name.size() : room));
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes a bitmask value from its precomputed masks.
+ *
+ * Composites are matched greedily from the widest down, then the remaining
+ * set bits are walked with count-trailing-zeros. Bits without a name are
+ * appended as one hexadecimal suffix, so a value without any named bit is
+ * written as its hexadecimal form alone and no set bit is lost.
+ *
+ * @tparam Sink A type with an append(string_view) member, such as one of
+ * the sinks above.
+ * @param bits The bits of the value.
+ * @param names The name table the masks refer to.
+ * @param masks The mask list of the enum.
+ * @param sink The sink the names, joined with '|', are appended to.
+ */
+template <typename Names, typename Masks, typename Sink>
+MGUTILITY_CNSTXPR void write_bitmask(std::uint64_t bits, const Names &names,
+                                     const Masks &masks, Sink &sink) {
+  auto named = false;
+
+  for (std::size_t idx = 0; idx < masks.composite_count; ++idx) {
+    const auto &composite = masks.composites[idx];
+    if ((bits & composite.mask) == composite.mask) {
+      if (named) {
+        sink.append("|");
+      }
+      sink.append(composite.name);
+      named = true;
+      bits &= ~composite.mask;
+    }
+  }
+
+  std::uint64_t unknown = 0;
+  for (; bits != 0; bits &= bits - 1) {
+    const auto slot =
+        static_cast<std::size_t>(masks.bit_slots[count_trailing_zeros(bits)]);
+    if (slot < names.size()) {
+      if (named) {
+        sink.append("|");
+      }
+      sink.append(names[slot]);
+      named = true;
+    } else {
+      unknown |= bits & (~bits + 1);
+    }
+  }
+
+  if (unknown != 0) {
+    if (named) {
+      sink.append("|");
+    }
+    append_hex(sink, unknown);
+  }
+}
+
+/**
+ * @brief Caches an array of enum names for a given enum sequence.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Seq The enum sequence.
+ */
+template <typename Enum, int Min, int Max> struct enum_array_cache;
+
+/**
+ * @brief Specialization of enum_array_cache for enum_sequence.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Is The enum values.
+ */
+template <typename Enum, int Min, int Max> struct enum_array_cache {
+  static constexpr auto slots = static_cast<std::size_t>(Max - Min);
+
+  static MGUTILITY_CNSTXPR auto
+  apply_custom(enum_name_array<Enum, Min, Max> arr) noexcept
+      -> enum_name_array<Enum, Min, Max> {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+    constexpr auto map = mgutility::custom_enum<Enum>::map;
+    for (const auto &pair : map) {
+#else
+    for (const auto &pair : mgutility::custom_enum<Enum>::map) {
+#endif
+      if (pair.first >= static_cast<Enum>(Min) &&
+          pair.first < static_cast<Enum>(Max)) {
+        arr[static_cast<std::size_t>(pair.first) - Min] = pair.second;
+      }
+    }
+
+    return arr;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+
+  /**
+   * @brief Total length and count of the resolved names (first pass).
+   */
+  static constexpr auto stats =
+      measure_names(apply_custom(enum_type::template name<Enum, Min, Max>()));
+
+  /**
+   * @brief The resolved name table, custom names applied, indexed by slot
+   * (second pass, sized by the first one).
+   */
+  using table_type = enum_name_table<stats.size, slots>;
+
+  static constexpr auto names = make_name_table<stats.size, slots>(
+      apply_custom(enum_type::template name<Enum, Min, Max>()));
+
+  static_assert(names.stored_size() == stats.size,
+                "Enum names do not fit the name table!");
+
+  static constexpr auto name_count = stats.count;
+
+  static constexpr auto name_index =
+      make_name_hash_index<name_count, slots>(names);
+
+  static_assert(name_index.collision_free,
+                "Enum name hash index is not collision-free!");
+
+  static constexpr auto composite_count =
+      count_range_composites<Enum, Min>(names);
+
+  static constexpr auto masks =
+      make_range_masks<Enum, Min, slots, composite_count>(names);
+
+  using values_type = enum_value_list<uint_fit_t<slots>, name_count>;
+
+  static constexpr auto values = make_slot_list<name_count, slots>(names);
+
+  static constexpr auto ranks = make_rank_table<name_count, slots>(names);
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  using padded_hasher = padded_name_hasher<MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  static constexpr auto padded_index =
+      make_name_hash_index<name_count, slots, padded_hasher>(
+          padded_names_view<MGUTILITY_ENUM_NAME_PADDED_SLOTS, table_type>{
+              names});
+
+  static_assert(padded_index.collision_free,
+                "Padded enum name hash index is not collision-free!");
+
+  static constexpr auto padded_names =
+      make_padded_name_table(padded_index, names);
+#endif
+
+#else
+  using table_type = enum_name_array<Enum, Min, Max>;
+
+  // C++11: constant table of views into the probe signatures, custom names
+  // applied, so nothing is parsed at runtime
+  static constexpr table_type name_table =
+      make_constant_names<Enum, Min, Max>(make_probe_sequence<slots>{});
+
+  static constexpr auto names() noexcept -> const table_type & {
+    return name_table;
+  }
+
+#if MGUTILITY_CPLUSPLUS >= 201402L
+  // C++14: the other tables are constants too, sized by the names like the
+  // C++17 ones
+  static constexpr std::size_t name_count = measure_names(name_table).count;
+
+  using index_type = enum_name_hash_index<name_count, slots>;
+
+  static constexpr index_type index_table =
+      make_name_hash_index<name_count, slots>(name_table);
+
+  static_assert(index_table.collision_free,
+                "Enum name hash index is not collision-free!");
+
+  static constexpr auto name_index() noexcept -> const index_type & {
+    return index_table;
+  }
+
+  static constexpr std::size_t composite_count =
+      count_range_composites<Enum, Min>(name_table);
+
+  using masks_type = enum_mask_list<flag_bits<Enum>(), slots, composite_count>;
+
+  static constexpr masks_type mask_table =
+      make_range_masks<Enum, Min, slots, composite_count>(name_table);
+
+  static constexpr auto masks() noexcept -> const masks_type & {
+    return mask_table;
+  }
+
+  using values_type = enum_value_list<uint_fit_t<slots>, name_count>;
+
+  static constexpr values_type value_table =
+      make_slot_list<name_count, slots>(name_table);
+
+  static constexpr auto values() noexcept -> const values_type & {
+    return value_table;
+  }
+
+  using ranks_type = constant_array<uint_fit_t<name_count>, slots + 1>;
+
+  static constexpr ranks_type rank_table =
+      make_rank_table<name_count, slots>(name_table);
+
+  static constexpr auto ranks() noexcept -> const ranks_type & {
+    return rank_table;
+  }
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  using padded_hasher = padded_name_hasher<MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  using padded_index_type =
+      enum_name_hash_index<name_count, slots, padded_hasher>;
+
+  static constexpr padded_index_type padded_index_table =
+      make_name_hash_index<name_count, slots, padded_hasher>(
+          padded_names_view<MGUTILITY_ENUM_NAME_PADDED_SLOTS, table_type>{
+              name_table});
+
+  static_assert(padded_index_table.collision_free,
+                "Padded enum name hash index is not collision-free!");
+
+  static constexpr auto padded_index() noexcept -> const padded_index_type & {
+    return padded_index_table;
+  }
+
+  using padded_table_type =
+      padded_name_table<name_count, MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  static constexpr padded_table_type padded_table =
+      make_padded_name_table(padded_index_table, name_table);
+
+  static constexpr auto padded_names() noexcept -> const padded_table_type & {
+    return padded_table;
+  }
+#endif
+#else
+  // C++11: constant mask list, so enum_name of a bitmask value builds nothing
+  // at runtime
+  static constexpr auto masks() noexcept -> const typename constant_masks<
+      range_mask_source<Enum, Min, slots>, flag_bits<Enum>(), slots>::list_type & {
+    return constant_masks<range_mask_source<Enum, Min, slots>,
+                          flag_bits<Enum>(), slots>::list;
+  }
+
+  // C++11: lazy runtime index, sized for the whole range
+  static auto name_index() -> const enum_name_hash_index<slots, slots> & {
+    static const auto index = make_name_hash_index<slots, slots>(names());
+
+    return index;
+  }
+
+  using values_type = enum_value_list<uint_fit_t<slots>, slots>;
+
+  // C++11: lazy runtime list of the named slots
+  static auto values() -> const values_type & {
+    static const auto list = make_slot_list<slots, slots>(names());
+
+    return list;
+  }
+
+  // C++11: lazy runtime rank table, one entry per slot and one past the end
+  static auto ranks() -> const constant_array<uint_fit_t<slots>, slots + 1> & {
+    static const auto table = make_rank_table<slots, slots>(names());
+
+    return table;
+  }
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  using padded_hasher = padded_name_hasher<MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  // C++11: lazy runtime index over the names that fit a padded slot
+  static auto padded_index()
+      -> const enum_name_hash_index<slots, slots, padded_hasher> & {
+    static const auto index = make_name_hash_index<slots, slots, padded_hasher>(
+        padded_names_view<MGUTILITY_ENUM_NAME_PADDED_SLOTS, table_type>{
+            names()});
+
+    return index;
+  }
+
+  // C++11: lazy runtime padded names, one per position of padded_index()
+  static auto padded_names()
+      -> const padded_name_table<slots, MGUTILITY_ENUM_NAME_PADDED_SLOTS> & {
+    static const auto table = make_padded_name_table(padded_index(), names());
+
+    return table;
+  }
+#endif
+#endif
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::table_type
+    enum_array_cache<Enum, Min, Max>::name_table;
+#endif
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Enum, int Min, int Max>
+constexpr std::size_t enum_array_cache<Enum, Min, Max>::name_count;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::index_type
+    enum_array_cache<Enum, Min, Max>::index_table;
+
+template <typename Enum, int Min, int Max>
+constexpr std::size_t enum_array_cache<Enum, Min, Max>::composite_count;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::masks_type
+    enum_array_cache<Enum, Min, Max>::mask_table;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::values_type
+    enum_array_cache<Enum, Min, Max>::value_table;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::ranks_type
+    enum_array_cache<Enum, Min, Max>::rank_table;
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::padded_index_type
+    enum_array_cache<Enum, Min, Max>::padded_index_table;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::padded_table_type
+    enum_array_cache<Enum, Min, Max>::padded_table;
+#endif
+#endif
+
+/**
+ * @brief Gets the resolved array of enum names for the enum type within the
+ * specified range.
+ *
+ * The array is built once per enum and range; callers get a reference to it.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @return A reference to the name table, indexable by slot like an array of
+ * string_views.
+ */
+template <typename Enum, int Min = mgutility::enum_range<Enum>::min,
+          int Max = mgutility::enum_range<Enum>::max>
+constexpr auto get_enum_array() noexcept
+    -> const typename enum_array_cache<Enum, Min, Max>::table_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_array_cache<Enum, Min, Max>::names;
+#else
+  return enum_array_cache<Enum, Min, Max>::names();
+#endif
+}
+
+/**
+ * @brief Caches the names of 0 and of each single bit of a flag enum.
+ *
+ * Only 0 and the bits of the underlying type are probed, so a flag enum
+ * costs at most 65 probes whatever its widest flag is, and enum_range is not
+ * used.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_flag_cache {
+  static constexpr auto slots = flag_bits<Enum>() + 1;
+
+  static MGUTILITY_CNSTXPR auto
+  apply_custom(enum_flag_array<Enum> arr) noexcept -> enum_flag_array<Enum> {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+    constexpr auto map = mgutility::custom_enum<Enum>::map;
+    for (const auto &pair : map) {
+#else
+    for (const auto &pair : mgutility::custom_enum<Enum>::map) {
+#endif
+      const auto slot = flag_slot(flag_value(pair.first));
+      if (slot < slots) {
+        arr[slot] = pair.second;
+      }
+    }
+
+    return arr;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+
+  /**
+   * @brief Total length and count of the resolved names (first pass).
+   */
+  static constexpr auto stats =
+      measure_names(apply_custom(enum_type::template flags<Enum>()));
+
+  /**
+   * @brief The resolved name table, custom names applied, indexed by flag
+   * slot (second pass, sized by the first one).
+   */
+  using table_type = enum_name_table<stats.size, slots>;
+
+  static constexpr auto names = make_name_table<stats.size, slots>(
+      apply_custom(enum_type::template flags<Enum>()));
+
+  static_assert(names.stored_size() == stats.size,
+                "Enum flag names do not fit the name table!");
+
+  static constexpr auto name_count = stats.count;
+
+  static constexpr auto name_index =
+      make_name_hash_index<name_count, slots>(names);
+
+  static_assert(name_index.collision_free,
+                "Enum flag name hash index is not collision-free!");
+
+  static constexpr auto masks = make_flag_masks<Enum, slots>(names);
+
+  using values_type =
+      enum_value_list<std::uint64_t, name_count + masks.composite_count>;
+
+  static constexpr auto values =
+      make_flag_value_list<name_count + masks.composite_count>(names, masks);
+
+#else
+  using table_type = enum_flag_array<Enum>;
+
+  // C++11: constant table of views into the probe signature, custom names
+  // applied, so nothing is parsed at runtime
+  static constexpr table_type name_table = make_constant_flags<Enum>(
+      enum_flag_chunk<Enum>::names, make_probe_sequence<slots>{});
+
+  static constexpr auto names() noexcept -> const table_type & {
+    return name_table;
+  }
+
+#if MGUTILITY_CPLUSPLUS >= 201402L
+  // C++14: the other tables are constants too, sized by the names like the
+  // C++17 ones
+  static constexpr std::size_t name_count = measure_names(name_table).count;
+
+  using index_type = enum_name_hash_index<name_count, slots>;
+
+  static constexpr index_type index_table =
+      make_name_hash_index<name_count, slots>(name_table);
+
+  static_assert(index_table.collision_free,
+                "Enum flag name hash index is not collision-free!");
+
+  static constexpr auto name_index() noexcept -> const index_type & {
+    return index_table;
+  }
+
+  using masks_type =
+      enum_mask_list<flag_bits<Enum>(), slots, custom_map_size<Enum>()>;
+
+  static constexpr masks_type mask_table =
+      make_flag_masks<Enum, slots>(name_table);
+
+  static constexpr auto masks() noexcept -> const masks_type & {
+    return mask_table;
+  }
+
+  using values_type =
+      enum_value_list<std::uint64_t, name_count + mask_table.composite_count>;
+
+  static constexpr values_type value_table =
+      make_flag_value_list<name_count + mask_table.composite_count>(
+          name_table, mask_table);
+
+  static constexpr auto values() noexcept -> const values_type & {
+    return value_table;
+  }
+#else
+  // C++11: constant mask list, so enum_name of a flag value builds nothing
+  // at runtime
+  static constexpr auto masks() noexcept -> const typename constant_masks<
+      flag_mask_source<Enum>, flag_bits<Enum>(), slots>::list_type & {
+    return constant_masks<flag_mask_source<Enum>, flag_bits<Enum>(),
+                          slots>::list;
+  }
+
+  // C++11: lazy runtime index, sized for every flag slot
+  static auto name_index() -> const enum_name_hash_index<slots, slots> & {
+    static const auto index = make_name_hash_index<slots, slots>(names());
+
+    return index;
+  }
+
+  using values_type =
+      enum_value_list<std::uint64_t, slots + custom_map_size<Enum>()>;
+
+  // C++11: lazy runtime list of the named values
+  static auto values() -> const values_type & {
+    static const auto list =
+        make_flag_value_list<slots + custom_map_size<Enum>()>(names(), masks());
+
+    return list;
+  }
+#endif
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::table_type
+    enum_flag_cache<Enum>::name_table;
+#endif
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Enum>
+constexpr std::size_t enum_flag_cache<Enum>::name_count;
+
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::index_type
+    enum_flag_cache<Enum>::index_table;
+
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::masks_type
+    enum_flag_cache<Enum>::mask_table;
+
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::values_type
+    enum_flag_cache<Enum>::value_table;
+#endif
+
+/**
+ * @brief Gets the resolved flag name table of a flag enum.
+ *
+ * @tparam Enum The enum type.
+ * @return A reference to the name table, indexable by flag slot like an
+ * array of string_views.
+ */
+template <typename Enum>
+constexpr auto get_enum_flags() noexcept
+    -> const typename enum_flag_cache<Enum>::table_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_flag_cache<Enum>::names;
+#else
+  return enum_flag_cache<Enum>::names();
+#endif
+}
+
+/**
+ * @brief Selects the name index of a name cache for a name hash.
+ *
+ * @tparam Cache The name cache, enum_array_cache or enum_flag_cache.
+ * @tparam Hasher The name hash of the index.
+ */
+template <typename Cache, typename Hasher> struct name_index_of;
+
+/**
+ * @brief The exact name index, owned by the name cache itself.
+ *
+ * @tparam Cache The name cache.
+ */
+template <typename Cache> struct name_index_of<Cache, fnv_name_hasher> {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static constexpr auto get() noexcept -> decltype((Cache::name_index)) {
+    return Cache::name_index;
+  }
+#else
+  static auto get() -> decltype(Cache::name_index()) {
+    return Cache::name_index();
+  }
+#endif
+};
+
+/**
+ * @brief The case-insensitive name index of a name cache.
+ *
+ * Kept apart from the cache, so it is only built for enums that are looked
+ * up case-insensitively. It indexes the names of the cache in place, so no
+ * folded copy of them is stored.
+ *
+ * @tparam Cache The name cache.
+ */
+template <typename Cache> struct name_index_of<Cache, folded_name_hasher> {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static constexpr auto index =
+      make_name_hash_index<Cache::name_count, Cache::slots,
+                           folded_name_hasher>(Cache::names);
+
+  static_assert(index.collision_free,
+                "Folded enum name hash index is not collision-free!");
+
+  static_assert(names_unambiguous(index, Cache::names),
+                "Enum names differ only in case, so they are ambiguous when "
+                "compared case-insensitively!");
+
+  static constexpr auto get() noexcept -> decltype((index)) { return index; }
+#elif MGUTILITY_CPLUSPLUS >= 201402L
+  using index_type = enum_name_hash_index<Cache::name_count, Cache::slots,
+                                          folded_name_hasher>;
+
+  static constexpr index_type index =
+      make_name_hash_index<Cache::name_count, Cache::slots,
+                           folded_name_hasher>(Cache::name_table);
+
+  static_assert(index.collision_free,
+                "Folded enum name hash index is not collision-free!");
+
+  static_assert(names_unambiguous(index, Cache::name_table),
+                "Enum names differ only in case, so they are ambiguous when "
+                "compared case-insensitively!");
+
+  static constexpr auto get() noexcept -> const index_type & { return index; }
+#else
+  // C++11: lazy runtime index, sized for every slot
+  static auto get() -> const
+      enum_name_hash_index<Cache::slots, Cache::slots, folded_name_hasher> & {
+    static const auto index =
+        make_name_hash_index<Cache::slots, Cache::slots, folded_name_hasher>(
+            Cache::names());
+
+    return index;
+  }
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Cache>
+constexpr typename name_index_of<Cache, folded_name_hasher>::index_type
+    name_index_of<Cache, folded_name_hasher>::index;
+#endif
+
+/**
+ * @brief Gets the list of named values of an enum reflected over a range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @return A reference to the list of named slots.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto get_enum_values() noexcept
+    -> const typename enum_array_cache<Enum, Min, Max>::values_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_array_cache<Enum, Min, Max>::values;
+#else
+  return enum_array_cache<Enum, Min, Max>::values();
+#endif
+}
+
+/**
+ * @brief Gets the list of named values of a flag enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @return A reference to the list of named values.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto get_enum_values() noexcept
+    -> const typename enum_flag_cache<Enum>::values_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_flag_cache<Enum>::values;
+#else
+  return enum_flag_cache<Enum>::values();
+#endif
+}
+
+/**
+ * @brief Selects the cache that holds the named values of an enum.
+ *
+ * Only the selected cache is instantiated, so a range enum never reflects
+ * its flags and the other way around.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ */
+template <typename Enum, int Min, int Max,
+          bool Flags = enum_flags<Enum>::value>
+struct enum_value_source {
+  using type = typename enum_array_cache<Enum, Min, Max>::values_type;
+};
+
+template <typename Enum, int Min, int Max>
+struct enum_value_source<Enum, Min, Max, true> {
+  using type = typename enum_flag_cache<Enum>::values_type;
+};
+
+/**
+ * @brief The number of named values an enum can have, known at compile
+ * time: exact in C++14 and later, the whole range in C++11.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ */
+template <typename Enum, int Min, int Max>
+constexpr auto enum_capacity() noexcept -> std::size_t {
+  return enum_value_source<Enum, Min, Max>::type::capacity;
+}
+
+/**
+ * @brief Gets the named value at a position of a range enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param idx The position, less than the number of named values.
+ * @return The enum value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto nth_enum_value(std::size_t idx) noexcept -> Enum {
+  return static_cast<Enum>(
+      static_cast<int>(get_enum_values<Enum, Min, Max>().items[idx]) + Min);
+}
+
+/**
+ * @brief Gets the named value at a position of a flag enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param idx The position, less than the number of named values.
+ * @return The enum value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto nth_enum_value(std::size_t idx) noexcept -> Enum {
+  return flag_enum<Enum>(get_enum_values<Enum, Min, Max>().items[idx]);
+}
+
+/**
+ * @brief Where a value falls among the named values of its enum.
+ */
+struct enum_rank {
+  std::size_t before; /**< Number of named values below the value. */
+  bool named;         /**< Whether the value itself is named. */
+};
+
+/**
+ * @brief Ranks a value of a range enum, in O(1) through the rank table.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param value The enum value.
+ * @return The rank of the value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto rank_enum_value(Enum value) noexcept -> enum_rank {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &ranks = enum_array_cache<Enum, Min, Max>::ranks;
+#else
+  const auto &ranks = enum_array_cache<Enum, Min, Max>::ranks();
+#endif
+  const auto raw = static_cast<int>(value);
+  if (raw < Min) {
+    return enum_rank{0, false};
+  }
+  const auto slot = static_cast<std::size_t>(static_cast<unsigned>(raw) -
+                                             static_cast<unsigned>(Min));
+  if (slot + 1 >= ranks.size()) {
+    return enum_rank{ranks[ranks.size() - 1], false};
+  }
+  return enum_rank{ranks[slot], ranks[slot + 1] != ranks[slot]};
+}
+
+/**
+ * @brief Ranks a value of a flag enum.
+ *
+ * Flag values span the whole underlying type, so the sorted value list is
+ * searched instead of indexed; it holds at most one entry per bit, 0 and
+ * the custom composites.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param value The enum value.
+ * @return The rank of the value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto rank_enum_value(Enum value) noexcept -> enum_rank {
+  const auto &values = get_enum_values<Enum, Min, Max>();
+  const auto bits = flag_value(value);
+  std::size_t first = 0;
+  std::size_t last = values.size;
+  while (first < last) {
+    const auto mid = first + (last - first) / 2;
+    if (values.items[mid] < bits) {
+      first = mid + 1;
+    } else {
+      last = mid;
+    }
+  }
+  return enum_rank{first, first < values.size && values.items[first] == bits};
+}
+
+/**
+ * @brief The named slots of a name cache in name order, for prefix lookups.
+ *
+ * Kept apart from the cache, so it is only built for enums that are looked
+ * up by prefix.
+ *
+ * @tparam Cache The name cache.
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ */
+template <typename Cache, typename Hasher> struct name_order_of {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static constexpr auto order =
+      make_name_order<Cache::name_count, Cache::slots, Hasher>(Cache::names);
+
+  static constexpr auto get() noexcept -> decltype((order)) { return order; }
+#elif MGUTILITY_CPLUSPLUS >= 201402L
+  using order_type =
+      enum_name_order<Cache::name_count, uint_fit_t<Cache::slots>>;
+
+  static constexpr order_type order =
+      make_name_order<Cache::name_count, Cache::slots, Hasher>(
+          Cache::name_table);
+
+  static constexpr auto get() noexcept -> const order_type & { return order; }
+#else
+  // C++11: lazy runtime order, sized for every slot
+  static auto get()
+      -> const enum_name_order<Cache::slots, uint_fit_t<Cache::slots>> & {
+    static const auto order =
+        make_name_order<Cache::slots, Cache::slots, Hasher>(Cache::names());
+
+    return order;
+  }
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Cache, typename Hasher>
+constexpr typename name_order_of<Cache, Hasher>::order_type
+    name_order_of<Cache, Hasher>::order;
+#endif
+
+/**
+ * @brief Finds the slot of an enum name.
+ *
+ * Uses the padded name layout at runtime when it is enabled, the name fits a
+ * padded slot and the lookup is exact, otherwise the perfect hash index of
+ * enum_array_cache for the name hash.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The name.
+ * @return The slot of the name within the range, or static_cast<size_t>(-1).
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+MGUTILITY_CNSTXPR inline auto find_enum_slot(mgutility::string_view str) noexcept
+    -> std::size_t {
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  if (std::is_same<Hasher, fnv_name_hasher>::value &&
+      !MGUTILITY_IS_CONSTANT_EVALUATED() &&
+      str.size() <= MGUTILITY_ENUM_NAME_PADDED_SLOTS) {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    return find_padded_name(enum_array_cache<Enum, Min, Max>::padded_index,
+                            enum_array_cache<Enum, Min, Max>::padded_names,
+                            str);
+#else
+    return find_padded_name(enum_array_cache<Enum, Min, Max>::padded_index(),
+                            enum_array_cache<Enum, Min, Max>::padded_names(),
+                            str);
+#endif
+  }
+#endif
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  constexpr auto &index =
+      name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#else
+  const auto &index =
+      name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#endif
+
+  return index.find(str, get_enum_array<Enum, Min, Max>());
+}
+
+/**
+ * @brief Converts a string to an enum value.
+ *
+ * Looks the name up with find_enum_slot().
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The string view representing the enum name.
+ * @return An optional enum value.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+MGUTILITY_CNSTXPR inline auto to_enum_impl(mgutility::string_view str) noexcept
+    -> mgutility::optional<Enum> {
+  const auto slot = find_enum_slot<Enum, Min, Max, Hasher>(str);
+  return slot == static_cast<std::size_t>(-1)
+             ? mgutility::nullopt
+             : mgutility::optional<Enum>{
+                   static_cast<Enum>(static_cast<int>(slot) + Min)};
+}
+
+/**
+ * @brief Converts a prefix of a name to an enum value.
+ *
+ * Two binary searches over the names in name order find the names starting
+ * with the prefix; a name equal to the prefix sorts first among them.
  *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value.
  * @tparam Max The maximum enum value.
- * @param str The string view representing the enum name.
- * @return An optional enum bitmask value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The prefix.
+ * @return The match.
  */
-template <typename Enum, int Min, int Max>
-MGUTILITY_CNSTXPR auto to_enum_bitmask_impl(mgutility::string_view str) noexcept
-    -> mgutility::optional<Enum> {
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+MGUTILITY_CNSTXPR auto to_enum_prefix_impl(mgutility::string_view str) noexcept
+    -> enum_prefix_match<Enum> {
+  if (str.empty()) {
+    return enum_prefix_match<Enum>{mgutility::nullopt, 0};
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  constexpr auto &order =
+      name_order_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#else
+  const auto &order =
+      name_order_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#endif
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto first = order.template bound<Hasher, false>(str, names);
+  const auto last = order.template bound<Hasher, true>(str, names);
+  const auto count = last - first;
+  if (count == 0) {
+    return enum_prefix_match<Enum>{mgutility::nullopt, 0};
+  }
+
+  const auto slot = static_cast<std::size_t>(order.slots[first]);
+  const auto exact = Hasher::equal(names[slot], str) &&
+                     (count == 1 || !Hasher::equal(
+                                        names[static_cast<std::size_t>(
+                                            order.slots[first + 1])],
+                                        str));
+  if (count == 1 || exact) {
+    return enum_prefix_match<Enum>{
+        mgutility::optional<Enum>{
+            static_cast<Enum>(static_cast<int>(slot) + Min)},
+        count};
+  }
+  return enum_prefix_match<Enum>{mgutility::nullopt, count};
+}
+
+/**
+ * @brief Checks whether a character is a blank that may surround names.
+ *
+ * @param chr The character.
+ * @return True for a space or a tab, otherwise false.
+ */
+constexpr auto is_blank(char chr) noexcept -> bool {
+  return chr == ' ' || chr == '\t';
+}
+
+/**
+ * @brief Removes the blanks around a string.
+ *
+ * @param str The string.
+ * @return The string without leading and trailing blanks.
+ */
+MGUTILITY_CNSTXPR inline auto trim_blanks(mgutility::string_view str) noexcept
+    -> mgutility::string_view {
+  std::size_t begin = 0;
+  auto end = str.size();
+  while (begin < end && is_blank(str[begin])) {
+    ++begin;
+  }
+  while (end > begin && is_blank(str[end - 1])) {
+    --end;
+  }
+  return str.substr(begin, end - begin);
+}
+
+/**
+ * @brief Checks whether a separator starts at a position of a string.
+ *
+ * @param str The string.
+ * @param pos The position.
+ * @param sep The separator.
+ * @return True if str continues with sep at pos, otherwise false.
+ */
+MGUTILITY_CNSTXPR inline auto at_separator(mgutility::string_view str,
+                                           std::size_t pos,
+                                           mgutility::string_view sep) noexcept
+    -> bool {
+  return sep.size() == 1 ? str[pos] == sep[0]
+                         : str.size() - pos >= sep.size() &&
+                               equal_names(str.substr(pos, sep.size()), sep);
+}
 
-  // Check if the string contains a '|' character
-  if (str.find('|') == mgutility::string_view::npos) {
-    return to_enum_impl<Enum, Min, Max>(str);
+/**
+ * @brief Scans separated names in one pass, handing each one to a visitor.
+ *
+ * Every name is hashed while it is scanned for the next separator, so its
+ * lookup costs one index probe and one compare. Blanks around names and
+ * separators are ignored, and the separator itself is matched without its
+ * surrounding blanks, so "A|B", "A | B" and, with ", ", "A,B" are all
+ * accepted. An empty name, or one the visitor rejects, fails the whole
+ * scan.
+ *
+ * @tparam Hasher The name hash the names are hashed with.
+ * @tparam Visit The visitor, called as visit(name, hash) and returning
+ * whether it accepted the name.
+ * @param str The string view representing the names.
+ * @param separator The separator between names.
+ * @param visit The visitor.
+ * @return True if every name was accepted, otherwise false.
+ */
+template <typename Hasher = fnv_name_hasher, typename Visit>
+MGUTILITY_CNSTXPR auto scan_names(mgutility::string_view str,
+                                  mgutility::string_view separator,
+                                  Visit &visit) noexcept -> bool {
+  auto sep = trim_blanks(separator);
+  if (sep.empty()) {
+    sep = mgutility::string_view("|", 1);
   }
 
-  mgutility::optional<Enum> result{mgutility::nullopt};
-  std::size_t index = 0;
+  const auto size = str.size();
+  const auto lead = sep[0];
+  std::size_t pos = 0;
 
-  for (std::size_t i = 0; i < str.size(); ++i) {
-    if (str[i] == '|') {
-      auto name = str.substr(index, i - index);
-      auto maybe_enum = to_enum_impl<Enum, Min, Max>(name);
+  while (true) {
+    while (pos < size && is_blank(str[pos])) {
+      ++pos;
+    }
 
-      if (!name.empty() && maybe_enum) {
-        result.emplace(result ? static_cast<Enum>(*result | *maybe_enum)
-                              : *maybe_enum);
+    const auto begin = pos;
+    auto hash = name_hash_seed;
+    while (pos < size) {
+      const auto chr = str[pos];
+      if (static_cast<unsigned char>(chr) <= ' ' ||
+          (chr == lead && at_separator(str, pos, sep))) {
+        break;
       }
+      hash = Hasher::step(hash, chr);
+      ++pos;
+    }
+
+    if (pos == begin || !visit(str.substr(begin, pos - begin), hash)) {
+      return false;
+    }
+
+    while (pos < size && is_blank(str[pos])) {
+      ++pos;
+    }
+
+    if (pos == size) {
+      return true;
+    }
+    if (!at_separator(str, pos, sep)) {
+      return false;
+    }
+    pos += sep.size();
+  }
+}
+
+/**
+ * @brief Collects the bits of the names scan_names() visits.
+ *
+ * @tparam Lookup The name lookup, called as lookup(name, hash, bits) and
+ * returning whether it found the name and ORed its bits into bits.
+ */
+template <typename Lookup> struct bitmask_collector {
+  const Lookup &lookup; /**< The name lookup. */
+  std::uint64_t bits;   /**< The bits collected so far. */
+
+  /**
+   * @brief Looks a name up and collects its bits.
+   *
+   * @param name The name.
+   * @param hash The name_hash() of the name.
+   * @return True if the name was found, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                    std::uint64_t hash) noexcept -> bool {
+    return lookup(name, hash, bits);
+  }
+};
+
+/**
+ * @brief Parses separated names into the bits of a bitmask value in one pass.
+ *
+ * See scan_names() for the accepted syntax.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Lookup The name lookup, called as lookup(name, hash, bits) and
+ * returning whether it found the name and ORed its bits into bits; its
+ * `hasher` type is the name hash the names are hashed with.
+ * @param str The string view representing the names.
+ * @param separator The separator between names.
+ * @param lookup The name lookup.
+ * @return An optional enum value.
+ */
+template <typename Enum, typename Lookup>
+MGUTILITY_CNSTXPR auto parse_bitmask(mgutility::string_view str,
+                                     mgutility::string_view separator,
+                                     const Lookup &lookup) noexcept
+    -> mgutility::optional<Enum> {
+  bitmask_collector<Lookup> collector{lookup, 0};
+  if (!scan_names<typename Lookup::hasher>(str, separator, collector)) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<Enum>{flag_enum<Enum>(collector.bits)};
+}
+
+/**
+ * @brief Looks up the names of a bitmask enum reflected over a range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+struct range_name_lookup {
+  using hasher = Hasher;
 
-      index = i + 1;
+  /**
+   * @brief Looks a name up and ORs the bits of its value into bits.
+   *
+   * @param name The name.
+   * @param hash The Hasher::hash() of the name.
+   * @param bits The bits parsed so far.
+   * @return True if the name was found, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                    std::uint64_t hash,
+                                    std::uint64_t &bits) const noexcept
+      -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    constexpr auto &index =
+        name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#else
+    const auto &index =
+        name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#endif
+    const auto slot =
+        index.find(name, hash, get_enum_array<Enum, Min, Max>());
+    if (slot == index.npos) {
+      return false;
     }
+    bits |= flag_value(static_cast<Enum>(static_cast<int>(slot) + Min));
+    return true;
   }
+};
 
-  auto maybe_enum = to_enum_impl<Enum, Min, Max>(str.substr(index));
-  if (result && maybe_enum) {
-    result.emplace(static_cast<Enum>(*result | *maybe_enum));
-  } else {
-    result.reset();
+/**
+ * @brief Looks up the names of a flag enum.
+ *
+ * Bit names go through the flag name index; composite custom names, which
+ * are few, are compared against the mask list only when the index misses.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ */
+template <typename Enum, typename Hasher = fnv_name_hasher>
+struct flag_name_lookup {
+  using hasher = Hasher;
+
+  /**
+   * @brief Looks a name up and ORs its bits into bits.
+   *
+   * @param name The name.
+   * @param hash The Hasher::hash() of the name.
+   * @param bits The bits parsed so far.
+   * @return True if the name was found, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                    std::uint64_t hash,
+                                    std::uint64_t &bits) const noexcept
+      -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    constexpr auto &index =
+        name_index_of<enum_flag_cache<Enum>, Hasher>::get();
+    constexpr auto &masks = enum_flag_cache<Enum>::masks;
+#else
+    const auto &index = name_index_of<enum_flag_cache<Enum>, Hasher>::get();
+    const auto &masks = enum_flag_cache<Enum>::masks();
+#endif
+    const auto slot = index.find(name, hash, get_enum_flags<Enum>());
+    if (slot != index.npos) {
+      bits |= slot == 0 ? 0 : std::uint64_t{1} << (slot - 1);
+      return true;
+    }
+    for (std::size_t idx = 0; idx < masks.composite_count; ++idx) {
+      if (Hasher::equal(masks.composites[idx].name, name)) {
+        bits |= masks.composites[idx].mask;
+        return true;
+      }
+    }
+    return false;
   }
+};
 
-  return result;
+/**
+ * @brief Converts a string to an enum bitmask value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The string view representing the enum names.
+ * @param separator The separator between names.
+ * @return An optional enum bitmask value, empty if any name is unknown.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto
+to_enum_bitmask_impl(mgutility::string_view str,
+                     mgutility::string_view separator) noexcept
+    -> mgutility::optional<Enum> {
+  return parse_bitmask<Enum>(str, separator,
+                             range_name_lookup<Enum, Min, Max, Hasher>{});
+}
+
+/**
+ * @brief Converts a string to a flag enum value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The string view representing the flag names.
+ * @param separator The separator between names.
+ * @return An optional enum value, empty if any name is unknown.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto
+to_enum_bitmask_impl(mgutility::string_view str,
+                     mgutility::string_view separator) noexcept
+    -> mgutility::optional<Enum> {
+  return parse_bitmask<Enum>(str, separator, flag_name_lookup<Enum, Hasher>{});
 }
 
 /**
  * @brief Gets the name of an enum value.
  *
+ * The name published in the overlay of the enum, if any, comes first (see
+ * enum_name_overlay).
+ *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value.
  * @tparam Max The maximum enum value.
@@ -416,12 +2908,19 @@ MGUTILITY_CNSTXPR auto to_enum_bitmask_impl(mgutility::string_view str) noexcept
  * @return A string view representing the name of the enum value.
  */
 template <typename Enum, int Min, int Max,
-          detail::enable_if_t<!detail::has_bit_or<Enum>::value, bool> = true>
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
 MGUTILITY_CNSTXPR auto enum_name_impl(Enum enumValue) noexcept
     -> mgutility::string_view {
-  MGUTILITY_CNSTXPR_CLANG_WA auto arr = get_enum_array<Enum, Min, Max>();
-  const auto index{(Min < 0 ? -Min : Min) + static_cast<int>(enumValue)};
-  if (index < Min || index > static_cast<int>(arr.size()) - 1) {
+  const auto overlay = overlay_name(enumValue);
+  if (!overlay.empty()) {
+    return overlay;
+  }
+
+  const auto &arr = get_enum_array<Enum, Min, Max>();
+  const auto index = static_cast<int>(enumValue) - Min;
+  if (index < 0 || index >= static_cast<int>(arr.size())) {
     return mgutility::string_view{};
   }
 
@@ -429,50 +2928,404 @@ MGUTILITY_CNSTXPR auto enum_name_impl(Enum enumValue) noexcept
 }
 
 /**
- * @brief Gets the name of an enum bitmask value.
+ * @brief Writes the name of an enum value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param e The enum value.
+ * @param sink The sink the name is appended to.
+ */
+template <typename Enum, int Min, int Max, typename Sink,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR void write_enum_name(Enum enumValue, Sink &sink) {
+  sink.append(enum_name_impl<Enum, Min, Max>(enumValue));
+}
+
+/**
+ * @brief Writes the name of an enum bitmask value.
+ *
+ * A value named by the overlay of the enum or with a name of its own is
+ * written as is; other values are joined from the composite and single-bit
+ * names of the mask list (see write_bitmask) instead of testing every slot of
+ * the range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param e The enum value.
+ * @param sink The sink the name is appended to.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max, typename Sink,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR void write_enum_name(Enum enumValue, Sink &sink) {
+  const auto overlay = overlay_name(enumValue);
+  if (!overlay.empty()) {
+    sink.append(overlay);
+    return;
+  }
+
+  // Get the array of enum names
+  const auto &arr = get_enum_array<Enum, Min, Max>();
+
+  // Calculate the index in the array
+  const auto index = static_cast<int>(enumValue) - Min;
+
+  if (index >= 0 && index < static_cast<int>(arr.size()) &&
+      !arr[static_cast<size_t>(index)].empty()) {
+    sink.append(arr[static_cast<size_t>(index)]);
+    return;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &masks = enum_array_cache<Enum, Min, Max>::masks;
+#else
+  const auto &masks = enum_array_cache<Enum, Min, Max>::masks();
+#endif
+
+  write_bitmask(flag_value(enumValue), arr, masks, sink);
+}
+
+/**
+ * @brief Writes the name of a flag enum value.
+ *
+ * A value named by the overlay of the enum is written as is and 0 is looked
+ * up directly; other values are joined from the composite and single-bit
+ * names of the mask list (see write_bitmask).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param e The enum value.
+ * @param sink The sink the name is appended to.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max, typename Sink,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR void write_enum_name(Enum enumValue, Sink &sink) {
+  const auto overlay = overlay_name(enumValue);
+  if (!overlay.empty()) {
+    sink.append(overlay);
+    return;
+  }
+
+  const auto &names = get_enum_flags<Enum>();
+  const auto bits = flag_value(enumValue);
+
+  if (bits == 0) {
+    sink.append(names[0]);
+    return;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &masks = enum_flag_cache<Enum>::masks;
+#else
+  const auto &masks = enum_flag_cache<Enum>::masks();
+#endif
+
+  write_bitmask(bits, names, masks, sink);
+}
+
+/**
+ * @brief Gets the name of an enum bitmask or flag enum value.
+ *
+ * The joined name is cut to enum_name_buffer<Enum>::size - 1 bytes; see
+ * fixed_string_sink.
  *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value.
  * @tparam Max The maximum enum value.
  * @param e The enum value.
- * @return A string view or string representing the name of the enum bitmask
- * value.
+ * @return A string representing the name of the enum value.
  */
 // NOLINTNEXTLINE [modernize-use-constraints]
 template <typename Enum, int Min, int Max,
-          detail::enable_if_t<detail::has_bit_or<Enum>::value, bool> = true>
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
 MGUTILITY_CNSTXPR_CLANG_WA auto enum_name_impl(Enum enumValue) noexcept
     -> mgutility::fixed_string<enum_name_buffer<Enum>::size> {
+  mgutility::fixed_string<enum_name_buffer<Enum>::size> name;
+  fixed_string_sink<enum_name_buffer<Enum>::size> sink{name};
+  write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return name;
+}
 
-  // Get the array of enum names
-  MGUTILITY_CNSTXPR_CLANG_WA auto arr = get_enum_array<Enum, Min, Max>();
+/**
+ * @brief Gets a named value of an enum and its name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param idx The position of the value among the named values.
+ * @return The enum value and its name.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto enum_value_at(std::size_t idx) noexcept
+    -> enum_pair<Enum> {
+  const auto slot =
+      static_cast<std::size_t>(get_enum_values<Enum, Min, Max>().items[idx]);
+  const auto value = static_cast<Enum>(static_cast<int>(slot) + Min);
+  const auto overlay = overlay_name(value);
+  return enum_pair<Enum>{value, overlay.empty()
+                                    ? get_enum_array<Enum, Min, Max>()[slot]
+                                    : overlay};
+}
 
-  // Calculate the index in the array
-  const auto index = (Min < 0 ? -Min : Min) + static_cast<int>(enumValue);
+/**
+ * @brief Gets a named value of a bitmask enum and its name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param idx The position of the value among the named values.
+ * @return The enum value and its name.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto enum_value_at(std::size_t idx) noexcept
+    -> enum_pair<Enum> {
+  const auto slot =
+      static_cast<std::size_t>(get_enum_values<Enum, Min, Max>().items[idx]);
+  enum_pair<Enum> pair{static_cast<Enum>(static_cast<int>(slot) + Min), {}};
+  const auto overlay = overlay_name(pair.first);
+  fixed_string_sink<enum_name_buffer<Enum>::size> sink{pair.second};
+  sink.append(overlay.empty() ? get_enum_array<Enum, Min, Max>()[slot]
+                              : overlay);
+  return pair;
+}
+
+/**
+ * @brief Gets a named value of a flag enum and its name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param idx The position of the value among the named values.
+ * @return The enum value and its name.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto enum_value_at(std::size_t idx) noexcept
+    -> enum_pair<Enum> {
+  const auto value = nth_enum_value<Enum, Min, Max>(idx);
+  enum_pair<Enum> pair{value, {}};
+  fixed_string_sink<enum_name_buffer<Enum>::size> sink{pair.second};
+  write_enum_name<Enum, Min, Max>(value, sink);
+  return pair;
+}
 
-  mgutility::fixed_string<enum_name_buffer<Enum>::size> bitmasked_name;
+/**
+ * @brief Gets the name of one value of a batch.
+ *
+ * A value outside the range reads slot 0 and gets its length cleared, so
+ * there is no data-dependent branch unless the enum has an overlay.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @param names The name table, indexed by slot.
+ * @param overlay The current overlay of the enum, or nullptr.
+ * @param value The enum value.
+ * @return The overlay name of the value if it has one, otherwise its
+ * reflected name, or an empty string_view.
+ */
+template <typename Enum, int Min, typename Names>
+auto batch_name(const Names &names, const enum_overlay<Enum> *overlay,
+                Enum value) noexcept -> mgutility::string_view {
+  if (overlay != nullptr) {
+    const auto name = overlay->find(value);
+    if (!name.empty()) {
+      return name;
+    }
+  }
+  const auto slot =
+      static_cast<std::size_t>(static_cast<unsigned>(static_cast<int>(value)) -
+                               static_cast<unsigned>(Min));
+  const auto in_range = slot < names.size();
+  const auto name = names[in_range ? slot : 0];
+  return mgutility::string_view(name.data(), in_range ? name.size() : 0);
+}
 
-  if (index >= 0 && index < static_cast<int>(arr.size())) {
-    bitmasked_name.append(arr[static_cast<size_t>(index)]);
+/**
+ * @brief Gets the names of many enum values.
+ *
+ * The name table and the overlay are fetched once for the whole batch.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param out The names, one per value.
+ */
+template <typename Enum, int Min, int Max>
+void enum_names_impl(const Enum *values, std::size_t count,
+                     mgutility::string_view *out) noexcept {
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto *overlay = current_overlay<Enum>();
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    out[idx] = batch_name<Enum, Min>(names, overlay, values[idx]);
   }
+}
 
-  if (!bitmasked_name.empty()) {
-    return bitmasked_name;
+/**
+ * @brief Converts many strings to enum values.
+ *
+ * The lookups are the ones of to_enum, without building an optional per
+ * name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param names The names.
+ * @param count The number of names.
+ * @param out The enum values, value-initialized where a name is unknown.
+ * @param found Whether each name was found, or nullptr.
+ * @return The number of names found.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+auto to_enums_impl(const mgutility::string_view *names, std::size_t count,
+                   Enum *out, bool *found) noexcept -> std::size_t {
+  std::size_t hits = 0;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    const auto slot = find_enum_slot<Enum, Min, Max>(names[idx]);
+    const auto hit = slot != static_cast<std::size_t>(-1);
+    out[idx] = hit ? static_cast<Enum>(static_cast<int>(slot) + Min) : Enum{};
+    if (found != nullptr) {
+      found[idx] = hit;
+    }
+    hits += hit ? 1 : 0;
   }
+  return hits;
+}
 
-  for (auto i = 0; i < Max - Min; ++i) {
-    if (i >= 0 && i < static_cast<int>(arr.size()) && arr[i].size() > 0 &&
-        (enumValue & static_cast<Enum>(i)) == static_cast<Enum>(i)) {
-      bitmasked_name.append(arr[i]).append("|");
+/**
+ * @brief Converts many strings to enum bitmask values.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param names The names, each one a mask as accepted by to_enum.
+ * @param count The number of names.
+ * @param out The enum values, value-initialized where a mask is invalid.
+ * @param found Whether each mask was parsed, or nullptr.
+ * @return The number of masks parsed.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+auto to_enums_impl(const mgutility::string_view *names, std::size_t count,
+                   Enum *out, bool *found) noexcept -> std::size_t {
+  const auto separator = mgutility::string_view("|", 1);
+  std::size_t hits = 0;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    auto parsed =
+        to_enum_bitmask_impl<Enum, Min, Max>(names[idx], separator);
+    out[idx] = parsed ? *parsed : Enum{};
+    if (found != nullptr) {
+      found[idx] = parsed.has_value();
     }
+    hits += parsed ? 1 : 0;
+  }
+  return hits;
+}
+
+/**
+ * @brief Appends the names of many enum values, joined by a separator.
+ *
+ * The exact output length is summed from the name lengths first, so the
+ * string grows once and every name is one memcpy into it. The overlay is
+ * fetched once, so both passes see the same names.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param separator The separator between names.
+ * @param out The string to append to.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+void join_enum_names(const Enum *values, std::size_t count,
+                     mgutility::string_view separator, std::string &out) {
+  if (count == 0) {
+    return;
   }
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto *overlay = current_overlay<Enum>();
 
-  // Remove the trailing '|' if present
-  if (!bitmasked_name.empty()) {
-    bitmasked_name.pop_back();
+  auto size = separator.size() * (count - 1);
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    size += batch_name<Enum, Min>(names, overlay, values[idx]).size();
   }
 
-  return bitmasked_name;
+  const auto begin = out.size();
+  out.resize(begin + size);
+  auto *cursor = &out[begin];
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    if (idx != 0) {
+      if (separator.size() == 1) {
+        *cursor++ = separator[0];
+      } else {
+        std::memcpy(cursor, separator.data(), separator.size());
+        cursor += separator.size();
+      }
+    }
+    const auto name = batch_name<Enum, Min>(names, overlay, values[idx]);
+    std::memcpy(cursor, name.data(), name.size());
+    cursor += name.size();
+  }
+}
+
+/**
+ * @brief Appends the names of many enum bitmask values, joined by a
+ * separator.
+ *
+ * Bitmask names are assembled from several names each, so they are appended
+ * as they are written instead of being measured first.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param separator The separator between names.
+ * @param out The string to append to.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+void join_enum_names(const Enum *values, std::size_t count,
+                     mgutility::string_view separator, std::string &out) {
+  string_sink sink{out};
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    if (idx != 0) {
+      sink.append(separator);
+    }
+    write_enum_name<Enum, Min, Max>(values[idx], sink);
+  }
 }
 } // namespace detail
 } // namespace mgutility
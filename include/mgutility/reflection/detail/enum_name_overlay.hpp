@@ -0,0 +1,385 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_OVERLAY_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_OVERLAY_HPP
+
+#include "meta.hpp"
+#include "mgutility/_common/definitions.hpp"
+#include "mgutility/std/string_view.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mgutility {
+
+/**
+ * @brief A table of display names for values of an enum, set at runtime.
+ *
+ * Build the table with set(), then hand it to publish_enum_overlay(): from
+ * then on enum_name returns the names of the table for the values it has and
+ * the reflected names for every other value. Values without a reflected
+ * name, e.g. ones added by a newer peer, can be named too. Entries are kept
+ * sorted by value, so find() is a binary search.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ */
+template <typename Enum> class enum_overlay {
+  /**
+   * @brief An entry of the table: a value and where its name is in the
+   * name buffer.
+   */
+  struct entry {
+    std::uint64_t key;  /**< The bits of the value. */
+    std::size_t offset; /**< The offset of the name in the name buffer. */
+    std::size_t size;   /**< The length of the name. */
+  };
+
+  /**
+   * @brief Gets the key of a value, without sign extension.
+   *
+   * @param value The value.
+   * @return The key.
+   */
+  static constexpr auto key_of(Enum value) noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>(
+        static_cast<detail::flag_type_t<Enum>>(value));
+  }
+
+  /**
+   * @brief Finds the first entry whose key is not less than a key.
+   *
+   * @param key The key.
+   * @return The position of the entry, or the number of entries.
+   */
+  auto lower_bound(std::uint64_t key) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(
+        std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                         [](const entry &lhs, std::uint64_t rhs) {
+                           return lhs.key < rhs;
+                         }) -
+        m_entries.begin());
+  }
+
+  /**
+   * @brief Rebuilds the name buffer from the entries, dropping the bytes of
+   * replaced and removed names.
+   */
+  void compact() {
+    std::string names;
+    names.reserve(m_names.size());
+    for (auto &item : m_entries) {
+      const auto offset = names.size();
+      names.append(m_names, item.offset, item.size);
+      item.offset = offset;
+    }
+    m_names.swap(names);
+  }
+
+public:
+  /**
+   * @brief Sets the display name of a value.
+   *
+   * A later name replaces an earlier one; an empty name removes the value,
+   * so that enum_name falls back to the reflected name. Either way the name
+   * buffer is compacted, so a table keeps only the bytes of its live names.
+   *
+   * @param value The value.
+   * @param name The display name, copied into the table.
+   * @return A reference to this table.
+   */
+  auto set(Enum value, mgutility::string_view name) -> enum_overlay & {
+    const auto key = key_of(value);
+    const auto pos = lower_bound(key);
+    const auto found = pos < m_entries.size() && m_entries[pos].key == key;
+    if (name.empty()) {
+      if (found) {
+        m_entries.erase(m_entries.begin() +
+                        static_cast<std::ptrdiff_t>(pos));
+        compact();
+      }
+      return *this;
+    }
+
+    const entry item{key, m_names.size(), name.size()};
+    m_names.append(name.data(), name.size());
+    if (found) {
+      m_entries[pos] = item;
+      compact();
+    } else {
+      m_entries.insert(m_entries.begin() + static_cast<std::ptrdiff_t>(pos),
+                       item);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Finds the display name of a value.
+   *
+   * @param value The value.
+   * @return The display name, or an empty string_view if the table has no
+   * name for the value.
+   */
+  auto find(Enum value) const noexcept -> mgutility::string_view {
+    const auto key = key_of(value);
+    const auto pos = lower_bound(key);
+    if (pos == m_entries.size() || m_entries[pos].key != key) {
+      return mgutility::string_view{};
+    }
+    return mgutility::string_view(m_names.data() + m_entries[pos].offset,
+                                  m_entries[pos].size);
+  }
+
+  /**
+   * @brief Gets the number of values the table names.
+   *
+   * @return The number of values.
+   */
+  auto size() const noexcept -> std::size_t { return m_entries.size(); }
+
+  /**
+   * @brief Checks whether the table names no value.
+   *
+   * @return True if the table is empty, otherwise false.
+   */
+  auto empty() const noexcept -> bool { return m_entries.empty(); }
+
+private:
+  std::vector<entry> m_entries; /**< The entries, sorted by key. */
+  std::string m_names;          /**< The names, back to back. */
+};
+
+namespace detail {
+
+/**
+ * @brief A published overlay and the ones it replaced.
+ *
+ * enum_name hands out views into published overlays, so a replaced overlay
+ * is not freed when it is replaced: it stays on the retired chain of the
+ * current one until reclaim_enum_overlays() or the end of the program.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_overlay_node {
+  enum_overlay<Enum> overlay; /**< The overlay. */
+  enum_overlay_node *previous; /**< The retired overlays, newest first. */
+};
+
+/**
+ * @brief Frees a chain of overlay nodes.
+ *
+ * @tparam Enum The enum type.
+ * @param node The first node of the chain, or nullptr.
+ */
+template <typename Enum> void free_overlay_chain(enum_overlay_node<Enum> *node) {
+  while (node != nullptr) {
+    auto *previous = node->previous;
+    // NOLINTNEXTLINE [cppcoreguidelines-owning-memory]
+    delete node;
+    node = previous;
+  }
+}
+
+/**
+ * @brief Gets the slot the current overlay of an enum is published in.
+ *
+ * The atomic is constant-initialized, so reading it takes no guard.
+ *
+ * @tparam Enum The enum type.
+ * @return A reference to the slot.
+ */
+template <typename Enum>
+auto enum_overlay_slot() noexcept -> std::atomic<enum_overlay_node<Enum> *> & {
+  static std::atomic<enum_overlay_node<Enum> *> slot{nullptr};
+  return slot;
+}
+
+/**
+ * @brief Gets the lock that orders the writers of the overlay of an enum.
+ *
+ * Only publish_enum_overlay() and reclaim_enum_overlays() take it; readers
+ * never do.
+ *
+ * @tparam Enum The enum type.
+ * @return A reference to the lock.
+ */
+template <typename Enum> auto enum_overlay_lock() -> std::mutex & {
+  static std::mutex lock;
+  return lock;
+}
+
+/**
+ * @brief Frees the published overlays of an enum when the program exits.
+ *
+ * Constructed by the first publication, so it is destroyed after every
+ * static object constructed later.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_overlay_reaper {
+  enum_overlay_reaper() = default;
+  enum_overlay_reaper(const enum_overlay_reaper &) = delete;
+  auto operator=(const enum_overlay_reaper &) -> enum_overlay_reaper & = delete;
+
+  ~enum_overlay_reaper() {
+    free_overlay_chain(
+        enum_overlay_slot<Enum>().exchange(nullptr, std::memory_order_acq_rel));
+  }
+};
+
+/**
+ * @brief Gets the current overlay of an enum without an overlay.
+ *
+ * @tparam Enum The enum type.
+ * @return nullptr.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<!enum_name_overlay<Enum>::value, bool> = true>
+constexpr auto current_overlay() noexcept -> const enum_overlay<Enum> * {
+  return nullptr;
+}
+
+/**
+ * @brief Gets the current overlay of an enum.
+ *
+ * One acquire load, so batch functions can fetch it once for all their
+ * values.
+ *
+ * @tparam Enum The enum type.
+ * @return The current overlay, or nullptr if none was published.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<enum_name_overlay<Enum>::value, bool> = true>
+auto current_overlay() noexcept -> const enum_overlay<Enum> * {
+  const auto *node = enum_overlay_slot<Enum>().load(std::memory_order_acquire);
+  return node == nullptr ? nullptr : &node->overlay;
+}
+
+/**
+ * @brief Gets the overlay name of a value of an enum without an overlay.
+ *
+ * @tparam Enum The enum type.
+ * @return An empty string_view.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<!enum_name_overlay<Enum>::value, bool> = true>
+constexpr auto overlay_name(Enum /*unused*/) noexcept
+    -> mgutility::string_view {
+  return mgutility::string_view{};
+}
+
+/**
+ * @brief Gets the overlay name of a value.
+ *
+ * Wait-free: one acquire load of the current overlay and a binary search in
+ * it.
+ *
+ * @tparam Enum The enum type.
+ * @param value The value.
+ * @return The name of the value in the current overlay, or an empty
+ * string_view.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<enum_name_overlay<Enum>::value, bool> = true>
+auto overlay_name(Enum value) noexcept -> mgutility::string_view {
+  const auto *overlay = current_overlay<Enum>();
+  return overlay == nullptr ? mgutility::string_view{} : overlay->find(value);
+}
+
+} // namespace detail
+
+/**
+ * @brief Publishes the display names of an enum.
+ *
+ * The overlay replaces the current one in a single atomic store; readers
+ * never wait for it, and a reader that loaded the previous overlay keeps
+ * using it safely. Replaced overlays are retired, not freed, so views
+ * returned by enum_name stay valid; each publication costs the memory of
+ * its table until reclaim_enum_overlays() is called or the program exits.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ * @param overlay The display names.
+ */
+template <typename Enum> void publish_enum_overlay(enum_overlay<Enum> overlay) {
+  static_assert(enum_name_overlay<Enum>::value,
+                "enum_name_overlay is not enabled for this enum!");
+  static detail::enum_overlay_reaper<Enum> reaper;
+  // NOLINTNEXTLINE [cppcoreguidelines-owning-memory]
+  auto *node = new detail::enum_overlay_node<Enum>{std::move(overlay), nullptr};
+  auto &slot = detail::enum_overlay_slot<Enum>();
+  const std::lock_guard<std::mutex> guard(detail::enum_overlay_lock<Enum>());
+  node->previous = slot.load(std::memory_order_relaxed);
+  slot.store(node, std::memory_order_release);
+}
+
+/**
+ * @brief Frees the overlays of an enum that were replaced by a later
+ * publication, keeping the current one.
+ *
+ * The caller must make sure that no thread is still reading a replaced
+ * overlay: no enum_name call that started before the last publication is
+ * still running, and no name it returned is still in use. Views into the
+ * current overlay stay valid.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ */
+template <typename Enum> void reclaim_enum_overlays() {
+  static_assert(enum_name_overlay<Enum>::value,
+                "enum_name_overlay is not enabled for this enum!");
+  detail::enum_overlay_node<Enum> *retired = nullptr;
+  {
+    const std::lock_guard<std::mutex> guard(detail::enum_overlay_lock<Enum>());
+    auto *current =
+        detail::enum_overlay_slot<Enum>().load(std::memory_order_relaxed);
+    if (current != nullptr) {
+      retired = current->previous;
+      current->previous = nullptr;
+    }
+  }
+  detail::free_overlay_chain(retired);
+}
+
+/**
+ * @brief Removes the display names of an enum, so that enum_name returns the
+ * reflected names again.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ */
+template <typename Enum> void clear_enum_overlay() {
+  publish_enum_overlay(enum_overlay<Enum>{});
+}
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_OVERLAY_HPP
@@ -0,0 +1,339 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PADDED_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PADDED_HPP
+
+#include "enum_name_hash.hpp"
+#include "meta.hpp"
+#include "mgutility/_common/definitions.hpp"
+#include "mgutility/std/string_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if MGUTILITY_ENUM_NAME_PADDED_SLOTS != 0 &&                                  \
+    MGUTILITY_ENUM_NAME_PADDED_SLOTS != 16 &&                                 \
+    MGUTILITY_ENUM_NAME_PADDED_SLOTS != 32
+#error "MGUTILITY_ENUM_NAME_PADDED_SLOTS must be 0, 16 or 32!"
+#endif
+
+/**
+ * @brief Detects the vector instructions the padded name layout can use.
+ *
+ * SSE2 is part of every x86-64 target, so it is picked at compile time; the
+ * 32-byte compare uses AVX2 only when the translation unit is built for it.
+ */
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MGUTILITY_ENUM_NAME_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define MGUTILITY_ENUM_NAME_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Defines MGUTILITY_ENUM_NAME_PADDED when the padded name layout is
+ * requested and usable; otherwise to_enum keeps the default layout.
+ */
+#if MGUTILITY_ENUM_NAME_PADDED_SLOTS != 0 &&                                  \
+    defined(MGUTILITY_ENUM_NAME_HAS_SSE2) &&                                   \
+    defined(MGUTILITY_IS_CONSTANT_EVALUATED)
+#define MGUTILITY_ENUM_NAME_PADDED
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#define MGUTILITY_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define MGUTILITY_NO_SANITIZE_ADDRESS
+#endif
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
+
+/**
+ * @brief Gets the multiplier of a word of a padded name.
+ *
+ * @param word The word index; 0 is used for the length.
+ * @return An odd 64-bit constant.
+ */
+constexpr auto padded_hash_key(std::size_t word) noexcept -> std::uint64_t {
+  return word == 0   ? 0x9e3779b97f4a7c15ULL
+         : word == 1 ? 0xc2b2ae3d27d4eb4fULL
+         : word == 2 ? 0x165667b19e3779f9ULL
+         : word == 3 ? 0xd6e8feb86659fd93ULL
+                     : 0xff51afd7ed558ccdULL;
+}
+
+/**
+ * @brief Hashes a name zero-padded to Width bytes, one multiply per 8-byte
+ * word.
+ *
+ * The words are multiplied independently, so the cost does not grow with
+ * the name length the way a byte-wise hash does.
+ *
+ * @tparam Width The slot width, 16 or 32.
+ */
+template <std::size_t Width> struct padded_name_hasher {
+  static constexpr std::size_t words = Width / 8;
+
+  /**
+   * @brief Hashes the little-endian words of a padded name.
+   *
+   * @param padded The words.
+   * @param size The length of the name.
+   * @return The hash value.
+   */
+  static MGUTILITY_CNSTXPR auto hash_words(const std::uint64_t *padded,
+                                           std::size_t size) noexcept
+      -> std::uint64_t {
+    std::uint64_t hash = static_cast<std::uint64_t>(size) * padded_hash_key(0);
+    for (std::size_t word = 0; word < words; ++word) {
+      hash ^= padded[word] * padded_hash_key(word + 1);
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Hashes a name of at most Width bytes.
+   *
+   * @param str The name.
+   * @return The hash value.
+   */
+  static MGUTILITY_CNSTXPR auto hash(mgutility::string_view str) noexcept
+      -> std::uint64_t {
+    std::uint64_t padded[words]{};
+    for (std::size_t idx = 0; idx < str.size() && idx < Width; ++idx) {
+      padded[idx / 8] |= static_cast<std::uint64_t>(
+                             static_cast<unsigned char>(str[idx]))
+                         << (8U * (idx % 8));
+    }
+    return hash_words(padded, str.size());
+  }
+
+  /**
+   * @brief Compares two names the way the index matches them.
+   *
+   * @param lhs The left-hand side name.
+   * @param rhs The right-hand side name.
+   * @return True if the names are equal, otherwise false.
+   */
+  static MGUTILITY_CNSTXPR auto equal(mgutility::string_view lhs,
+                                      mgutility::string_view rhs) noexcept
+      -> bool {
+    return equal_names(lhs, rhs);
+  }
+};
+
+/**
+ * @brief Shows only the names that fit into a padded slot.
+ *
+ * @tparam Width The slot width.
+ * @tparam Names The name table type.
+ */
+template <std::size_t Width, typename Names> struct padded_names_view {
+  const Names &names; /**< The name table. */
+
+  /**
+   * @brief Gets the name of a slot if it fits into a padded slot.
+   *
+   * @param slot The slot within the reflected range.
+   * @return The name, or an empty view if it is longer than Width.
+   */
+  constexpr auto operator[](std::size_t slot) const noexcept
+      -> mgutility::string_view {
+    return names[slot].size() <= Width ? names[slot]
+                                       : mgutility::string_view{};
+  }
+
+  /**
+   * @brief Gets the number of slots.
+   *
+   * @return The number of slots of the name table.
+   */
+  constexpr auto size() const noexcept -> std::size_t { return names.size(); }
+};
+
+/**
+ * @brief Names zero-padded into Width-byte slots, in the order of the
+ * positions of their hash index.
+ *
+ * @tparam N The capacity of the hash index.
+ * @tparam Width The slot width.
+ */
+template <std::size_t N, std::size_t Width> struct padded_name_table {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  alignas(Width) char bytes[N][Width];
+};
+
+/**
+ * @brief Builds the padded names for the positions of a hash index.
+ *
+ * @tparam N The capacity of the hash index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Width The slot width.
+ * @param index The hash index built over padded_names_view.
+ * @param names The name table, indexed by slot.
+ * @return The padded names.
+ */
+template <std::size_t N, std::size_t Slots, std::size_t Width, typename Names>
+MGUTILITY_CNSTXPR auto make_padded_name_table(
+    const enum_name_hash_index<N, Slots, padded_name_hasher<Width>> &index,
+    const Names &names) noexcept -> padded_name_table<N, Width> {
+  padded_name_table<N, Width> table{};
+  for (std::size_t pos = 0; pos < index.size; ++pos) {
+    const auto slot = static_cast<std::size_t>(index.slots[pos]);
+    if (slot >= Slots) {
+      continue;
+    }
+    const auto name = names[slot];
+    for (std::size_t idx = 0; idx < name.size() && idx < Width; ++idx) {
+      table.bytes[pos][idx] = name[idx];
+    }
+  }
+  return table;
+}
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+
+/**
+ * @brief Loads a name of at most Width bytes into zero-padded vectors.
+ *
+ * The name is read with full-width loads unless that would cross into the
+ * next page, in which case it is copied first; the bytes past its end are
+ * cleared either way.
+ *
+ * @tparam Width The slot width.
+ * @param str The name, not empty and at most Width bytes long.
+ * @param lanes The padded name, 16 bytes per vector.
+ * @return False if the name contains a '\0', which no enum name does.
+ */
+template <std::size_t Width>
+MGUTILITY_NO_SANITIZE_ADDRESS inline auto
+load_padded_name(mgutility::string_view str, __m128i *lanes) noexcept -> bool {
+  const auto *src = str.data();
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  alignas(16) char buffer[Width]{};
+  if ((reinterpret_cast<std::uintptr_t>(src) & 4095U) > 4096U - Width) {
+    std::memcpy(buffer, src, str.size());
+    src = buffer;
+  }
+
+  const auto limit = _mm_set1_epi8(static_cast<char>(str.size()));
+  const auto zero = _mm_setzero_si128();
+  auto offsets = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                               14, 15);
+  auto nul = 0;
+  for (std::size_t lane = 0; lane < Width / 16; ++lane) {
+    const auto live = _mm_cmplt_epi8(offsets, limit);
+    const auto bytes = _mm_and_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16 * lane)),
+        live);
+    nul |= _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(bytes, zero), live));
+    lanes[lane] = bytes;
+    offsets = _mm_add_epi8(offsets, _mm_set1_epi8(16));
+  }
+  return nul == 0;
+}
+
+/**
+ * @brief Compares a loaded name with a padded slot.
+ *
+ * @tparam Width The slot width.
+ * @param lanes The padded name.
+ * @param slot The padded slot.
+ * @return True if both hold the same bytes.
+ */
+template <std::size_t Width>
+inline auto equal_padded_name(const __m128i *lanes, const char *slot) noexcept
+    -> bool {
+#if defined(MGUTILITY_ENUM_NAME_HAS_AVX2)
+  if (Width == 32) {
+    const auto name = _mm256_set_m128i(lanes[1], lanes[0]);
+    const auto row = _mm256_load_si256(reinterpret_cast<const __m256i *>(slot));
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(name, row)) == -1;
+  }
+#endif
+  auto equal = 0xFFFF;
+  for (std::size_t lane = 0; lane < Width / 16; ++lane) {
+    const auto row =
+        _mm_load_si128(reinterpret_cast<const __m128i *>(slot + 16 * lane));
+    equal &= _mm_movemask_epi8(_mm_cmpeq_epi8(lanes[lane], row));
+  }
+  return equal == 0xFFFF;
+}
+
+/**
+ * @brief Finds the slot of a name through the padded layout.
+ *
+ * @tparam N The capacity of the hash index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Width The slot width.
+ * @param index The hash index built over padded_names_view.
+ * @param table The padded names of the index positions.
+ * @param str The name to look up, at most Width bytes long.
+ * @return The slot of the name within the reflected range, or npos.
+ */
+template <std::size_t N, std::size_t Slots, std::size_t Width>
+inline auto find_padded_name(
+    const enum_name_hash_index<N, Slots, padded_name_hasher<Width>> &index,
+    const padded_name_table<N, Width> &table,
+    mgutility::string_view str) noexcept -> std::size_t {
+  using index_type = enum_name_hash_index<N, Slots, padded_name_hasher<Width>>;
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  __m128i lanes[Width / 16];
+  if (index.size == 0 || str.empty() ||
+      !load_padded_name<Width>(str, lanes)) {
+    return index_type::npos;
+  }
+
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  alignas(16) std::uint64_t words[Width / 8];
+  for (std::size_t lane = 0; lane < Width / 16; ++lane) {
+    _mm_store_si128(reinterpret_cast<__m128i *>(words + 2 * lane),
+                    lanes[lane]);
+  }
+  const auto hash = padded_name_hasher<Width>::hash_words(words, str.size());
+
+  const auto bucket = hash_bucket(hash, index.size);
+  const auto pos =
+      reduce_range(displace(hash, index.displacements[bucket]), index.size);
+  const auto slot = static_cast<std::size_t>(index.slots[pos]);
+  return slot < Slots && equal_padded_name<Width>(lanes, table.bytes[pos])
+             ? slot
+             : index_type::npos;
+}
+
+#endif // MGUTILITY_ENUM_NAME_PADDED
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PADDED_HPP
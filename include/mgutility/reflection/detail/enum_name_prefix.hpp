@@ -0,0 +1,224 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PREFIX_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PREFIX_HPP
+
+#include "enum_name_hash.hpp"
+#include "meta.hpp"
+#include "mgutility/_common/definitions.hpp"
+#include "mgutility/std/optional.hpp"
+#include "mgutility/std/string_view.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace mgutility {
+
+/**
+ * @brief The result of to_enum_prefix.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_prefix_match {
+  /**
+   * @brief The value of the name equal to the prefix or, failing that, of the
+   * only name starting with it.
+   */
+  mgutility::optional<Enum> value;
+  std::size_t count; /**< The number of names starting with the prefix. */
+
+  /**
+   * @brief Checks whether several names start with the prefix and none of
+   * them is equal to it.
+   *
+   * @return True if the prefix is ambiguous, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto ambiguous() const noexcept -> bool {
+    return !value.has_value() && count > 1;
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Compares two names lexicographically, characters mapped by a name
+ * hash.
+ *
+ * @tparam Hasher The name hash, whose fold() maps the characters.
+ * @param lhs The left-hand side name.
+ * @param rhs The right-hand side name.
+ * @return A negative value, 0 or a positive value if lhs sorts before,
+ * with or after rhs.
+ */
+template <typename Hasher>
+MGUTILITY_CNSTXPR auto compare_names(mgutility::string_view lhs,
+                                     mgutility::string_view rhs) noexcept
+    -> int {
+  const auto size = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    const auto left = static_cast<unsigned char>(Hasher::fold(lhs[idx]));
+    const auto right = static_cast<unsigned char>(Hasher::fold(rhs[idx]));
+    if (left != right) {
+      return left < right ? -1 : 1;
+    }
+  }
+  return lhs.size() == rhs.size() ? 0 : lhs.size() < rhs.size() ? -1 : 1;
+}
+
+/**
+ * @brief The slots of the named values of an enum, sorted by name.
+ *
+ * @tparam N The capacity, at least the number of names.
+ * @tparam Slot The slot type.
+ */
+template <std::size_t N, typename Slot> struct enum_name_order {
+  std::size_t size{};          /**< The number of names. */
+  constant_array<Slot, N> slots{}; /**< The slots, in name order. */
+
+  /**
+   * @brief Finds the first position whose name, cut to the length of the
+   * prefix, sorts after the prefix or, with Upper, with or after it.
+   *
+   * @tparam Hasher The name hash the order was built with.
+   * @tparam Upper False for the first name not before the prefix, true for
+   * the first name past the names starting with it.
+   * @param prefix The prefix.
+   * @param names The name table the order was built from.
+   * @return The position.
+   */
+  template <typename Hasher, bool Upper, typename Names>
+  MGUTILITY_CNSTXPR auto bound(mgutility::string_view prefix,
+                               const Names &names) const noexcept
+      -> std::size_t {
+    std::size_t first = 0;
+    auto count = size;
+    while (count > 0) {
+      const auto half = count / 2;
+      const auto name = names[static_cast<std::size_t>(slots[first + half])];
+      const auto order = compare_names<Hasher>(
+          name.substr(0, prefix.size() < name.size() ? prefix.size()
+                                                     : name.size()),
+          prefix);
+      if (Upper ? order <= 0 : order < 0) {
+        first += half + 1;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+    return first;
+  }
+};
+
+/**
+ * @brief Checks whether a slot sorts before another one.
+ *
+ * Names equal under Hasher::fold() are ordered exactly, then by slot, so the
+ * order is total.
+ *
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param lhs The left-hand side slot.
+ * @param rhs The right-hand side slot.
+ * @param names The name table.
+ * @return True if lhs sorts before rhs, otherwise false.
+ */
+template <typename Hasher, typename Names>
+MGUTILITY_CNSTXPR auto slot_before(std::size_t lhs, std::size_t rhs,
+                                   const Names &names) noexcept -> bool {
+  const auto order = compare_names<Hasher>(names[lhs], names[rhs]);
+  if (order != 0) {
+    return order < 0;
+  }
+  const auto exact = compare_names<fnv_name_hasher>(names[lhs], names[rhs]);
+  return exact != 0 ? exact < 0 : lhs < rhs;
+}
+
+/**
+ * @brief Moves a slot down a max-heap of slots until the heap is ordered.
+ *
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param slots The slots.
+ * @param root The position of the slot.
+ * @param end The number of slots in the heap.
+ * @param names The name table.
+ */
+template <typename Hasher, typename Slots, typename Names>
+MGUTILITY_CNSTXPR void sift_slot(Slots &slots, std::size_t root,
+                                 std::size_t end, const Names &names) noexcept {
+  while (2 * root + 1 < end) {
+    auto child = 2 * root + 1;
+    if (child + 1 < end &&
+        slot_before<Hasher>(slots[child], slots[child + 1], names)) {
+      ++child;
+    }
+    if (!slot_before<Hasher>(slots[root], slots[child], names)) {
+      return;
+    }
+    const auto tmp = slots[root];
+    slots[root] = slots[child];
+    slots[child] = tmp;
+    root = child;
+  }
+}
+
+/**
+ * @brief Sorts the named slots of a name table by name.
+ *
+ * Heapsort, so building the order takes O(n log n) steps in constant
+ * evaluation whatever the names are.
+ *
+ * @tparam N The capacity of the order, at least the number of names.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param names The name table, indexed by slot.
+ * @return The order.
+ */
+template <std::size_t N, std::size_t Slots, typename Hasher, typename Names>
+MGUTILITY_CNSTXPR auto make_name_order(const Names &names) noexcept
+    -> enum_name_order<N, uint_fit_t<Slots>> {
+  using slot_type = uint_fit_t<Slots>;
+  enum_name_order<N, slot_type> order{};
+  for (std::size_t slot = 0; slot < Slots && order.size < N; ++slot) {
+    if (!names[slot].empty()) {
+      order.slots[order.size++] = static_cast<slot_type>(slot);
+    }
+  }
+
+  for (auto root = order.size / 2; root > 0; --root) {
+    sift_slot<Hasher>(order.slots, root - 1, order.size, names);
+  }
+  for (auto end = order.size; end > 1; --end) {
+    const auto tmp = order.slots[0];
+    order.slots[0] = order.slots[end - 1];
+    order.slots[end - 1] = tmp;
+    sift_slot<Hasher>(order.slots, 0, end - 1, names);
+  }
+  return order;
+}
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PREFIX_HPP
@@ -0,0 +1,613 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_SET_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_SET_HPP
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+
+namespace mgutility {
+
+/**
+ * @brief A set of the named values of an enum, packed one bit per value.
+ *
+ * Bit i of the set stands for the value with dense ordinal i (see
+ * enum_index()), so size() is a popcount per word, iteration walks the set
+ * bits with count-trailing-zeros in ascending order, and the set algebra
+ * works on whole words. Names are written straight from the reflected name
+ * table and parsed with its hash index, without a string per element.
+ *
+ * Bitmask and flag enums are sets of bits already and are not supported.
+ * The set has enum_count<Enum>() bits in C++14 and later; C++11 sizes it
+ * for the whole range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+class enum_set {
+  static_assert(!detail::has_bit_or<Enum>::value && !enum_flags<Enum>::value,
+                "enum_set does not support bitmask and flag enums!");
+
+  using word_type = std::uint64_t;
+
+  static constexpr std::size_t word_bits = 64;
+  static constexpr auto capacity = detail::enum_capacity<Enum, Min, Max>();
+  static constexpr auto word_count =
+      capacity == 0 ? std::size_t{1} : (capacity + word_bits - 1) / word_bits;
+
+  using array_type = std::array<word_type, word_count>;
+
+  /**
+   * @brief A forward iterator over the values of the set, ascending.
+   */
+  class set_iter {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Enum;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Enum;
+
+    /**
+     * @brief Default constructor, creating an end iterator.
+     */
+    constexpr set_iter() noexcept : m_words{}, m_word{word_count}, m_bits{} {}
+
+    /**
+     * @brief Constructor initializing the iterator to the first set bit at
+     * or after a word.
+     *
+     * @param words The words of the set.
+     * @param word The first word to look at.
+     */
+    MGUTILITY_CNSTXPR set_iter(const array_type *words,
+                               std::size_t word) noexcept
+        : m_words{words}, m_word{word}, m_bits{} {
+      skip_empty();
+    }
+
+    /**
+     * @brief Pre-increment operator.
+     *
+     * @return A reference to the incremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator++() noexcept -> set_iter & {
+      m_bits &= m_bits - 1;
+      if (m_bits == 0) {
+        ++m_word;
+        skip_empty();
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Post-increment operator.
+     *
+     * @return A copy of the iterator before incrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator++(int) noexcept -> set_iter {
+      auto prev = *this;
+      ++*this;
+      return prev;
+    }
+
+    /**
+     * @brief Equality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are equal, otherwise false.
+     */
+    constexpr auto operator==(const set_iter &other) const noexcept -> bool {
+      return m_word == other.m_word && m_bits == other.m_bits;
+    }
+
+    /**
+     * @brief Inequality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are not equal, otherwise false.
+     */
+    constexpr auto operator!=(const set_iter &other) const noexcept -> bool {
+      return !(*this == other);
+    }
+
+    /**
+     * @brief Dereference operator.
+     *
+     * @return The current enum value.
+     */
+    MGUTILITY_CNSTXPR auto operator*() const noexcept -> Enum {
+      return detail::nth_enum_value<Enum, Min, Max>(
+          m_word * word_bits + detail::count_trailing_zeros(m_bits));
+    }
+
+  private:
+    /**
+     * @brief Moves to the first non-empty word, or to the end.
+     */
+    MGUTILITY_CNSTXPR void skip_empty() noexcept {
+      for (; m_word < word_count; ++m_word) {
+        m_bits = (*m_words)[m_word];
+        if (m_bits != 0) {
+          return;
+        }
+      }
+      m_bits = 0;
+    }
+
+    const array_type *m_words; /**< The words of the set. */
+    std::size_t m_word;        /**< The current word. */
+    word_type m_bits;          /**< The bits of the word not visited yet. */
+  };
+
+  /**
+   * @brief Adds the ordinals of the names scan_names() visits to a set.
+   */
+  struct name_collector {
+    enum_set &set; /**< The set being parsed into. */
+
+    /**
+     * @brief Looks a name up and adds its value to the set.
+     *
+     * @param name The name.
+     * @param hash The name_hash() of the name.
+     * @return True if the name was found, otherwise false.
+     */
+    MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                      std::uint64_t hash) noexcept -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+      const auto &index = detail::enum_array_cache<Enum, Min, Max>::name_index;
+#else
+      const auto &index =
+          detail::enum_array_cache<Enum, Min, Max>::name_index();
+#endif
+      const auto slot =
+          index.find(name, hash, detail::get_enum_array<Enum, Min, Max>());
+      if (slot == static_cast<std::size_t>(-1)) {
+        return false;
+      }
+      set.set_bit(detail::rank_enum_value<Enum, Min, Max>(
+                      static_cast<Enum>(static_cast<int>(slot) + Min))
+                      .before);
+      return true;
+    }
+  };
+
+public:
+  using key_type = Enum;
+  using value_type = Enum;
+  using size_type = std::size_t;
+  using iterator = set_iter;
+  using const_iterator = set_iter;
+
+  /**
+   * @brief Default constructor, creating an empty set.
+   */
+  constexpr enum_set() noexcept : m_words{} {}
+
+  /**
+   * @brief Constructor adding a list of values; values without a name are
+   * skipped.
+   *
+   * @param values The values.
+   */
+  MGUTILITY_CNSTXPR enum_set(std::initializer_list<Enum> values) noexcept
+      : m_words{} {
+    for (const auto value : values) {
+      insert(value);
+    }
+  }
+
+  /**
+   * @brief Gets the set of every named value.
+   *
+   * @return The full set.
+   */
+  static MGUTILITY_CNSTXPR auto all() noexcept -> enum_set {
+    enum_set set;
+    const auto count = enum_count<Enum, Min, Max>();
+    for (std::size_t word = 0; word < word_count; ++word) {
+      const auto first = word * word_bits;
+      set.m_words[word] = count >= first + word_bits ? ~word_type{0}
+                          : count > first
+                              ? (word_type{1} << (count - first)) - 1
+                              : word_type{0};
+    }
+    return set;
+  }
+
+  /**
+   * @brief Parses separated names into a set.
+   *
+   * Accepts the same syntax as the bitmask to_enum(): blanks around names
+   * and separators are ignored, and every name must be known. An empty
+   * string gives an empty set.
+   *
+   * @param str The names.
+   * @param separator The separator between names, default is "|".
+   * @return The set, empty if any name is unknown.
+   */
+  static MGUTILITY_CNSTXPR auto
+  parse(mgutility::string_view str,
+        mgutility::string_view separator = "|") noexcept
+      -> mgutility::optional<enum_set> {
+    enum_set set;
+    if (detail::trim_blanks(str).empty()) {
+      return mgutility::optional<enum_set>{set};
+    }
+    name_collector collector{set};
+    if (!detail::scan_names(str, separator, collector)) {
+      return mgutility::nullopt;
+    }
+    return mgutility::optional<enum_set>{set};
+  }
+
+  /**
+   * @brief Adds a value to the set.
+   *
+   * @param value The value.
+   * @return True if the value is named and was added or already present,
+   * otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto insert(Enum value) noexcept -> bool {
+    const auto rank = detail::rank_enum_value<Enum, Min, Max>(value);
+    if (rank.named) {
+      set_bit(rank.before);
+    }
+    return rank.named;
+  }
+
+  /**
+   * @brief Removes a value from the set.
+   *
+   * @param value The value.
+   * @return True if the value was in the set, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto erase(Enum value) noexcept -> bool {
+    const auto rank = detail::rank_enum_value<Enum, Min, Max>(value);
+    if (!rank.named) {
+      return false;
+    }
+    const auto mask = word_type{1} << (rank.before % word_bits);
+    auto &word = m_words[rank.before / word_bits];
+    const auto present = (word & mask) != 0;
+    word &= ~mask;
+    return present;
+  }
+
+  /**
+   * @brief Checks whether a value is in the set.
+   *
+   * @param value The value.
+   * @return True if the value is in the set, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto contains(Enum value) const noexcept -> bool {
+    const auto rank = detail::rank_enum_value<Enum, Min, Max>(value);
+    return rank.named && ((m_words[rank.before / word_bits] >>
+                           (rank.before % word_bits)) &
+                          1U) != 0;
+  }
+
+  /**
+   * @brief Gets the number of values in the set.
+   *
+   * @return The number of values.
+   */
+  MGUTILITY_CNSTXPR auto size() const noexcept -> size_type {
+    size_type count = 0;
+    for (const auto word : m_words) {
+      count += detail::count_bits(word);
+    }
+    return count;
+  }
+
+  /**
+   * @brief Checks whether the set is empty.
+   *
+   * @return True if the set has no value, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto empty() const noexcept -> bool {
+    for (const auto word : m_words) {
+      if (word != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Removes every value from the set.
+   */
+  MGUTILITY_CNSTXPR void clear() noexcept {
+    for (auto &word : m_words) {
+      word = 0;
+    }
+  }
+
+  /**
+   * @brief Returns an iterator to the smallest value of the set.
+   *
+   * @return The beginning iterator.
+   */
+  MGUTILITY_CNSTXPR auto begin() const noexcept -> const_iterator {
+    return const_iterator{&m_words, 0};
+  }
+
+  /**
+   * @brief Returns an iterator past the largest value of the set.
+   *
+   * @return The end iterator.
+   */
+  constexpr auto end() const noexcept -> const_iterator {
+    return const_iterator{};
+  }
+
+  /**
+   * @brief Adds the values of another set.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator|=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] |= other.m_words[word];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Keeps the values that are also in another set.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator&=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] &= other.m_words[word];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Keeps the values that are in exactly one of the sets.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator^=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] ^= other.m_words[word];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Removes the values of another set.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator-=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] &= ~other.m_words[word];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Gets the union of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return The union.
+   */
+  friend MGUTILITY_CNSTXPR auto operator|(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs |= rhs;
+  }
+
+  /**
+   * @brief Gets the intersection of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return The intersection.
+   */
+  friend MGUTILITY_CNSTXPR auto operator&(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs &= rhs;
+  }
+
+  /**
+   * @brief Gets the symmetric difference of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return The symmetric difference.
+   */
+  friend MGUTILITY_CNSTXPR auto operator^(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs ^= rhs;
+  }
+
+  /**
+   * @brief Gets the difference of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The set whose values are removed.
+   * @return The difference.
+   */
+  friend MGUTILITY_CNSTXPR auto operator-(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs -= rhs;
+  }
+
+  /**
+   * @brief Gets the complement of a set among the named values.
+   *
+   * @param set The set.
+   * @return The named values that are not in the set.
+   */
+  friend MGUTILITY_CNSTXPR auto operator~(const enum_set &set) noexcept
+      -> enum_set {
+    return all() - set;
+  }
+
+  /**
+   * @brief Equality comparison operator.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return True if the sets have the same values, otherwise false.
+   */
+  friend MGUTILITY_CNSTXPR auto operator==(const enum_set &lhs,
+                                           const enum_set &rhs) noexcept
+      -> bool {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      if (lhs.m_words[word] != rhs.m_words[word]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Inequality comparison operator.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return True if the sets differ, otherwise false.
+   */
+  friend MGUTILITY_CNSTXPR auto operator!=(const enum_set &lhs,
+                                           const enum_set &rhs) noexcept
+      -> bool {
+    return !(lhs == rhs);
+  }
+
+  /**
+   * @brief Writes the names of the values, ascending, into a buffer.
+   *
+   * Like enum_name_to, at most cap bytes are written, no terminating '\0' is
+   * added and the result is the full length of the names.
+   *
+   * @param out The buffer.
+   * @param cap The capacity of the buffer.
+   * @param separator The separator between names, default is "|".
+   * @return The number of bytes the names need.
+   */
+  auto names_to(char *out, std::size_t cap,
+                mgutility::string_view separator = "|") const noexcept
+      -> std::size_t {
+    detail::buffer_sink sink{out, cap, 0};
+    write_names(sink, separator);
+    return sink.size;
+  }
+
+  /**
+   * @brief Appends the names of the values, ascending, to a string.
+   *
+   * @param out The string to append to.
+   * @param separator The separator between names, default is "|".
+   * @return The number of bytes appended.
+   */
+  auto names_to(std::string &out,
+                mgutility::string_view separator = "|") const
+      -> std::size_t {
+    const auto size = out.size();
+    detail::string_sink sink{out};
+    write_names(sink, separator);
+    return out.size() - size;
+  }
+
+  /**
+   * @brief Gets the names of the values, ascending, as one string.
+   *
+   * @param separator The separator between names, default is "|".
+   * @return The names.
+   */
+  auto to_string(mgutility::string_view separator = "|") const
+      -> std::string {
+    std::string str;
+    names_to(str, separator);
+    return str;
+  }
+
+private:
+  /**
+   * @brief Sets the bit of an ordinal.
+   *
+   * @param ordinal The ordinal.
+   */
+  MGUTILITY_CNSTXPR void set_bit(std::size_t ordinal) noexcept {
+    m_words[ordinal / word_bits] |= word_type{1} << (ordinal % word_bits);
+  }
+
+  /**
+   * @brief Writes the names of the values to a sink.
+   *
+   * @param sink The sink the names are appended to.
+   * @param separator The separator between names.
+   */
+  template <typename Sink>
+  void write_names(Sink &sink, mgutility::string_view separator) const {
+    const auto &values = detail::get_enum_values<Enum, Min, Max>();
+    const auto &names = detail::get_enum_array<Enum, Min, Max>();
+    auto first = true;
+    for (std::size_t word = 0; word < word_count; ++word) {
+      for (auto bits = m_words[word]; bits != 0; bits &= bits - 1) {
+        const auto ordinal =
+            word * word_bits + detail::count_trailing_zeros(bits);
+        if (!first) {
+          sink.append(separator);
+        }
+        first = false;
+        sink.append(names[static_cast<std::size_t>(values.items[ordinal])]);
+      }
+    }
+  }
+
+  array_type m_words; /**< The bits of the set, by dense ordinal. */
+};
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_SET_HPP
@@ -0,0 +1,199 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_STREAM_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_STREAM_HPP
+
+#include "mgutility/_common/definitions.hpp"
+#include "mgutility/std/string_view.hpp"
+
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <locale>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
+
+/**
+ * @brief Writes names to an output stream, one write() per name.
+ */
+struct ostream_sink {
+  std::ostream &os; /**< The output stream. */
+
+  /**
+   * @brief Appends a string.
+   *
+   * @param str The string.
+   * @return This sink.
+   */
+  auto append(mgutility::string_view str) -> ostream_sink & {
+    os.write(str.data(), static_cast<std::streamsize>(str.size()));
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes a name padded to the width of an output stream, honoring its
+ * fill character and left or right adjustment, and resets the width.
+ *
+ * @param os The output stream.
+ * @param name The name.
+ */
+inline void write_padded(std::ostream &os, mgutility::string_view name) {
+  const auto width = static_cast<std::size_t>(os.width());
+  auto pad = width > name.size() ? width - name.size() : 0;
+  const auto left =
+      (os.flags() & std::ios_base::adjustfield) == std::ios_base::left;
+  os.width(0);
+  for (; !left && pad > 0; --pad) {
+    os.put(os.fill());
+  }
+  os.write(name.data(), static_cast<std::streamsize>(name.size()));
+  for (; pad > 0; --pad) {
+    os.put(os.fill());
+  }
+}
+
+/**
+ * @brief Exposes the get area of a stream buffer, which std::streambuf only
+ * shows to derived classes.
+ */
+class streambuf_access : public std::streambuf {
+public:
+  /**
+   * @brief Gets the next character of the get area.
+   *
+   * @param buf The stream buffer.
+   * @return The current position in the get area.
+   */
+  static auto next(std::streambuf &buf) -> char * {
+    return (buf.*&streambuf_access::gptr)();
+  }
+
+  /**
+   * @brief Gets the end of the get area.
+   *
+   * @param buf The stream buffer.
+   * @return The end of the get area.
+   */
+  static auto end(std::streambuf &buf) -> char * {
+    return (buf.*&streambuf_access::egptr)();
+  }
+
+  /**
+   * @brief Consumes characters of the get area.
+   *
+   * @param buf The stream buffer.
+   * @param count The number of characters, at most the ones left.
+   */
+  static void consume(std::streambuf &buf, std::size_t count) {
+    (buf.*&streambuf_access::gbump)(static_cast<int>(count));
+  }
+};
+
+/**
+ * @brief Reads a whitespace-delimited name from an input stream and hands
+ * it to a lookup.
+ *
+ * Leading whitespace is skipped as for any formatted input, and whitespace
+ * is whatever the ctype facet of the stream's locale classifies as space.
+ * When the name and the whitespace after it are already in the get area of
+ * the stream buffer, the lookup sees the buffer itself; otherwise the name is
+ * copied into a stack buffer of Capacity characters, moving to a string that
+ * grows as needed when it is longer, e.g. a long '|'-joined bitmask. Names
+ * that are empty or rejected by the lookup set failbit; running into the end
+ * of the stream sets eofbit.
+ *
+ * @tparam Capacity The length up to which a name is copied to the stack.
+ * @tparam Lookup The lookup, called as lookup(name) and returning whether it
+ * found the name.
+ * @param is The input stream.
+ * @param lookup The lookup.
+ */
+template <std::size_t Capacity, typename Lookup>
+void extract_name(std::istream &is, Lookup lookup) {
+  using traits = std::istream::traits_type;
+  const std::istream::sentry sentry(is);
+  if (!sentry) {
+    return;
+  }
+
+  const auto &ctype = std::use_facet<std::ctype<char>>(is.getloc());
+  auto &buf = *is.rdbuf();
+  auto *const first = streambuf_access::next(buf);
+  auto *const last = streambuf_access::end(buf);
+  auto *pos = first;
+  while (pos != last && !ctype.is(std::ctype_base::space, *pos)) {
+    ++pos;
+  }
+  if (pos != first && pos != last) {
+    const auto size = static_cast<std::size_t>(pos - first);
+    streambuf_access::consume(buf, size);
+    if (!lookup(mgutility::string_view(first, size))) {
+      is.setstate(std::ios_base::failbit);
+    }
+    return;
+  }
+
+  std::array<char, Capacity> scratch{};
+  std::string spill;
+  std::size_t size = 0;
+  auto state = std::ios_base::goodbit;
+  for (auto chr = buf.sgetc();; chr = buf.snextc()) {
+    if (traits::eq_int_type(chr, traits::eof())) {
+      state |= std::ios_base::eofbit;
+      break;
+    }
+    const auto value = traits::to_char_type(chr);
+    if (ctype.is(std::ctype_base::space, value)) {
+      break;
+    }
+    if (size < Capacity) {
+      scratch[size] = value;
+    } else {
+      if (size == Capacity) {
+        spill.assign(scratch.data(), Capacity);
+      }
+      spill.push_back(value);
+    }
+    ++size;
+  }
+  const auto name = size <= Capacity
+                        ? mgutility::string_view(scratch.data(), size)
+                        : mgutility::string_view(spill.data(), spill.size());
+  if (size == 0 || !lookup(name)) {
+    state |= std::ios_base::failbit;
+  }
+  is.setstate(state);
+}
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_STREAM_HPP
@@ -0,0 +1,295 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_SUGGEST_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_SUGGEST_HPP
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace mgutility {
+
+/**
+ * @brief A name suggested for a string that is not a name of an enum.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_suggestion {
+  Enum value;                  /**< The suggested value. */
+  mgutility::string_view name; /**< The name of the value. */
+  std::size_t distance;        /**< The edit distance from the string. */
+};
+
+namespace detail {
+
+/**
+ * @brief The per-character match masks of a pattern of at most 64 bytes,
+ * for Myers' bit-parallel edit distance.
+ *
+ * Bit i of the mask of a character is set if the pattern has that character
+ * at position i. Clearing only touches the characters of the pattern, so
+ * one table can be reused for many patterns.
+ *
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ */
+template <typename Hasher> struct myers_pattern {
+  static constexpr std::size_t max_size = 64;
+
+  std::array<std::uint64_t, 256> masks{}; /**< The mask of each character. */
+  std::array<char, max_size> chars{};     /**< A copy of the pattern. */
+  std::size_t size{};                     /**< The length of the pattern. */
+
+  /**
+   * @brief Gets the table index of a character.
+   *
+   * @param chr The character.
+   * @return The index.
+   */
+  static constexpr auto index(char chr) noexcept -> std::size_t {
+    return static_cast<unsigned char>(Hasher::fold(chr));
+  }
+
+  /**
+   * @brief Sets the pattern.
+   *
+   * @param str The pattern, at most max_size bytes.
+   */
+  void assign(mgutility::string_view str) noexcept {
+    clear();
+    size = str.size();
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      chars[idx] = str[idx];
+      masks[index(str[idx])] |= std::uint64_t{1} << idx;
+    }
+  }
+
+  /**
+   * @brief Clears the masks of the current pattern.
+   */
+  void clear() noexcept {
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      masks[index(chars[idx])] = 0;
+    }
+    size = 0;
+  }
+
+  /**
+   * @brief Computes the edit distance between the pattern and a text,
+   * giving up early once it cannot be at most a bound.
+   *
+   * The pattern is one column of the dynamic programming matrix held in two
+   * bit vectors of vertical deltas, so each character of the text costs a
+   * few word operations (Myers 1999, in Hyyrö's formulation for the global
+   * distance).
+   *
+   * @param text The text.
+   * @param bound The largest distance of interest.
+   * @return The distance, or a value greater than bound.
+   */
+  auto distance(mgutility::string_view text, std::size_t bound) const noexcept
+      -> std::size_t {
+    if (size == 0) {
+      return text.size();
+    }
+
+    const auto last = std::uint64_t{1} << (size - 1);
+    auto positive = size == max_size ? ~std::uint64_t{0} : (last << 1) - 1;
+    std::uint64_t negative = 0;
+    auto score = size;
+
+    for (std::size_t idx = 0; idx < text.size(); ++idx) {
+      const auto equal = masks[index(text[idx])];
+      const auto vertical = equal | negative;
+      const auto diagonal =
+          (((equal & positive) + positive) ^ positive) | equal;
+      auto horizontal_pos = negative | ~(diagonal | positive);
+      auto horizontal_neg = positive & diagonal;
+
+      if ((horizontal_pos & last) != 0) {
+        ++score;
+      } else if ((horizontal_neg & last) != 0) {
+        --score;
+      }
+
+      // Every remaining character lowers the score by at most one
+      const auto remaining = text.size() - idx - 1;
+      if (score > remaining && score - remaining > bound) {
+        return bound + 1;
+      }
+
+      horizontal_pos = (horizontal_pos << 1) | 1;
+      horizontal_neg <<= 1;
+      positive = horizontal_neg | ~(vertical | horizontal_pos);
+      negative = horizontal_pos & vertical;
+    }
+    return score;
+  }
+};
+
+/**
+ * @brief Suggests the names of an enum closest to a string.
+ *
+ * The string is the Myers pattern when it fits one word; otherwise each
+ * name that fits is the pattern in turn, and pairs where neither fits are
+ * skipped. Names whose length alone puts them past the worst kept
+ * suggestion are not compared at all.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param str The string.
+ * @param out The suggestions, closest first.
+ * @param count The maximum number of suggestions.
+ * @param max_distance The largest edit distance suggested.
+ * @return The number of suggestions written.
+ */
+template <typename Enum, int Min, int Max, typename Hasher>
+auto suggest_impl(mgutility::string_view str, enum_suggestion<Enum> *out,
+                  std::size_t count, std::size_t max_distance) noexcept
+    -> std::size_t {
+  using pattern_type = myers_pattern<Hasher>;
+  if (count == 0) {
+    return 0;
+  }
+
+  pattern_type pattern;
+  const auto fixed = str.size() <= pattern_type::max_size;
+  if (fixed) {
+    pattern.assign(str);
+  }
+
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto &values = get_enum_values<Enum, Min, Max>();
+  std::size_t found = 0;
+  for (std::size_t idx = 0; idx < values.size; ++idx) {
+    const auto slot = static_cast<std::size_t>(values.items[idx]);
+    const auto name = names[slot];
+    if (found == count && out[count - 1].distance == 0) {
+      break;
+    }
+    const auto bound =
+        found == count ? out[count - 1].distance - 1 : max_distance;
+    const auto gap = name.size() > str.size() ? name.size() - str.size()
+                                              : str.size() - name.size();
+    if (gap > bound) {
+      continue;
+    }
+
+    std::size_t distance = 0;
+    if (fixed) {
+      distance = pattern.distance(name, bound);
+    } else if (name.size() <= pattern_type::max_size) {
+      pattern.assign(name);
+      distance = pattern.distance(str, bound);
+    } else {
+      continue;
+    }
+    if (distance > bound) {
+      continue;
+    }
+
+    // Insert after the suggestions not farther away, dropping the last one
+    // when the buffer is full
+    auto pos = found < count ? found++ : count - 1;
+    for (; pos > 0 && out[pos - 1].distance > distance; --pos) {
+      out[pos] = out[pos - 1];
+    }
+    out[pos] = enum_suggestion<Enum>{
+        static_cast<Enum>(static_cast<int>(slot) + Min), name, distance};
+  }
+  return found;
+}
+
+} // namespace detail
+
+/**
+ * @brief Suggests the names of an enum closest to a string, e.g. for a "did
+ * you mean" message after to_enum failed.
+ *
+ * Names are ranked by edit distance, ties by value. Only the failure path
+ * pays for this: to_enum itself is unchanged.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string.
+ * @param out The suggestions, closest first.
+ * @param count The maximum number of suggestions.
+ * @param max_distance The largest edit distance suggested, default is no
+ * limit.
+ * @return The number of suggestions written.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+auto suggest(mgutility::string_view str, enum_suggestion<Enum> *out,
+             std::size_t count,
+             std::size_t max_distance = static_cast<std::size_t>(-1)) noexcept
+    -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::suggest_impl<Enum, Min, Max, detail::fnv_name_hasher>(
+      str, out, count, max_distance);
+}
+
+/**
+ * @brief Suggests the names of an enum closest to a string, ignoring ASCII
+ * case.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string.
+ * @param out The suggestions, closest first.
+ * @param count The maximum number of suggestions.
+ * @param max_distance The largest edit distance suggested, default is no
+ * limit.
+ * @return The number of suggestions written.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+auto suggest(mgutility::string_view str, case_insensitive_t /*unused*/,
+             enum_suggestion<Enum> *out, std::size_t count,
+             std::size_t max_distance = static_cast<std::size_t>(-1)) noexcept
+    -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::suggest_impl<Enum, Min, Max, detail::folded_name_hasher>(
+      str, out, count, max_distance);
+}
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_SUGGEST_HPP
@@ -27,6 +27,9 @@ SOFTWARE.
 
 #include "mgutility/_common/definitions.hpp"
 #include "mgutility/std/utility.hpp"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <type_traits>
 #include <utility>
@@ -54,27 +57,40 @@ namespace detail {
 #define MGUTILITY_ENUM_RANGE_MAX 256
 #endif
 
+#ifndef MGUTILITY_ENUM_PROBE_CHUNK
 /**
- * @brief Defines the MGUTILITY_ENUM_NAME_BUFFER_SIZE macro.
+ * @brief Defines the MGUTILITY_ENUM_PROBE_CHUNK macro.
  *
- * This macro defines the size of the buffer used for enum names.
+ * This macro defines how many values of an enum range are reflected by a
+ * single probe function. Wider ranges are split into chunks of this size, so
+ * the compiler never builds a signature longer than one chunk. Default is
+ * 256, which keeps the default range in one chunk.
  */
-#ifndef MGUTILITY_ENUM_NAME_BUFFER_SIZE
 // NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
-#define MGUTILITY_ENUM_NAME_BUFFER_SIZE 32U
+#define MGUTILITY_ENUM_PROBE_CHUNK 256
+#endif
+
+#ifndef MGUTILITY_ENUM_NAME_PADDED_SLOTS
+/**
+ * @brief Defines the MGUTILITY_ENUM_NAME_PADDED_SLOTS macro.
+ *
+ * This macro enables an additional name layout for to_enum: every name of at
+ * most this many bytes is zero-padded into a slot of its own, so a lookup is
+ * one word hash and one vector compare instead of a byte-wise hash and
+ * memcmp. Valid values are 16 and 32; 0, the default, disables the layout.
+ */
+// NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
+#define MGUTILITY_ENUM_NAME_PADDED_SLOTS 0
 #endif
 
 /**
- * @brief Defines the MGUTILITY_GLOBAL_ENUM_BLOB_SIZE macro.
+ * @brief Defines the MGUTILITY_ENUM_NAME_BUFFER_SIZE macro.
  *
- * This macro defines the size of the global fixed-size buffer shared by
- * all enum types in enum_name_parse_result. All enum names for all enums
- * with the same underlying type are stored in this shared buffer, reducing
- * template bloat compared to per-type fixed_string instantiations.
+ * This macro defines the size of the buffer used for enum names.
  */
-#ifndef MGUTILITY_GLOBAL_ENUM_BLOB_SIZE
+#ifndef MGUTILITY_ENUM_NAME_BUFFER_SIZE
 // NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
-#define MGUTILITY_GLOBAL_ENUM_BLOB_SIZE 8192
+#define MGUTILITY_ENUM_NAME_BUFFER_SIZE 32U
 #endif
 
 #ifndef MGUTILITY_INLINE
@@ -160,6 +176,81 @@ template <typename T>
 // NOLINTNEXTLINE [modernize-type-traits]
 using remove_const_t = typename std::remove_const<T>::type;
 
+/**
+ * @brief Alias template for the smallest unsigned integer type that can hold
+ * a value.
+ *
+ * @tparam N The largest value to hold.
+ */
+template <std::size_t N>
+// NOLINTNEXTLINE [modernize-type-traits]
+using uint_fit_t = typename std::conditional<
+    (N <= 0xFFU), std::uint8_t,
+    // NOLINTNEXTLINE [modernize-type-traits]
+    typename std::conditional<(N <= 0xFFFFU), std::uint16_t,
+                              std::uint32_t>::type>::type;
+
+/**
+ * @brief A fixed-size array whose elements can be assigned in a constant
+ * expression, which std::array only allows from C++17 on.
+ *
+ * @tparam T The element type.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N> struct constant_array {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  T items[N == 0 ? 1 : N]; /**< The elements. */
+
+  static constexpr auto size() noexcept -> std::size_t { return N; }
+
+  MGUTILITY_CNSTXPR auto operator[](std::size_t idx) noexcept -> T & {
+    return items[idx];
+  }
+
+  constexpr auto operator[](std::size_t idx) const noexcept -> const T & {
+    return items[idx];
+  }
+};
+
+#if defined(__clang__) || defined(_MSC_VER)
+/**
+ * @brief Adapts the integer sequence built by __make_integer_seq to an
+ * index_sequence.
+ *
+ * @tparam T The integer type.
+ * @tparam I The integers.
+ */
+template <typename T, T... I> struct probe_index_sequence {
+  using type = index_sequence<static_cast<std::size_t>(I)...>;
+};
+
+/**
+ * @brief Alias for an index sequence of size N built by the compiler
+ * intrinsic, without recursive instantiations.
+ *
+ * @tparam N The size of the index sequence.
+ */
+template <std::size_t N>
+using make_probe_sequence =
+    typename __make_integer_seq<probe_index_sequence, std::size_t, N>::type;
+#elif defined(__GNUC__)
+/**
+ * @brief Alias for an index sequence of size N built by the compiler
+ * intrinsic, without recursive instantiations.
+ *
+ * @tparam N The size of the index sequence.
+ */
+template <std::size_t N>
+using make_probe_sequence = index_sequence<__integer_pack(N)...>;
+#else
+/**
+ * @brief Alias for an index sequence of size N.
+ *
+ * @tparam N The size of the index sequence.
+ */
+template <std::size_t N> using make_probe_sequence = make_index_sequence<N>;
+#endif
+
 /**
  * @brief Represents a sequence of enumeration values.
  *
@@ -206,7 +297,101 @@ public:
 template <typename Enum, int Min, int Max>
 using make_enum_sequence = typename enum_sequence_from_index<
     Enum, Min,
-    make_index_sequence<static_cast<std::size_t>(Max - Min + 1)>>::type;
+    make_probe_sequence<static_cast<std::size_t>(Max - Min + 1)>>::type;
+
+/**
+ * @brief Alias template for the unsigned counterpart of an enum's underlying
+ * type.
+ *
+ * @tparam Enum The enumeration type.
+ */
+template <typename Enum>
+// NOLINTNEXTLINE [modernize-type-traits]
+using flag_type_t = typename std::make_unsigned<underlying_type_t<Enum>>::type;
+
+/**
+ * @brief Gets the number of bits of an enum's underlying type.
+ *
+ * @tparam Enum The enumeration type.
+ * @return The number of single-bit flags the enum can hold.
+ */
+template <typename Enum> constexpr auto flag_bits() noexcept -> std::size_t {
+  return sizeof(underlying_type_t<Enum>) * CHAR_BIT;
+}
+
+/**
+ * @brief Counts the trailing zero bits of a value.
+ *
+ * @param value The value, must not be zero.
+ * @return The index of the lowest set bit.
+ */
+constexpr auto count_trailing_zeros(std::uint64_t value) noexcept
+    -> std::size_t {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+  return (value & 1U) != 0 ? 0 : 1 + count_trailing_zeros(value >> 1U);
+#endif
+}
+
+/**
+ * @brief Counts the set bits of a value.
+ *
+ * @param value The value.
+ * @return The number of set bits.
+ */
+constexpr auto count_bits(std::uint64_t value) noexcept -> std::size_t {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(value));
+#else
+  return value == 0 ? 0 : 1 + count_bits(value & (value - 1));
+#endif
+}
+
+/**
+ * @brief Helper for creating the flag probe sequence of an enum.
+ *
+ * @tparam Enum The enumeration type.
+ * @tparam Seq The index sequence of the bit positions.
+ */
+template <typename Enum, typename Seq> struct enum_sequence_from_bits;
+
+/**
+ * @brief Specialization for creating the flag probe sequence from bit
+ * positions.
+ *
+ * The sequence is 0, every single bit of the underlying type in ascending
+ * order, and a trailing 0 so that every probed value is followed by a
+ * separator.
+ *
+ * @tparam Enum The enumeration type.
+ * @tparam I The bit positions.
+ */
+template <typename Enum, std::size_t... I>
+struct enum_sequence_from_bits<Enum, index_sequence<I...>> {
+private:
+  // NOLINTNEXTLINE [readability-identifier-length]
+  static constexpr auto bit(std::size_t i) -> underlying_type_t<Enum> {
+    return static_cast<underlying_type_t<Enum>>(
+        static_cast<flag_type_t<Enum>>(static_cast<flag_type_t<Enum>>(1U)
+                                       << i));
+  }
+
+public:
+  using type =
+      enum_sequence<Enum, static_cast<Enum>(0), static_cast<Enum>(bit(I))...,
+                    static_cast<Enum>(0)>;
+};
+
+/**
+ * @brief Alias for the flag probe sequence of an enum: 0 and each single bit
+ * of its underlying type.
+ *
+ * @tparam Enum The enumeration type.
+ */
+template <typename Enum>
+using make_flag_sequence = typename enum_sequence_from_bits<
+    Enum, make_probe_sequence<flag_bits<Enum>()>>::type;
 } // namespace detail
 
 /**
@@ -247,6 +432,46 @@ template <typename T> struct custom_enum {
   // #endif
 };
 
+/**
+ * @brief Marks an enumeration type as a set of single-bit flags.
+ *
+ * Specialize with `static constexpr bool value = true;` to reflect the enum
+ * by probing 0 and each bit of its underlying type instead of enum_range.
+ * Names are then stored per bit position, so flags up to the full width of
+ * the underlying type (e.g. `1ULL << 63`) can be reflected with at most 65
+ * probes. The enum must have a fixed underlying type.
+ *
+ * @tparam T The enumeration type.
+ */
+template <typename T> struct enum_flags {
+  static constexpr auto value = false;
+};
+
+/**
+ * @brief Marks an enumeration type whose names can be overridden at runtime.
+ *
+ * Specialize with `static constexpr bool value = true;` to have enum_name look
+ * a value up in the overlay published with publish_enum_overlay() before the
+ * reflected names. Reading the overlay is one atomic load, but it makes
+ * enum_name of the type a runtime call.
+ *
+ * @tparam T The enumeration type.
+ */
+template <typename T> struct enum_name_overlay {
+  static constexpr auto value = false;
+};
+
+/**
+ * @brief Tag type that selects the case-insensitive to_enum overloads.
+ */
+struct case_insensitive_t {};
+
+/**
+ * @brief Makes to_enum ignore ASCII case, e.g.
+ * `to_enum<Color>("RED", mgutility::case_insensitive)`.
+ */
+MGUTILITY_INLINE constexpr case_insensitive_t case_insensitive{};
+
 /**
  * @brief Provides the name buffer size for an enumeration type.
  *
@@ -0,0 +1,409 @@
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_ENUM_COLUMN_HPP
+#define MGUTILITY_REFLECTION_ENUM_COLUMN_HPP
+
+#include "mgutility/reflection/enum_name.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define MGUTILITY_ENUM_COLUMN_MMAP 1
+#endif
+
+namespace mgutility {
+
+/**
+ * @brief Describes the column of a delimited text file holding enum names.
+ */
+struct enum_column_options {
+  std::size_t column{0}; /**< The zero-based index of the field. */
+  char delimiter{','};   /**< The field delimiter, ',' for CSV, '\t' for TSV. */
+  bool header{false};    /**< Whether the first line is skipped. */
+  unsigned threads{0};   /**< The threads, 0 for one per hardware thread. */
+};
+
+/**
+ * @brief The values parsed from one column of a delimited text file.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_column {
+  /** The value of each data row, value-initialized where the name is
+   * unknown or the row has no such field. */
+  std::vector<Enum> values;
+  /** The one-based line numbers of those rows, ascending. */
+  std::vector<std::size_t> unknown_rows;
+};
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace detail {
+
+/**
+ * @brief The least number of bytes worth handing to a thread of its own.
+ */
+constexpr std::size_t min_column_chunk = std::size_t{1} << 16U;
+
+/**
+ * @brief Finds the end of the line starting at a position.
+ *
+ * @param first The start of the line.
+ * @param last The end of the text.
+ * @return The position of the line's '\n', or last.
+ */
+inline auto line_end(const char *first, const char *last) noexcept
+    -> const char * {
+  const auto *end = static_cast<const char *>(
+      std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+  return end != nullptr ? end : last;
+}
+
+/**
+ * @brief Counts the lines of a text, a last line without '\n' included.
+ *
+ * @param first The start of the text.
+ * @param last The end of the text.
+ * @return The number of lines.
+ */
+inline auto count_lines(const char *first, const char *last) noexcept
+    -> std::size_t {
+  std::size_t lines = 0;
+  for (; first != last; ++lines) {
+    first = line_end(first, last);
+    first = first != last ? first + 1 : last;
+  }
+  return lines;
+}
+
+/**
+ * @brief Finds a field of a line.
+ *
+ * A '\r' ending the line is dropped, and so are double quotes around the
+ * field; quoted fields holding the delimiter or a line break are not
+ * supported.
+ *
+ * @param first The start of the line.
+ * @param last The end of the line, without its '\n'.
+ * @param options The column and delimiter.
+ * @param field The field, when found.
+ * @return True if the line has the field, otherwise false.
+ */
+inline auto find_field(const char *first, const char *last,
+                       const enum_column_options &options,
+                       mgutility::string_view &field) noexcept -> bool {
+  if (first != last && last[-1] == '\r') {
+    --last;
+  }
+  for (auto skip = options.column; skip > 0; --skip) {
+    const auto *next = static_cast<const char *>(std::memchr(
+        first, options.delimiter, static_cast<std::size_t>(last - first)));
+    if (next == nullptr) {
+      return false;
+    }
+    first = next + 1;
+  }
+  const auto *end = static_cast<const char *>(std::memchr(
+      first, options.delimiter, static_cast<std::size_t>(last - first)));
+  if (end == nullptr) {
+    end = last;
+  }
+  if (end - first >= 2 && *first == '"' && end[-1] == '"') {
+    ++first;
+    --end;
+  }
+  field = mgutility::string_view(first, static_cast<std::size_t>(end - first));
+  return true;
+}
+
+/**
+ * @brief Runs a task for each chunk, on its own thread but the first, and
+ * waits for all of them.
+ *
+ * An exception thrown by a task, e.g. std::bad_alloc, is caught on its
+ * thread and rethrown here once every thread has been joined; if several
+ * tasks throw, the one of the lowest chunk is rethrown.
+ *
+ * @tparam Task The task, called as task(chunk).
+ * @param chunks The number of chunks.
+ * @param task The task.
+ */
+template <typename Task> void run_chunks(std::size_t chunks, Task &task) {
+  std::vector<std::exception_ptr> errors(chunks);
+  auto guarded = [&task, &errors](std::size_t chunk) {
+    try {
+      task(chunk);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+  {
+    struct joiner {
+      std::vector<std::thread> workers;
+      joiner() = default;
+      joiner(const joiner &) = delete;
+      auto operator=(const joiner &) -> joiner & = delete;
+      ~joiner() {
+        for (auto &worker : workers) {
+          worker.join();
+        }
+      }
+    } pool{};
+    pool.workers.reserve(chunks - 1);
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+      pool.workers.emplace_back([&guarded, chunk] { guarded(chunk); });
+    }
+    guarded(0);
+  }
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+/**
+ * @brief Parses one column of a delimited text into enum values.
+ *
+ * The text is split into one chunk per thread at line boundaries. The lines
+ * of every chunk are counted first, so that each thread then writes its
+ * values straight to their place in the result; the names are looked up
+ * where they lie in the text.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param text The text.
+ * @param options The column, delimiter, header and threads.
+ * @return The values and the line numbers of unknown names.
+ */
+template <typename Enum, int Min, int Max>
+auto parse_enum_column_impl(mgutility::string_view text,
+                            const enum_column_options &options)
+    -> enum_column<Enum> {
+  enum_column<Enum> result{};
+  const auto *first = text.data();
+  const auto *const last = text.data() + text.size();
+  std::size_t line_base = 1;
+  if (options.header && first != last) {
+    first = line_end(first, last);
+    first = first != last ? first + 1 : last;
+    ++line_base;
+  }
+
+  const auto size = static_cast<std::size_t>(last - first);
+  std::size_t threads = options.threads != 0
+                            ? options.threads
+                            : std::max(1U, std::thread::hardware_concurrency());
+  threads = std::max<std::size_t>(
+      1, std::min(threads, size / min_column_chunk));
+
+  std::vector<const char *> bounds(threads + 1, last);
+  bounds[0] = first;
+  for (std::size_t chunk = 1; chunk < threads; ++chunk) {
+    const auto *start =
+        std::max(bounds[chunk - 1], first + size / threads * chunk);
+    const auto *end = line_end(start - 1, last);
+    bounds[chunk] = end != last ? end + 1 : last;
+  }
+
+  std::vector<std::size_t> offsets(threads + 1, 0);
+  auto count = [&](std::size_t chunk) {
+    offsets[chunk + 1] = count_lines(bounds[chunk], bounds[chunk + 1]);
+  };
+  run_chunks(threads, count);
+  for (std::size_t chunk = 0; chunk < threads; ++chunk) {
+    offsets[chunk + 1] += offsets[chunk];
+  }
+
+  result.values.resize(offsets[threads]);
+  std::vector<std::vector<std::size_t>> unknown(threads);
+  auto parse = [&](std::size_t chunk) {
+    auto *out = result.values.data() + offsets[chunk];
+    auto row = line_base + offsets[chunk];
+    mgutility::string_view field{};
+    for (const auto *pos = bounds[chunk]; pos != bounds[chunk + 1]; ++row) {
+      const auto *end = line_end(pos, bounds[chunk + 1]);
+      auto value = find_field(pos, end, options, field)
+                       ? mgutility::to_enum<Enum, Min, Max>(field)
+                       : mgutility::optional<Enum>{};
+      if (value.has_value()) {
+        *out = value.value();
+      } else {
+        unknown[chunk].push_back(row);
+      }
+      ++out;
+      pos = end != bounds[chunk + 1] ? end + 1 : end;
+    }
+  };
+  run_chunks(threads, parse);
+
+  std::size_t unknown_count = 0;
+  for (const auto &rows : unknown) {
+    unknown_count += rows.size();
+  }
+  result.unknown_rows.reserve(unknown_count);
+  for (const auto &rows : unknown) {
+    result.unknown_rows.insert(result.unknown_rows.end(), rows.begin(),
+                               rows.end());
+  }
+  return result;
+}
+
+#if defined(MGUTILITY_ENUM_COLUMN_MMAP)
+
+/**
+ * @brief A read-only memory mapping of a whole file.
+ */
+class mapped_file {
+public:
+  /**
+   * @brief Maps a file.
+   *
+   * @param path The path of the file.
+   * @throws std::system_error if the file cannot be opened or mapped.
+   */
+  explicit mapped_file(const char *path) {
+    // NOLINTNEXTLINE [cppcoreguidelines-pro-type-vararg]
+    const auto fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+      const auto error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), path);
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    if (m_size != 0) {
+      m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (m_data == MAP_FAILED) {
+        const auto error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path);
+      }
+      ::madvise(m_data, m_size, MADV_SEQUENTIAL);
+    }
+    ::close(fd);
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  auto operator=(const mapped_file &) -> mapped_file & = delete;
+
+  ~mapped_file() {
+    if (m_size != 0) {
+      ::munmap(m_data, m_size);
+    }
+  }
+
+  /**
+   * @brief Gets the contents of the file.
+   *
+   * @return A view of the mapped bytes.
+   */
+  auto view() const noexcept -> mgutility::string_view {
+    return m_size != 0 ? mgutility::string_view(
+                             static_cast<const char *>(m_data), m_size)
+                       : mgutility::string_view{};
+  }
+
+private:
+  void *m_data{nullptr};
+  std::size_t m_size{0};
+};
+
+#endif // MGUTILITY_ENUM_COLUMN_MMAP
+
+} // namespace detail
+
+/**
+ * @brief Parses one column of a delimited text, such as a CSV or TSV file
+ * already in memory, into enum values on several threads.
+ *
+ * Each line is a row, an unknown name or a missing field leaves a
+ * value-initialized value and reports its line number.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param text The text.
+ * @param options The column, delimiter, header and threads.
+ * @return The values and the line numbers of unknown names.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto parse_enum_column(mgutility::string_view text,
+                       const enum_column_options &options = {})
+    -> enum_column<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::parse_enum_column_impl<Enum, Min, Max>(text, options);
+}
+
+#if defined(MGUTILITY_ENUM_COLUMN_MMAP)
+
+/**
+ * @brief Parses one column of a delimited text file into enum values on
+ * several threads, reading the file through a memory mapping.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param path The path of the file.
+ * @param options The column, delimiter, header and threads.
+ * @return The values and the line numbers of unknown names.
+ * @throws std::system_error if the file cannot be opened or mapped.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto parse_enum_column_file(const char *path,
+                            const enum_column_options &options = {})
+    -> enum_column<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  const detail::mapped_file file(path);
+  return detail::parse_enum_column_impl<Enum, Min, Max>(file.view(), options);
+}
+
+#endif // MGUTILITY_ENUM_COLUMN_MMAP
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_ENUM_COLUMN_HPP
@@ -25,6 +25,7 @@ SOFTWARE.
 #ifndef MGUTILITY_ENUM_NAME_HPP
 #define MGUTILITY_ENUM_NAME_HPP
 
+#include "detail/enum_format.hpp"
 #include "detail/enum_name_impl.hpp"
 
 namespace mgutility {
@@ -49,6 +50,10 @@ constexpr auto to_underlying(Enum enumValue) noexcept
 /**
  * @brief Gets the name of an enum value.
  *
+ * The name of a bitmask or flag enum value is returned in a fixed_string of
+ * enum_name_buffer<Enum>::size bytes and cut to fit it; specialize
+ * enum_name_buffer or use enum_name_to for longer names.
+ *
  * @tparam Min The minimum enum value.
  * @tparam Max The maximum enum value.
  * @tparam Enum The enum type.
@@ -67,6 +72,10 @@ MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
 /**
  * @brief Gets the name of an enum value.
  *
+ * The name of a bitmask or flag enum value is returned in a fixed_string of
+ * enum_name_buffer<Enum>::size bytes and cut to fit it; specialize
+ * enum_name_buffer or use enum_name_to for longer names.
+ *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
  * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
@@ -83,6 +92,156 @@ MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
   return detail::enum_name_impl<Enum, Min, Max>(enumValue);
 }
 
+/**
+ * @brief Writes the name of an enum value into a buffer.
+ *
+ * The names are copied straight from the reflected name table, one memcpy
+ * per name or flag, without building a temporary. At most cap bytes are
+ * written and no terminating '\0' is added; like snprintf, the result is the
+ * full length of the name, so a result greater than cap means the name was
+ * cut.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param out The buffer.
+ * @param cap The capacity of the buffer.
+ * @param e The enum value.
+ * @return The number of bytes the name needs.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto enum_name_to(char *out, std::size_t cap, Enum enumValue) noexcept
+    -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  detail::buffer_sink sink{out, cap, 0};
+  detail::write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return sink.size;
+}
+
+/**
+ * @brief Appends the name of an enum value to a string.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param out The string to append to.
+ * @param e The enum value.
+ * @return The number of bytes appended.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto enum_name_to(std::string &out, Enum enumValue) -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  const auto size = out.size();
+  detail::string_sink sink{out};
+  detail::write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return out.size() - size;
+}
+
+/**
+ * @brief Writes the name of an enum value through an output iterator.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @tparam OutputIt The output iterator type.
+ * @param out The output iterator.
+ * @param e The enum value.
+ * @return The iterator past the last character written.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          typename OutputIt,
+          // NOLINTNEXTLINE [modernize-type-traits]
+          detail::enable_if_t<std::is_enum<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto enum_name_to(OutputIt out, Enum enumValue)
+    -> OutputIt {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  detail::iterator_sink<OutputIt> sink{out};
+  detail::write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return sink.out;
+}
+
+/**
+ * @brief Gets the names of many enum values.
+ *
+ * Values outside the range get an empty name, unless the overlay of the enum
+ * names them. Bitmask and flag enums, whose names are assembled per value,
+ * are written with enum_names_join or enum_name_to instead.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param out The names, one per value.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+void enum_names(const Enum *values, std::size_t count,
+                mgutility::string_view *out) noexcept {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  detail::enum_names_impl<Enum, Min, Max>(values, count, out);
+}
+
+/**
+ * @brief Appends the names of many enum values to a string, joined by a
+ * separator.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param separator The separator between names.
+ * @param out The string to append to.
+ * @return The number of bytes appended.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto enum_names_join(const Enum *values, std::size_t count,
+                     mgutility::string_view separator, std::string &out)
+    -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  const auto size = out.size();
+  detail::join_enum_names<Enum, Min, Max>(values, count, separator, out);
+  return out.size() - size;
+}
+
+/**
+ * @brief Converts many strings to enum values.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param names The names; for bitmask and flag enums, masks joined with '|'.
+ * @param count The number of names.
+ * @param out The enum values, value-initialized where a name is unknown.
+ * @param found Whether each name was found, or nullptr.
+ * @return The number of names found.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto to_enums(const mgutility::string_view *names, std::size_t count,
+              Enum *out, bool *found = nullptr) noexcept -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enums_impl<Enum, Min, Max>(names, count, out, found);
+}
+
 /**
  * @brief Gets the enum value and its name.
  *
@@ -90,9 +249,26 @@ MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
  * @return A pair of the enum value and its name.
  */
 template <typename Enum>
-auto enum_for_each<Enum>::enum_iter::operator*() const -> value_type {
-  auto value = static_cast<Enum>(m_pos);
-  return detail::enum_pair<Enum>{value, enum_name(value)};
+MGUTILITY_CNSTXPR auto enum_for_each<Enum>::enum_iter::operator*() const noexcept
+    -> value_type {
+  return detail::enum_value_at<Enum, static_cast<int>(enum_range<Enum>::min),
+                               static_cast<int>(enum_range<Enum>::max)>(
+      static_cast<std::size_t>(m_pos));
+}
+
+/**
+ * @brief Gets the number of named values of the enum.
+ *
+ * @tparam Enum The enum type.
+ * @return The number of named values.
+ */
+template <typename Enum>
+MGUTILITY_CNSTXPR auto enum_for_each<Enum>::size() const noexcept
+    -> size_type {
+  return detail::get_enum_values<Enum,
+                                 static_cast<int>(enum_range<Enum>::min),
+                                 static_cast<int>(enum_range<Enum>::max)>()
+      .size;
 }
 
 /**
@@ -106,7 +282,9 @@ auto enum_for_each<Enum>::enum_iter::operator*() const -> value_type {
  */
 template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
           int Max = static_cast<int>(enum_range<Enum>::max),
-          detail::enable_if_t<!detail::has_bit_or<Enum>::value, bool> = true>
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
 MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str) noexcept
     -> mgutility::optional<Enum> {
   static_assert(Min < Max, "Max must be greater than Min!");
@@ -116,23 +294,141 @@ MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str) noexcept
 }
 
 /**
- * @brief Converts a string to an enum bitmask value.
+ * @brief Converts a string to an enum value, ignoring ASCII case.
+ *
+ * The name is folded while it is hashed and compared, so nothing is
+ * allocated. Names of the enum that differ only in case are rejected at
+ * compile time in C++17 and later; before that the lowest value wins.
  *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
  * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
  * @param str The string view representing the enum name.
- * @return An optional enum bitmask value.
+ * @return An optional enum value.
  */
 template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
           int Max = static_cast<int>(enum_range<Enum>::max),
-          detail::enable_if_t<detail::has_bit_or<Enum>::value, bool> = true>
-MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str) noexcept
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str,
+                               case_insensitive_t /*unused*/) noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_impl<Enum, Min, Max, detail::folded_name_hasher>(
+      str);
+}
+
+/**
+ * @brief Converts an abbreviated name to an enum value.
+ *
+ * A name equal to the prefix matches even if longer names start with it, so
+ * "warn" picks `warn` over `warning`; otherwise the prefix must start exactly
+ * one name. The names are kept in name order, so a lookup is two binary
+ * searches.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The prefix.
+ * @return The match: the value, if any, and the number of names starting
+ * with the prefix.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum_prefix(mgutility::string_view str) noexcept
+    -> enum_prefix_match<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_prefix_impl<Enum, Min, Max>(str);
+}
+
+/**
+ * @brief Converts an abbreviated name to an enum value, ignoring ASCII case.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The prefix.
+ * @return The match: the value, if any, and the number of names starting
+ * with the prefix.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum_prefix(mgutility::string_view str,
+                                      case_insensitive_t /*unused*/) noexcept
+    -> enum_prefix_match<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_prefix_impl<Enum, Min, Max,
+                                     detail::folded_name_hasher>(str);
+}
+
+/**
+ * @brief Converts a string to an enum bitmask value.
+ *
+ * Used for enums with a bitwise OR operator and for enum_flags enums. The
+ * names are parsed in a single pass; blanks around names and separators are
+ * ignored.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string view representing the enum names.
+ * @param separator The separator between names, default is "|".
+ * @return An optional enum bitmask value, empty if any name is unknown.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str,
+                               mgutility::string_view separator = "|") noexcept
     -> mgutility::optional<Enum> {
   static_assert(Min < Max, "Max must be greater than Min!");
   // NOLINTNEXTLINE [modernize-type-traits]
   static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
-  return detail::to_enum_bitmask_impl<Enum, Min, Max>(str);
+  return detail::to_enum_bitmask_impl<Enum, Min, Max>(str, separator);
+}
+
+/**
+ * @brief Converts a string to an enum bitmask value, ignoring ASCII case.
+ *
+ * See the case-insensitive to_enum for plain enums.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string view representing the enum names.
+ * @param separator The separator between names, default is "|".
+ * @return An optional enum bitmask value, empty if any name is unknown.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str,
+                               case_insensitive_t /*unused*/,
+                               mgutility::string_view separator = "|") noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_bitmask_impl<Enum, Min, Max,
+                                      detail::folded_name_hasher>(str,
+                                                                  separator);
 }
 
 /**
@@ -157,6 +453,114 @@ MGUTILITY_CNSTXPR auto enum_cast(int value) noexcept
   return mgutility::optional<Enum>{static_cast<Enum>(value)};
 }
 
+/**
+ * @brief Gets the number of named values of an enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @return The number of named values.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_count() noexcept -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::get_enum_values<Enum, Min, Max>().size;
+}
+
+/**
+ * @brief Gets the dense ordinal of an enum value.
+ *
+ * Named values are numbered from 0 to enum_count() - 1 in ascending order,
+ * the order of enum_for_each, so the ordinal can index a flat array.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return The ordinal, empty if the value has no name.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_index(Enum enumValue) noexcept
+    -> mgutility::optional<std::size_t> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  const auto rank = detail::rank_enum_value<Enum, Min, Max>(enumValue);
+  if (!rank.named) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<std::size_t>{rank.before};
+}
+
+/**
+ * @brief Gets the enum value with a dense ordinal, the inverse of
+ * enum_index().
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param index The ordinal.
+ * @return The enum value, empty if the ordinal is not below enum_count().
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_value(std::size_t index) noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  if (index >= detail::get_enum_values<Enum, Min, Max>().size) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<Enum>{
+      detail::nth_enum_value<Enum, Min, Max>(index)};
+}
+
+/**
+ * @brief Gets the smallest named value greater than a value.
+ *
+ * The value itself does not need a name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return The next named value, empty if there is none.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_next(Enum enumValue) noexcept
+    -> mgutility::optional<Enum> {
+  const auto rank = detail::rank_enum_value<Enum, Min, Max>(enumValue);
+  return enum_value<Enum, Min, Max>(rank.before + (rank.named ? 1 : 0));
+}
+
+/**
+ * @brief Gets the largest named value less than a value.
+ *
+ * The value itself does not need a name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return The previous named value, empty if there is none.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_prev(Enum enumValue) noexcept
+    -> mgutility::optional<Enum> {
+  const auto rank = detail::rank_enum_value<Enum, Min, Max>(enumValue);
+  if (rank.before == 0) {
+    return mgutility::nullopt;
+  }
+  return enum_value<Enum, Min, Max>(rank.before - 1);
+}
+
 namespace operators {
 template <typename Enum, mgutility::detail::enable_if_t<
                              // NOLINTNEXTLINE [modernize-type-traits]
@@ -177,12 +581,21 @@ constexpr auto operator|(const Enum &lhs, const Enum &rhs) -> Enum {
 
 } // namespace mgutility
 
+#include "detail/enum_map.hpp"
+#include "detail/enum_set.hpp"
+#include "detail/enum_stream.hpp"
+#include "detail/enum_suggest.hpp"
+
 /**
  * @brief Outputs the name of an enum value to an output stream.
  *
+ * Each name, and each flag name and separator of a bitmask value, is one
+ * write() to the stream; nothing is buffered first. A width set on the
+ * stream is honored.
+ *
  * @tparam Enum The enum type.
- * @param os The output stream.
- * @param e The enum value.
+ * @param outStream The output stream.
+ * @param enumVal The enum value.
  * @return The output stream.
  */
 template <typename Enum, mgutility::detail::enable_if_t<
@@ -191,10 +604,48 @@ template <typename Enum, mgutility::detail::enable_if_t<
 auto operator<<(std::ostream &outStream, Enum enumVal) -> std::ostream & {
   // NOLINTNEXTLINE [modernize-type-traits]
   static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
-  outStream << mgutility::enum_name(enumVal);
+  if (outStream.width() != 0) {
+    const auto name = mgutility::enum_name(enumVal);
+    mgutility::detail::write_padded(
+        outStream, static_cast<mgutility::string_view>(name));
+    return outStream;
+  }
+  mgutility::detail::ostream_sink sink{outStream};
+  mgutility::detail::write_enum_name<
+      Enum, static_cast<int>(mgutility::enum_range<Enum>::min),
+      static_cast<int>(mgutility::enum_range<Enum>::max)>(enumVal, sink);
   return outStream;
 }
 
+/**
+ * @brief Reads an enum value by name from an input stream.
+ *
+ * Reads one whitespace-delimited name, masks joined with '|' for bitmask
+ * and flag enums, straight from the stream buffer without allocating. On an
+ * unknown name failbit is set and the value is left unchanged.
+ *
+ * @tparam Enum The enum type.
+ * @param inStream The input stream.
+ * @param enumVal The enum value to store into.
+ * @return The input stream.
+ */
+template <typename Enum, mgutility::detail::enable_if_t<
+                             // NOLINTNEXTLINE [modernize-type-traits]
+                             std::is_enum<Enum>::value, bool> = true>
+auto operator>>(std::istream &inStream, Enum &enumVal) -> std::istream & {
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  mgutility::detail::extract_name<mgutility::enum_name_buffer<Enum>::size>(
+      inStream, [&enumVal](mgutility::string_view name) {
+        auto value = mgutility::to_enum<Enum>(name);
+        if (value.has_value()) {
+          enumVal = value.value();
+        }
+        return value.has_value();
+      });
+  return inStream;
+}
+
 #if defined(__cpp_lib_format)
 
 #include <format>
@@ -202,15 +653,53 @@ auto operator<<(std::ostream &outStream, Enum enumVal) -> std::ostream & {
 /**
  * @brief Formatter for enum types for use with std::format.
  *
+ * `{}` and string specs such as `{:>10}` format the name, `{:d}`, `{:x}`,
+ * `{:X}`, `{:o}`, `{:b}` and `{:B}` (with any integer spec before them) the
+ * underlying value, and `{:q}` the name in double quotes, optionally with a
+ * single-character fill, an alignment and a width (`{:*^12q}`). The name is
+ * handed over with its length, so nothing is measured or copied first.
+ *
  * @tparam Enum The enum type.
  */
 template <typename Enum>
   requires std::is_enum_v<Enum>
-struct std::formatter<Enum> : formatter<std::string_view> {
+struct std::formatter<Enum> {
+  constexpr auto parse(std::format_parse_context &ctx)
+      -> std::format_parse_context::iterator {
+    const auto last = mgutility::detail::find_spec_end(ctx.begin(), ctx.end());
+    m_spec.presentation =
+        mgutility::detail::enum_presentation_of(ctx.begin(), last);
+    switch (m_spec.presentation) {
+    case mgutility::detail::enum_presentation::value:
+      return m_value.parse(ctx);
+    case mgutility::detail::enum_presentation::quoted:
+      if (!mgutility::detail::parse_quoted_spec(ctx.begin(), last, m_spec)) {
+        throw std::format_error("Invalid format spec for a quoted enum name!");
+      }
+      return last;
+    default:
+      return m_name.parse(ctx);
+    }
+  }
+
+  template <typename FormatContext>
   // NOLINTNEXTLINE [readability-identifier-length]
-  auto constexpr format(Enum e, format_context &ctx) const {
-    return formatter<std::string_view>::format(mgutility::enum_name(e), ctx);
+  auto format(Enum e, FormatContext &ctx) const -> decltype(ctx.out()) {
+    if (m_spec.presentation == mgutility::detail::enum_presentation::value) {
+      return m_value.format(mgutility::to_underlying(e), ctx);
+    }
+    const auto name = mgutility::enum_name(e);
+    const auto view = static_cast<mgutility::string_view>(name);
+    if (m_spec.presentation == mgutility::detail::enum_presentation::quoted) {
+      return mgutility::detail::write_quoted(view, m_spec, ctx.out());
+    }
+    return m_name.format(std::string_view(view.data(), view.size()), ctx);
   }
+
+private:
+  std::formatter<std::string_view> m_name;
+  std::formatter<std::underlying_type_t<Enum>> m_value;
+  mgutility::detail::enum_format_spec m_spec;
 };
 
 #endif
@@ -219,17 +708,59 @@ struct std::formatter<Enum> : formatter<std::string_view> {
     (defined(MGUTILITY_HAS_HAS_INCLUDE) && __has_include(<fmt/format.h>))
 #include <fmt/format.h>
 
+/**
+ * @brief Formatter for enum types for use with fmt::format.
+ *
+ * Takes the same specs as the std::format one: `{}` and string specs format
+ * the name, integer specs ending in `d`, `x`, `X`, `o`, `b` or `B` the
+ * underlying value, and `{:q}` the quoted name. It works with FMT_COMPILE
+ * and fmt::format_to_n.
+ *
+ * @tparam Enum The enum type.
+ */
 template <class Enum>
 struct fmt::formatter<Enum, char,
                       // NOLINTNEXTLINE [modernize-type-traits]
-                      mgutility::detail::enable_if_t<std::is_enum<Enum>::value>>
-    : formatter<string_view> {
+                      mgutility::detail::enable_if_t<std::is_enum<Enum>::value>> {
+  template <typename ParseContext>
+  FMT_CONSTEXPR auto parse(ParseContext &ctx) -> decltype(ctx.begin()) {
+    const auto last = mgutility::detail::find_spec_end(ctx.begin(), ctx.end());
+    m_spec.presentation =
+        mgutility::detail::enum_presentation_of(ctx.begin(), last);
+    switch (m_spec.presentation) {
+    case mgutility::detail::enum_presentation::value:
+      return m_value.parse(ctx);
+    case mgutility::detail::enum_presentation::quoted:
+      if (!mgutility::detail::parse_quoted_spec(ctx.begin(), last, m_spec)) {
+        FMT_THROW(format_error("Invalid format spec for a quoted enum name!"));
+      }
+      return last;
+    default:
+      return m_name.parse(ctx);
+    }
+  }
+
+  template <typename FormatContext>
   // NOLINTNEXTLINE [readability-identifier-length]
-  auto format(const Enum e, format_context &ctx) const -> appender {
-    return formatter<string_view>::format(
-        static_cast<mgutility::string_view>(mgutility::enum_name(e)).data(),
-        ctx);
+  auto format(const Enum e, FormatContext &ctx) const -> decltype(ctx.out()) {
+    if (m_spec.presentation == mgutility::detail::enum_presentation::value) {
+      return m_value.format(mgutility::to_underlying(e), ctx);
+    }
+    const auto name = mgutility::enum_name(e);
+    const auto view = static_cast<mgutility::string_view>(name);
+    if (m_spec.presentation == mgutility::detail::enum_presentation::quoted) {
+      return mgutility::detail::write_quoted(view, m_spec, ctx.out());
+    }
+    return m_name.format(string_view(view.data(), view.size()), ctx);
   }
+
+private:
+  // NOLINTNEXTLINE [modernize-type-traits]
+  using underlying_type = typename std::underlying_type<Enum>::type;
+
+  formatter<string_view> m_name;
+  formatter<underlying_type> m_value;
+  mgutility::detail::enum_format_spec m_spec;
 };
 #endif // MGUTILITY_USE_FMT || __has_include(<fmt/format.h>)
 
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+"""
+Script to measure the compile-time cost of the enum_name library.
+
+Generates synthetic translation units with N enums of M values each, over
+several enum_range widths and C++ standards, compiles every unit and reports
+wall time, peak RSS and object size, both in total and per enum. Each
+configuration is compared against a unit that only includes the header, so
+the per-enum numbers exclude the fixed cost of parsing the library. With
+compilers that support it, -ftime-trace is passed and the trace files are
+kept next to the objects.
+
+Usage:
+    python3 scripts/compile_bench.py \
+        --compiler clang++ \
+        --include-dir include \
+        --include-dir mgutility/include \
+        --enums 1,16,64 --values 16,64 --ranges 128,256 --std 17,20 \
+        --json compile_bench.json
+"""
+
+import argparse
+import json
+import os
+import platform
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Dict, List, Optional
+
+
+HEADER = '#include "mgutility/reflection/enum_name.hpp"\n'
+
+
+def parse_list(text: str) -> List[int]:
+    """Parse a comma separated list of integers."""
+    return [int(item) for item in text.split(',') if item.strip()]
+
+
+def generate_unit(enums: int, values: int, width: int) -> str:
+    """Generate a translation unit with `enums` enums of `values` values.
+
+    Values are spread over the range [0, width) and every enum is used by
+    enum_name, to_enum and enum_for_each, so the whole reflection machinery
+    is instantiated.
+    """
+    step = max(1, width // max(1, values))
+    out = [HEADER, '\n#include <cstddef>\n\n']
+    for idx in range(enums):
+        names = ', '.join(
+            f'e{idx}_v{val} = {min(val * step, width - 1)}'
+            for val in range(values))
+        out.append(f'enum class e{idx} {{ {names} }};\n')
+        out.append(f'template <> struct mgutility::enum_range<e{idx}> {{\n'
+                   f'  static constexpr auto min = 0;\n'
+                   f'  static constexpr auto max = {width};\n'
+                   f'}};\n\n')
+
+    out.append('auto use_enums() -> std::size_t {\n')
+    out.append('  std::size_t total = 0;\n')
+    for idx in range(enums):
+        out.append(f'  total += mgutility::enum_name(e{idx}::e{idx}_v0).size();\n')
+        out.append(f'  total += mgutility::to_enum<e{idx}>("e{idx}_v0")'
+                   f'.has_value() ? 1 : 0;\n')
+        out.append(f'  for (auto &&pair : mgutility::enum_for_each<e{idx}>()) '
+                   f'{{\n'
+                   f'    total += static_cast<std::size_t>(pair.first);\n'
+                   f'  }}\n')
+    out.append('  return total;\n}\n')
+    return ''.join(out)
+
+
+def supports_time_trace(compiler: str) -> bool:
+    """Check whether the compiler accepts -ftime-trace."""
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, 'probe.cpp')
+        with open(source, 'w', encoding='utf-8') as f:
+            f.write('int main() { return 0; }\n')
+        result = subprocess.run(
+            [compiler, '-ftime-trace', '-c', source, '-o',
+             os.path.join(tmp, 'probe.o')],
+            capture_output=True, check=False)
+        return result.returncode == 0
+
+
+def compile_unit(compiler: str, flags: List[str], source: str,
+                 obj: str) -> Dict[str, float]:
+    """Compile one unit and return its wall time, peak RSS and object size.
+
+    The child is reaped with os.wait4 so that the peak RSS belongs to this
+    compilation alone.
+    """
+    start = time.perf_counter()
+    proc = subprocess.Popen([compiler] + flags + ['-c', source, '-o', obj],
+                            stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE)
+    stderr = proc.stderr.read() if proc.stderr else b''
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.perf_counter() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+        print(stderr.decode(errors='replace'), file=sys.stderr)
+        raise RuntimeError(f'compilation of {source} failed')
+
+    # ru_maxrss is in kilobytes on Linux and in bytes on macOS.
+    rss_kb = usage.ru_maxrss
+    if platform.system() == 'Darwin':
+        rss_kb //= 1024
+    return {
+        'wall_s': wall,
+        'peak_rss_kb': float(rss_kb),
+        'object_bytes': float(os.path.getsize(obj)),
+    }
+
+
+def best_of(repeat: int, compiler: str, flags: List[str], source: str,
+            obj: str) -> Dict[str, float]:
+    """Compile a unit `repeat` times, keeping the fastest run."""
+    best: Optional[Dict[str, float]] = None
+    for _ in range(repeat):
+        run = compile_unit(compiler, flags, source, obj)
+        if best is None or run['wall_s'] < best['wall_s']:
+            best = run
+    assert best is not None
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Measure the compile-time cost of enum_name."
+    )
+    parser.add_argument(
+        '--compiler',
+        default=os.environ.get('CXX', 'c++'),
+        help='C++ compiler to use (default: $CXX or c++)'
+    )
+    parser.add_argument(
+        '--include-dir',
+        required=True,
+        action='append',
+        dest='include_dirs',
+        help='Include directory passed to the compiler '
+             '(can be specified multiple times)'
+    )
+    parser.add_argument(
+        '--enums', type=parse_list, default=[1, 16, 64],
+        help='Comma separated enum counts per unit (default: 1,16,64)'
+    )
+    parser.add_argument(
+        '--values', type=parse_list, default=[16, 64],
+        help='Comma separated value counts per enum (default: 16,64)'
+    )
+    parser.add_argument(
+        '--ranges', type=parse_list, default=[128, 256],
+        help='Comma separated enum_range widths (default: 128,256)'
+    )
+    parser.add_argument(
+        '--std', type=parse_list, default=[11, 17, 20],
+        help='Comma separated C++ standards (default: 11,17,20)'
+    )
+    parser.add_argument(
+        '--flag', action='append', dest='flags', default=[],
+        help='Extra compiler flag (can be specified multiple times)'
+    )
+    parser.add_argument(
+        '--repeat', type=int, default=1,
+        help='Compile every unit this many times and keep the fastest run'
+    )
+    parser.add_argument(
+        '--work-dir',
+        help='Directory for the generated units, objects and time traces '
+             '(default: a temporary directory that is removed afterwards)'
+    )
+    parser.add_argument(
+        '--json',
+        help='Output file path for a JSON report'
+    )
+
+    args = parser.parse_args()
+
+    if shutil.which(args.compiler) is None:
+        print(f"Error: Compiler '{args.compiler}' not found.", file=sys.stderr)
+        sys.exit(1)
+
+    for inc in args.include_dirs:
+        if not os.path.isdir(inc):
+            print(f"Error: Include directory '{inc}' not found.",
+                  file=sys.stderr)
+            sys.exit(1)
+
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix='enum_name_cb_')
+    os.makedirs(work_dir, exist_ok=True)
+
+    time_trace = supports_time_trace(args.compiler)
+    base_flags = ['-O0'] + args.flags
+    base_flags += [f'-I{os.path.abspath(inc)}' for inc in args.include_dirs]
+
+    results = []
+    print(f"{'std':>4} {'width':>6} {'enums':>6} {'values':>7} "
+          f"{'wall s':>8} {'rss MB':>8} {'obj KB':>8} "
+          f"{'ms/enum':>8} {'KB/enum':>8}")
+    try:
+        for std in args.std:
+            flags = [f'-std=c++{std}'] + base_flags
+            if time_trace:
+                flags.append('-ftime-trace')
+
+            empty_source = os.path.join(work_dir, f'empty_cxx{std}.cpp')
+            with open(empty_source, 'w', encoding='utf-8') as f:
+                f.write(HEADER)
+            empty = best_of(args.repeat, args.compiler, flags, empty_source,
+                            empty_source[:-4] + '.o')
+
+            for width in args.ranges:
+                for values in args.values:
+                    if values > width:
+                        continue
+                    for enums in args.enums:
+                        stem = f'cxx{std}_w{width}_v{values}_n{enums}'
+                        source = os.path.join(work_dir, stem + '.cpp')
+                        with open(source, 'w', encoding='utf-8') as f:
+                            f.write(generate_unit(enums, values, width))
+                        run = best_of(args.repeat, args.compiler, flags,
+                                      source, source[:-4] + '.o')
+
+                        ms_per_enum = 1000.0 * max(
+                            0.0, run['wall_s'] - empty['wall_s']) / enums
+                        kb_per_enum = max(
+                            0.0, run['object_bytes'] -
+                            empty['object_bytes']) / 1024.0 / enums
+                        entry = {
+                            'std': std,
+                            'range_width': width,
+                            'enums': enums,
+                            'values': values,
+                            'ms_per_enum': ms_per_enum,
+                            'object_kb_per_enum': kb_per_enum,
+                            'header_wall_s': empty['wall_s'],
+                        }
+                        entry.update(run)
+                        if time_trace:
+                            entry['time_trace'] = source[:-4] + '.json'
+                        results.append(entry)
+
+                        print(f"{std:>4} {width:>6} {enums:>6} {values:>7} "
+                              f"{run['wall_s']:>8.2f} "
+                              f"{run['peak_rss_kb'] / 1024.0:>8.1f} "
+                              f"{run['object_bytes'] / 1024.0:>8.1f} "
+                              f"{ms_per_enum:>8.1f} {kb_per_enum:>8.2f}")
+    except RuntimeError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+    finally:
+        if not args.work_dir:
+            shutil.rmtree(work_dir, ignore_errors=True)
+
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump({
+                'compiler': args.compiler,
+                'flags': base_flags,
+                'time_trace': time_trace,
+                'results': results,
+            }, f, indent=2)
+            f.write('\n')
+        print(f"Report written to: {args.json}")
+
+    if time_trace and args.work_dir:
+        print(f"Time traces written to: {args.work_dir}")
+
+
+if __name__ == '__main__':
+    main()
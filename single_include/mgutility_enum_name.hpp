@@ -49,37 +49,8 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
-#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_IMPL_HPP
-#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_IMPL_HPP
-
-// NOLINTNEXTLINE [unused-includes]
-
-/*
-MIT License
-
-Copyright (c) 2024 mguludag
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef DETAIL_ENUM_FOR_EACH_HPP
-#define DETAIL_ENUM_FOR_EACH_HPP
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_FORMAT_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_FORMAT_HPP
 
 /*
 MIT License
@@ -308,6 +279,9 @@ using make_index_sequence = typename make_index_sequence_impl<N>::type;
 } // namespace mgutility
 
 #endif // DETAIL_META_HPP
+#include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <type_traits>
 #include <utility>
@@ -335,27 +309,40 @@ namespace detail {
 #define MGUTILITY_ENUM_RANGE_MAX 256
 #endif
 
+#ifndef MGUTILITY_ENUM_PROBE_CHUNK
 /**
- * @brief Defines the MGUTILITY_ENUM_NAME_BUFFER_SIZE macro.
+ * @brief Defines the MGUTILITY_ENUM_PROBE_CHUNK macro.
  *
- * This macro defines the size of the buffer used for enum names.
+ * This macro defines how many values of an enum range are reflected by a
+ * single probe function. Wider ranges are split into chunks of this size, so
+ * the compiler never builds a signature longer than one chunk. Default is
+ * 256, which keeps the default range in one chunk.
  */
-#ifndef MGUTILITY_ENUM_NAME_BUFFER_SIZE
 // NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
-#define MGUTILITY_ENUM_NAME_BUFFER_SIZE 32U
+#define MGUTILITY_ENUM_PROBE_CHUNK 256
+#endif
+
+#ifndef MGUTILITY_ENUM_NAME_PADDED_SLOTS
+/**
+ * @brief Defines the MGUTILITY_ENUM_NAME_PADDED_SLOTS macro.
+ *
+ * This macro enables an additional name layout for to_enum: every name of at
+ * most this many bytes is zero-padded into a slot of its own, so a lookup is
+ * one word hash and one vector compare instead of a byte-wise hash and
+ * memcmp. Valid values are 16 and 32; 0, the default, disables the layout.
+ */
+// NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
+#define MGUTILITY_ENUM_NAME_PADDED_SLOTS 0
 #endif
 
 /**
- * @brief Defines the MGUTILITY_GLOBAL_ENUM_BLOB_SIZE macro.
+ * @brief Defines the MGUTILITY_ENUM_NAME_BUFFER_SIZE macro.
  *
- * This macro defines the size of the global fixed-size buffer shared by
- * all enum types in enum_name_parse_result. All enum names for all enums
- * with the same underlying type are stored in this shared buffer, reducing
- * template bloat compared to per-type fixed_string instantiations.
+ * This macro defines the size of the buffer used for enum names.
  */
-#ifndef MGUTILITY_GLOBAL_ENUM_BLOB_SIZE
+#ifndef MGUTILITY_ENUM_NAME_BUFFER_SIZE
 // NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
-#define MGUTILITY_GLOBAL_ENUM_BLOB_SIZE 8192
+#define MGUTILITY_ENUM_NAME_BUFFER_SIZE 32U
 #endif
 
 #ifndef MGUTILITY_INLINE
@@ -441,6 +428,81 @@ template <typename T>
 // NOLINTNEXTLINE [modernize-type-traits]
 using remove_const_t = typename std::remove_const<T>::type;
 
+/**
+ * @brief Alias template for the smallest unsigned integer type that can hold
+ * a value.
+ *
+ * @tparam N The largest value to hold.
+ */
+template <std::size_t N>
+// NOLINTNEXTLINE [modernize-type-traits]
+using uint_fit_t = typename std::conditional<
+    (N <= 0xFFU), std::uint8_t,
+    // NOLINTNEXTLINE [modernize-type-traits]
+    typename std::conditional<(N <= 0xFFFFU), std::uint16_t,
+                              std::uint32_t>::type>::type;
+
+/**
+ * @brief A fixed-size array whose elements can be assigned in a constant
+ * expression, which std::array only allows from C++17 on.
+ *
+ * @tparam T The element type.
+ * @tparam N The number of elements.
+ */
+template <typename T, std::size_t N> struct constant_array {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  T items[N == 0 ? 1 : N]; /**< The elements. */
+
+  static constexpr auto size() noexcept -> std::size_t { return N; }
+
+  MGUTILITY_CNSTXPR auto operator[](std::size_t idx) noexcept -> T & {
+    return items[idx];
+  }
+
+  constexpr auto operator[](std::size_t idx) const noexcept -> const T & {
+    return items[idx];
+  }
+};
+
+#if defined(__clang__) || defined(_MSC_VER)
+/**
+ * @brief Adapts the integer sequence built by __make_integer_seq to an
+ * index_sequence.
+ *
+ * @tparam T The integer type.
+ * @tparam I The integers.
+ */
+template <typename T, T... I> struct probe_index_sequence {
+  using type = index_sequence<static_cast<std::size_t>(I)...>;
+};
+
+/**
+ * @brief Alias for an index sequence of size N built by the compiler
+ * intrinsic, without recursive instantiations.
+ *
+ * @tparam N The size of the index sequence.
+ */
+template <std::size_t N>
+using make_probe_sequence =
+    typename __make_integer_seq<probe_index_sequence, std::size_t, N>::type;
+#elif defined(__GNUC__)
+/**
+ * @brief Alias for an index sequence of size N built by the compiler
+ * intrinsic, without recursive instantiations.
+ *
+ * @tparam N The size of the index sequence.
+ */
+template <std::size_t N>
+using make_probe_sequence = index_sequence<__integer_pack(N)...>;
+#else
+/**
+ * @brief Alias for an index sequence of size N.
+ *
+ * @tparam N The size of the index sequence.
+ */
+template <std::size_t N> using make_probe_sequence = make_index_sequence<N>;
+#endif
+
 /**
  * @brief Represents a sequence of enumeration values.
  *
@@ -487,7 +549,101 @@ public:
 template <typename Enum, int Min, int Max>
 using make_enum_sequence = typename enum_sequence_from_index<
     Enum, Min,
-    make_index_sequence<static_cast<std::size_t>(Max - Min + 1)>>::type;
+    make_probe_sequence<static_cast<std::size_t>(Max - Min + 1)>>::type;
+
+/**
+ * @brief Alias template for the unsigned counterpart of an enum's underlying
+ * type.
+ *
+ * @tparam Enum The enumeration type.
+ */
+template <typename Enum>
+// NOLINTNEXTLINE [modernize-type-traits]
+using flag_type_t = typename std::make_unsigned<underlying_type_t<Enum>>::type;
+
+/**
+ * @brief Gets the number of bits of an enum's underlying type.
+ *
+ * @tparam Enum The enumeration type.
+ * @return The number of single-bit flags the enum can hold.
+ */
+template <typename Enum> constexpr auto flag_bits() noexcept -> std::size_t {
+  return sizeof(underlying_type_t<Enum>) * CHAR_BIT;
+}
+
+/**
+ * @brief Counts the trailing zero bits of a value.
+ *
+ * @param value The value, must not be zero.
+ * @return The index of the lowest set bit.
+ */
+constexpr auto count_trailing_zeros(std::uint64_t value) noexcept
+    -> std::size_t {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctzll(value));
+#else
+  return (value & 1U) != 0 ? 0 : 1 + count_trailing_zeros(value >> 1U);
+#endif
+}
+
+/**
+ * @brief Counts the set bits of a value.
+ *
+ * @param value The value.
+ * @return The number of set bits.
+ */
+constexpr auto count_bits(std::uint64_t value) noexcept -> std::size_t {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(value));
+#else
+  return value == 0 ? 0 : 1 + count_bits(value & (value - 1));
+#endif
+}
+
+/**
+ * @brief Helper for creating the flag probe sequence of an enum.
+ *
+ * @tparam Enum The enumeration type.
+ * @tparam Seq The index sequence of the bit positions.
+ */
+template <typename Enum, typename Seq> struct enum_sequence_from_bits;
+
+/**
+ * @brief Specialization for creating the flag probe sequence from bit
+ * positions.
+ *
+ * The sequence is 0, every single bit of the underlying type in ascending
+ * order, and a trailing 0 so that every probed value is followed by a
+ * separator.
+ *
+ * @tparam Enum The enumeration type.
+ * @tparam I The bit positions.
+ */
+template <typename Enum, std::size_t... I>
+struct enum_sequence_from_bits<Enum, index_sequence<I...>> {
+private:
+  // NOLINTNEXTLINE [readability-identifier-length]
+  static constexpr auto bit(std::size_t i) -> underlying_type_t<Enum> {
+    return static_cast<underlying_type_t<Enum>>(
+        static_cast<flag_type_t<Enum>>(static_cast<flag_type_t<Enum>>(1U)
+                                       << i));
+  }
+
+public:
+  using type =
+      enum_sequence<Enum, static_cast<Enum>(0), static_cast<Enum>(bit(I))...,
+                    static_cast<Enum>(0)>;
+};
+
+/**
+ * @brief Alias for the flag probe sequence of an enum: 0 and each single bit
+ * of its underlying type.
+ *
+ * @tparam Enum The enumeration type.
+ */
+template <typename Enum>
+using make_flag_sequence = typename enum_sequence_from_bits<
+    Enum, make_probe_sequence<flag_bits<Enum>()>>::type;
 } // namespace detail
 
 /**
@@ -528,6 +684,46 @@ template <typename T> struct custom_enum {
   // #endif
 };
 
+/**
+ * @brief Marks an enumeration type as a set of single-bit flags.
+ *
+ * Specialize with `static constexpr bool value = true;` to reflect the enum
+ * by probing 0 and each bit of its underlying type instead of enum_range.
+ * Names are then stored per bit position, so flags up to the full width of
+ * the underlying type (e.g. `1ULL << 63`) can be reflected with at most 65
+ * probes. The enum must have a fixed underlying type.
+ *
+ * @tparam T The enumeration type.
+ */
+template <typename T> struct enum_flags {
+  static constexpr auto value = false;
+};
+
+/**
+ * @brief Marks an enumeration type whose names can be overridden at runtime.
+ *
+ * Specialize with `static constexpr bool value = true;` to have enum_name look
+ * a value up in the overlay published with publish_enum_overlay() before the
+ * reflected names. Reading the overlay is one atomic load, but it makes
+ * enum_name of the type a runtime call.
+ *
+ * @tparam T The enumeration type.
+ */
+template <typename T> struct enum_name_overlay {
+  static constexpr auto value = false;
+};
+
+/**
+ * @brief Tag type that selects the case-insensitive to_enum overloads.
+ */
+struct case_insensitive_t {};
+
+/**
+ * @brief Makes to_enum ignore ASCII case, e.g.
+ * `to_enum<Color>("RED", mgutility::case_insensitive)`.
+ */
+MGUTILITY_INLINE constexpr case_insensitive_t case_insensitive{};
+
 /**
  * @brief Provides the name buffer size for an enumeration type.
  *
@@ -543,33 +739,6 @@ template <typename T> struct enum_name_buffer {
 /*
 MIT License
 
-Copyright (c) 2025 mguludag
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-#ifndef MGUTILITY_FIXED_STRING_HPP
-#define MGUTILITY_FIXED_STRING_HPP
-
-/*
-MIT License
-
 Copyright (c) 2024 mguludag
 
 Permission is hereby granted, free of charge, to any person obtaining a copy
@@ -975,43 +1144,302 @@ using string_view = std::string_view;
 
 #endif // STRING_STRING_VIEW_HPP
 
+#include <cstddef>
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
 namespace mgutility {
+namespace detail {
 
-template <size_t N = 0> class fixed_string {
-  template <size_t> friend class fixed_string;
+/**
+ * @brief How an enum formatter writes a value.
+ */
+enum class enum_presentation : char {
+  name,   /**< `{}` or `{:...s}`: the name, through the string formatter. */
+  quoted, /**< `{:...q}`: the name in double quotes. */
+  value   /**< `{:...d}`, `x`, `X`, `o`, `b` or `B`: the underlying value. */
+};
 
-public:
-  template <size_t M>
-  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
-  MGUTILITY_CNSTXPR static auto make(const char (&str)[M]) -> fixed_string<M> {
-    return fixed_string<M>{str};
+/**
+ * @brief The format spec of an enum formatter.
+ *
+ * The fill, alignment and width are only kept for quoted output; the other
+ * presentations hand the spec to the formatter of the name or the value.
+ */
+struct enum_format_spec {
+  enum_presentation presentation{enum_presentation::name};
+  char fill{' '};        /**< The fill character. */
+  char align{'<'};       /**< '<', '^' or '>'. */
+  std::size_t width{};   /**< The minimum width, 0 for none. */
+};
+
+/**
+ * @brief Finds the end of a format spec, skipping nested replacement fields
+ * such as `{:{}}`.
+ *
+ * @param begin The start of the spec.
+ * @param end The end of the format string.
+ * @return The position of the closing '}', or end.
+ */
+template <typename It>
+MGUTILITY_CNSTXPR auto find_spec_end(It begin, It end) noexcept -> It {
+  std::size_t depth = 0;
+  for (; begin != end; ++begin) {
+    if (*begin == '{') {
+      ++depth;
+    } else if (*begin == '}') {
+      if (depth == 0) {
+        return begin;
+      }
+      --depth;
+    }
   }
+  return begin;
+}
 
-  MGUTILITY_CNSTXPR fixed_string() = default;
+/**
+ * @brief Picks the presentation of a format spec from its type character.
+ *
+ * @param begin The start of the spec.
+ * @param last The position of the closing '}'.
+ * @return The presentation.
+ */
+template <typename It>
+MGUTILITY_CNSTXPR auto enum_presentation_of(It begin, It last) noexcept
+    -> enum_presentation {
+  if (begin == last) {
+    return enum_presentation::name;
+  }
+  auto type = last;
+  --type;
+  switch (*type) {
+  case 'd':
+  case 'x':
+  case 'X':
+  case 'o':
+  case 'b':
+  case 'B':
+    return enum_presentation::value;
+  case 'q':
+    return enum_presentation::quoted;
+  default:
+    return enum_presentation::name;
+  }
+}
 
-  // --- safe pack expansion (no OOB) ---
-  template <std::size_t M, std::size_t... Is>
-  constexpr fixed_string(const char (&str)[M], detail::index_sequence<Is...>)
-      : data_{(Is < M ? str[Is] : '\0')...}, cursor_(M ? M - 1 : 0) {}
+/**
+ * @brief Checks whether a character is a format alignment.
+ *
+ * @param chr The character.
+ * @return True for '<', '^' and '>', otherwise false.
+ */
+constexpr auto is_format_align(char chr) noexcept -> bool {
+  return chr == '<' || chr == '^' || chr == '>';
+}
 
-  // single literal constructor (handles all M)
-  template <std::size_t M>
-  constexpr fixed_string(const char (&str)[M])
-      : fixed_string(str, typename detail::make_index_sequence<N>{}) {}
+/**
+ * @brief Parses the `[[fill]align][width]q` spec of quoted output.
+ *
+ * @param begin The start of the spec.
+ * @param last The position of the closing '}'.
+ * @param spec The spec to fill in.
+ * @return True if the spec is valid, otherwise false.
+ */
+template <typename It>
+MGUTILITY_CNSTXPR auto parse_quoted_spec(It begin, It last,
+                                         enum_format_spec &spec) noexcept
+    -> bool {
+  --last; // the 'q'
+  auto next = begin;
+  if (next != last) {
+    ++next;
+  }
+  if (begin != last && next != last && is_format_align(*next)) {
+    spec.fill = *begin;
+    spec.align = *next;
+    begin = ++next;
+  } else if (begin != last && is_format_align(*begin)) {
+    spec.align = *begin;
+    ++begin;
+  }
+  for (; begin != last && *begin >= '0' && *begin <= '9'; ++begin) {
+    spec.width = spec.width * 10 + static_cast<std::size_t>(*begin - '0');
+  }
+  return begin == last;
+}
 
-  MGUTILITY_CNSTXPR fixed_string(const char *str, std::size_t len)
-      : data_{}, cursor_(len < N ? len
-                         : N     ? N - 1
-                                 : 0) {
-    for (std::size_t i = 0; i < N; ++i) {
-      data_[i] = (i < len) ? str[i] : '\0';
+/**
+ * @brief Writes fill characters.
+ *
+ * @param out The output iterator.
+ * @param fill The fill character.
+ * @param count The number of characters.
+ * @return The output iterator past the fill.
+ */
+template <typename OutputIt>
+auto write_fill(OutputIt out, char fill, std::size_t count) -> OutputIt {
+  for (; count > 0; --count) {
+    *out++ = fill;
+  }
+  return out;
+}
+
+/**
+ * @brief Writes a name in double quotes, escaping quotes and backslashes,
+ * padded as the spec says.
+ *
+ * @param name The name.
+ * @param spec The spec.
+ * @param out The output iterator.
+ * @return The output iterator past the name.
+ */
+template <typename OutputIt>
+auto write_quoted(mgutility::string_view name, const enum_format_spec &spec,
+                  OutputIt out) -> OutputIt {
+  auto size = name.size() + 2;
+  for (std::size_t idx = 0; idx < name.size(); ++idx) {
+    size += name[idx] == '"' || name[idx] == '\\' ? 1 : 0;
+  }
+  const auto pad = spec.width > size ? spec.width - size : 0;
+  const auto before =
+      spec.align == '>' ? pad : spec.align == '^' ? pad / 2 : 0;
+
+  out = write_fill(out, spec.fill, before);
+  *out++ = '"';
+  for (std::size_t idx = 0; idx < name.size(); ++idx) {
+    if (name[idx] == '"' || name[idx] == '\\') {
+      *out++ = '\\';
     }
+    *out++ = name[idx];
   }
+  *out++ = '"';
+  return write_fill(out, spec.fill, pad - before);
+}
 
-  MGUTILITY_CNSTXPR fixed_string(mgutility::string_view str)
-      : fixed_string(str.data(), str.size()) {}
+} // namespace detail
+} // namespace mgutility
 
-  // Constructor to initialize from a string literal
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_FORMAT_HPP
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_IMPL_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_IMPL_HPP
+
+// NOLINTNEXTLINE [unused-includes]
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef DETAIL_ENUM_FOR_EACH_HPP
+#define DETAIL_ENUM_FOR_EACH_HPP
+
+/*
+MIT License
+
+Copyright (c) 2025 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_FIXED_STRING_HPP
+#define MGUTILITY_FIXED_STRING_HPP
+
+namespace mgutility {
+
+template <size_t N = 0> class fixed_string {
+  template <size_t> friend class fixed_string;
+
+public:
+  template <size_t M>
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  MGUTILITY_CNSTXPR static auto make(const char (&str)[M]) -> fixed_string<M> {
+    return fixed_string<M>{str};
+  }
+
+  MGUTILITY_CNSTXPR fixed_string() = default;
+
+  // --- safe pack expansion (no OOB) ---
+  template <std::size_t M, std::size_t... Is>
+  constexpr fixed_string(const char (&str)[M], detail::index_sequence<Is...>)
+      : data_{(Is < M ? str[Is] : '\0')...}, cursor_(M ? M - 1 : 0) {}
+
+  // single literal constructor (handles all M)
+  template <std::size_t M>
+  constexpr fixed_string(const char (&str)[M])
+      : fixed_string(str, typename detail::make_index_sequence<N>{}) {}
+
+  MGUTILITY_CNSTXPR fixed_string(const char *str, std::size_t len)
+      : data_{}, cursor_(len < N ? len
+                         : N     ? N - 1
+                                 : 0) {
+    for (std::size_t i = 0; i < N; ++i) {
+      data_[i] = (i < len) ? str[i] : '\0';
+    }
+  }
+
+  MGUTILITY_CNSTXPR fixed_string(mgutility::string_view str)
+      : fixed_string(str.data(), str.size()) {}
+
+  // Constructor to initialize from a string literal
   // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
   MGUTILITY_CNSTXPR explicit fixed_string(const char (&str)[N]) {
     for (size_t i = 0; i < N - 1; ++i) {
@@ -1168,7 +1596,9 @@ struct fmt::formatter<mgutility::fixed_string<N>> : formatter<string_view> {
 #endif // MGUTILITY_FIXED_STRING_HPP
 
 // NOLINTNEXTLINE [unused-includes]
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <utility>
 
 namespace mgutility {
@@ -1178,15 +1608,16 @@ namespace detail {
  * @brief Alias template for a string or string view type based on the presence
  * of a bitwise OR operator.
  *
- * If the type T supports the bitwise OR operator, the alias is a std::string.
- * Otherwise, it is a mgutility::string_view.
+ * If the type T supports the bitwise OR operator or is marked as enum_flags,
+ * the alias is a fixed_string. Otherwise, it is a mgutility::string_view.
  *
  * @tparam T The type to check.
  */
 template <typename T>
 // NOLINTNEXTLINE [modernize-type-traits]
 using string_or_view_t = typename std::conditional<
-    has_bit_or<T>::value, mgutility::fixed_string<enum_name_buffer<T>::size>,
+    has_bit_or<T>::value || enum_flags<T>::value,
+    mgutility::fixed_string<enum_name_buffer<T>::size>,
     mgutility::string_view>::type;
 
 /**
@@ -1202,43 +1633,45 @@ using enum_pair = std::pair<Enum, detail::string_or_view_t<Enum>>;
 /**
  * @brief A class template for iterating over enum values.
  *
+ * Only the named values are visited, in ascending order; they come from a
+ * list built with the name table, so iteration costs one step per
+ * enumerator whatever the width of enum_range<Enum>.
+ *
  * @tparam Enum The enum type.
  */
 template <typename Enum> class enum_for_each {
-  using value_type = const detail::enum_pair<Enum>;
+  using value_type = detail::enum_pair<Enum>;
   using size_type = std::size_t;
 
   /**
-   * @brief An iterator for enum values.
+   * @brief A random access iterator over the named enum values.
    */
   struct enum_iter {
-    using const_iter_type = int;
-    using iter_type = detail::remove_const_t<const_iter_type>;
-    using iterator_category = std::forward_iterator_tag;
-    using value_type = const detail::enum_pair<Enum>;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = detail::enum_pair<Enum>;
     using difference_type = std::ptrdiff_t;
-    using pointer = value_type *;
-    using reference = value_type &;
+    using pointer = void;
+    using reference = value_type;
 
     /**
      * @brief Default constructor initializing the iterator to the default
      * position.
      */
-    enum_iter() : m_pos{} {}
+    constexpr enum_iter() noexcept : m_pos{} {}
 
     /**
      * @brief Constructor initializing the iterator to a specific position.
      *
-     * @param value The initial position of the iterator.
+     * @param pos The position among the named values.
      */
-    explicit enum_iter(iter_type value) : m_pos{value} {}
+    constexpr explicit enum_iter(difference_type pos) noexcept : m_pos{pos} {}
 
     /**
      * @brief Pre-increment operator.
      *
      * @return A reference to the incremented iterator.
      */
-    auto operator++() -> enum_iter & {
+    MGUTILITY_CNSTXPR auto operator++() noexcept -> enum_iter & {
       ++m_pos;
       return *this;
     }
@@ -1248,29 +1681,167 @@ template <typename Enum> class enum_for_each {
      *
      * @return A copy of the iterator before incrementing.
      */
-    auto operator++(int) -> enum_iter {
-      m_pos++;
+    MGUTILITY_CNSTXPR auto operator++(int) noexcept -> enum_iter {
+      auto prev = *this;
+      ++m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Pre-decrement operator.
+     *
+     * @return A reference to the decremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator--() noexcept -> enum_iter & {
+      --m_pos;
+      return *this;
+    }
+
+    /**
+     * @brief Post-decrement operator.
+     *
+     * @return A copy of the iterator before decrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator--(int) noexcept -> enum_iter {
+      auto prev = *this;
+      --m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Advances the iterator.
+     *
+     * @param offset The number of values to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator+=(difference_type offset) noexcept
+        -> enum_iter & {
+      m_pos += offset;
+      return *this;
+    }
+
+    /**
+     * @brief Moves the iterator back.
+     *
+     * @param offset The number of values to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator-=(difference_type offset) noexcept
+        -> enum_iter & {
+      m_pos -= offset;
       return *this;
     }
 
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param iter The iterator.
+     * @param offset The number of values to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(const enum_iter &iter,
+                                    difference_type offset) noexcept
+        -> enum_iter {
+      return enum_iter{iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param offset The number of values to move by.
+     * @param iter The iterator.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(difference_type offset,
+                                    const enum_iter &iter) noexcept
+        -> enum_iter {
+      return enum_iter{iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets a copy of an iterator moved back.
+     *
+     * @param iter The iterator.
+     * @param offset The number of values to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator-(const enum_iter &iter,
+                                    difference_type offset) noexcept
+        -> enum_iter {
+      return enum_iter{iter.m_pos - offset};
+    }
+
+    /**
+     * @brief Gets the distance between two iterators.
+     *
+     * @param lhs The later iterator.
+     * @param rhs The earlier iterator.
+     * @return The number of values between the iterators.
+     */
+    friend constexpr auto operator-(const enum_iter &lhs,
+                                    const enum_iter &rhs) noexcept
+        -> difference_type {
+      return lhs.m_pos - rhs.m_pos;
+    }
+
+    /**
+     * @brief Equality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are equal, otherwise false.
+     */
+    constexpr auto operator==(const enum_iter &other) const noexcept -> bool {
+      return m_pos == other.m_pos;
+    }
+
     /**
      * @brief Inequality comparison operator.
      *
      * @param other The other iterator to compare with.
      * @return True if the iterators are not equal, otherwise false.
      */
-    auto operator!=(const enum_iter &other) const -> bool {
+    constexpr auto operator!=(const enum_iter &other) const noexcept -> bool {
       return m_pos != other.m_pos;
     }
 
     /**
-     * @brief Equality comparison operator.
+     * @brief Less-than comparison operator.
      *
      * @param other The other iterator to compare with.
-     * @return True if the iterators are equal, otherwise false.
+     * @return True if this iterator comes first, otherwise false.
      */
-    auto operator==(const enum_iter &other) const -> bool {
-      return m_pos == other.m_pos;
+    constexpr auto operator<(const enum_iter &other) const noexcept -> bool {
+      return m_pos < other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator comes last, otherwise false.
+     */
+    constexpr auto operator>(const enum_iter &other) const noexcept -> bool {
+      return m_pos > other.m_pos;
+    }
+
+    /**
+     * @brief Less-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come last, otherwise false.
+     */
+    constexpr auto operator<=(const enum_iter &other) const noexcept -> bool {
+      return m_pos <= other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come first, otherwise false.
+     */
+    constexpr auto operator>=(const enum_iter &other) const noexcept -> bool {
+      return m_pos >= other.m_pos;
     }
 
     /**
@@ -1278,47 +1849,74 @@ template <typename Enum> class enum_for_each {
      *
      * @return The current enum pair.
      */
-    auto operator*() const -> value_type;
+    MGUTILITY_CNSTXPR auto operator*() const noexcept -> value_type;
+
+    /**
+     * @brief Subscript operator.
+     *
+     * @param offset The offset from the current position.
+     * @return The enum pair at that offset.
+     */
+    MGUTILITY_CNSTXPR auto operator[](difference_type offset) const noexcept
+        -> value_type {
+      return *(*this + offset);
+    }
 
   private:
-    iter_type m_pos; /**< The current position of the iterator. */
+    difference_type m_pos; /**< The position among the named values. */
   };
 
 public:
+  using iterator = enum_iter;
+  using const_iterator = enum_iter;
+
   /**
    * @brief Default constructor.
    */
-  enum_for_each() = default;
+  constexpr enum_for_each() noexcept = default;
+
+  /**
+   * @brief Returns an iterator to the first named value.
+   *
+   * @return The beginning iterator.
+   */
+  constexpr auto begin() const noexcept -> enum_iter { return enum_iter{}; }
 
   /**
-   * @brief Returns an iterator to the beginning of the enum range.
+   * @brief Returns an iterator past the last named value.
    *
-   * @return A reference to the beginning iterator.
+   * @return The end iterator.
    */
-  auto begin() -> enum_iter & { return m_begin; }
+  MGUTILITY_CNSTXPR auto end() const noexcept -> enum_iter {
+    return enum_iter{static_cast<typename enum_iter::difference_type>(size())};
+  }
 
   /**
-   * @brief Returns an iterator to the end of the enum range.
+   * @brief Returns the number of named values.
    *
-   * @return A reference to the end iterator.
+   * @return The number of named values.
    */
-  auto end() -> enum_iter & { return m_end; }
+  MGUTILITY_CNSTXPR auto size() const noexcept -> size_type;
 
   /**
-   * @brief Returns the size of the enum range.
+   * @brief Checks whether the enum has no named values.
    *
-   * @return The size of the enum range.
+   * @return True if there is no named value, otherwise false.
    */
-  auto size() -> std::size_t {
-    return static_cast<int>(enum_range<Enum>::max) -
-           static_cast<int>(enum_range<Enum>::min) + 1;
+  MGUTILITY_CNSTXPR auto empty() const noexcept -> bool {
+    return size() == 0;
   }
 
-private:
-  enum_iter m_begin{
-      static_cast<int>(enum_range<Enum>::min)}; /**< The beginning iterator. */
-  enum_iter m_end{static_cast<int>(enum_range<Enum>::max) +
-                  1}; /**< The end iterator. */
+  /**
+   * @brief Gets a named value and its name.
+   *
+   * @param idx The position of the value, in ascending order.
+   * @return The enum pair.
+   */
+  MGUTILITY_CNSTXPR auto operator[](size_type idx) const noexcept
+      -> value_type {
+    return begin()[static_cast<typename enum_iter::difference_type>(idx)];
+  }
 };
 } // namespace mgutility
 
@@ -1347,928 +1945,7393 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
-#ifndef DETAIL_OPTIONAL_HPP
-#define DETAIL_OPTIONAL_HPP
-
-// NOLINTNEXTLINE [unused-includes]
-
-// NOLINTNEXTLINE [unused-includes]
-#include <exception>
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_HASH_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_HASH_HPP
 
-#if MGUTILITY_CPLUSPLUS >= 201703L
-#include <optional>
-#endif
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
 namespace mgutility {
-
-#if MGUTILITY_CPLUSPLUS < 201703L
+namespace detail {
 
 /**
- * @brief Exception thrown when accessing an empty optional.
+ * @brief The initial value of the FNV-1a name hash.
  */
-struct bad_optional_access : public std::exception {
-  /**
-   * @brief Returns the exception message.
-   *
-   * @return A C-string with the exception message.
-   */
-  const char *what() const noexcept override { return "optional has no value"; }
-};
-
-struct nullopt_t;
+constexpr std::uint64_t name_hash_seed = 0xcbf29ce484222325ULL;
 
 /**
- * @brief A class template that provides optional (nullable) objects.
+ * @brief Feeds one character into the FNV-1a name hash.
  *
- * @tparam T The type of the value.
+ * Lets a parser hash a name while it scans for the end of it.
+ *
+ * @param hash The hash of the characters before.
+ * @param chr The next character.
+ * @return The hash including the character.
  */
-template <typename T> class optional {
-public:
-  /**
-   * @brief Constructs an empty optional.
-   */
-  MGUTILITY_CNSTXPR inline explicit optional(nullopt_t & /*unused*/)
-      : dummy_{0}, has_value_{false} {}
+constexpr auto name_hash_step(std::uint64_t hash, char chr) noexcept
+    -> std::uint64_t {
+  return (hash ^ static_cast<unsigned char>(chr)) * 0x100000001b3ULL;
+}
 
-  /**
-   * @brief Constructs an empty optional.
-   */
-  MGUTILITY_CNSTXPR inline optional() : dummy_{0}, has_value_{false} {}
-
-  /**
-   * @brief Constructs an optional with a value.
-   *
-   * @tparam Args The types of the arguments.
-   * @param args The arguments to construct the value.
-   */
-  template <typename... Args>
-  MGUTILITY_CNSTXPR inline explicit optional(Args &&...args)
-      : value_{T{std::forward<Args>(args)...}}, has_value_{true} {}
-
-  /**
-   * @brief Constructs an optional with a value.
-   *
-   * @param value The value to initialize with.
-   */
-  MGUTILITY_CNSTXPR inline explicit optional(T &&value)
-      : value_{std::move(value)}, has_value_{true} {}
+/**
+ * @brief Computes the 64-bit FNV-1a hash of a name.
+ *
+ * This is the only pass over the input bytes during a name lookup; both the
+ * bucket and the final table position are derived from this value.
+ *
+ * @param str The name to hash.
+ * @return The hash value.
+ */
+MGUTILITY_CNSTXPR inline auto name_hash(mgutility::string_view str) noexcept
+    -> std::uint64_t {
+  std::uint64_t hash = name_hash_seed;
+  for (std::size_t i = 0; i < str.size(); ++i) {
+    hash = name_hash_step(hash, str[i]);
+  }
+  return hash;
+}
 
-  /**
-   * @brief Copy constructor.
-   *
-   * @param other The other optional to copy.
-   */
-  MGUTILITY_CNSTXPR inline optional(const optional &other)
-      : value_{other.value_}, has_value_{other.has_value_} {}
+/**
+ * @brief Defines MGUTILITY_IS_CONSTANT_EVALUATED() where the compiler can
+ * tell constant evaluation apart, so memcmp and vector code stay out of
+ * constant evaluation.
+ */
+#if MGUTILITY_CPLUSPLUS == 201103L
+#define MGUTILITY_IS_CONSTANT_EVALUATED() false
+#elif (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) ||           \
+    (defined(__clang__) && __clang_major__ >= 9) ||                            \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define MGUTILITY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
 
-  /**
-   * @brief Move constructor.
-   *
-   * @param other The other optional to move.
-   */
-  MGUTILITY_CNSTXPR inline optional(optional &&other) noexcept
-      : value_{other.value_}, has_value_{other.has_value_} {
-    other.reset();
+/**
+ * @brief Compares two names for equality.
+ *
+ * Both std::string_view and the pre-C++17 fallback end up in a length check
+ * followed by a single memcmp at runtime. C++14 also builds its name tables
+ * in constant expressions, where memcmp is not allowed, so it compares
+ * characters one by one there.
+ *
+ * @param lhs The left-hand side name.
+ * @param rhs The right-hand side name.
+ * @return True if the names are equal, otherwise false.
+ */
+MGUTILITY_CNSTXPR inline auto equal_names(mgutility::string_view lhs,
+                                          mgutility::string_view rhs) noexcept
+    -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return lhs == rhs;
+#else
+#if MGUTILITY_CPLUSPLUS == 201402L
+#if defined(MGUTILITY_IS_CONSTANT_EVALUATED)
+  if (MGUTILITY_IS_CONSTANT_EVALUATED()) {
+#endif
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (std::size_t pos = 0; pos < lhs.size(); ++pos) {
+      if (lhs[pos] != rhs[pos]) {
+        return false;
+      }
+    }
+    return true;
+#if defined(MGUTILITY_IS_CONSTANT_EVALUATED)
   }
+#endif
+#endif
+  return lhs.size() == rhs.size() &&
+         std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+#endif
+}
 
-  /**
-   * @brief Destructor.
-   */
-  ~optional() = default;
+/**
+ * @brief Folds an ASCII upper-case letter to lower case.
+ *
+ * @param chr The character.
+ * @return The lower-case letter, or chr if it is not an upper-case letter.
+ */
+constexpr auto fold_ascii(char chr) noexcept -> char {
+  return chr >= 'A' && chr <= 'Z' ? static_cast<char>(chr - 'A' + 'a') : chr;
+}
 
-  /**
-   * @brief Copy assignment operator.
-   *
-   * @param other The other optional to copy.
-   * @return A reference to this optional.
-   */
-  MGUTILITY_CNSTXPR inline optional &operator=(const optional &other) {
-    value_ = other.value_;
-    has_value_ = other.has_value_;
-    return *this;
+/**
+ * @brief Compares two names for equality, ignoring ASCII case.
+ *
+ * @param lhs The left-hand side name.
+ * @param rhs The right-hand side name.
+ * @return True if the names are equal after folding, otherwise false.
+ */
+MGUTILITY_CNSTXPR inline auto
+equal_folded_names(mgutility::string_view lhs,
+                   mgutility::string_view rhs) noexcept -> bool {
+  if (lhs.size() != rhs.size()) {
+    return false;
   }
-
-  /**
-   * @brief Move assignment operator.
-   *
-   * @param other The other optional to move.
-   * @return A reference to this optional.
-   */
-  MGUTILITY_CNSTXPR inline optional &operator=(optional &&other) noexcept {
-    value_ = other.value_;
-    has_value_ = other.has_value_;
-    other.reset();
-    return *this;
+  for (std::size_t idx = 0; idx < lhs.size(); ++idx) {
+    if (fold_ascii(lhs[idx]) != fold_ascii(rhs[idx])) {
+      return false;
+    }
   }
+  return true;
+}
 
+/**
+ * @brief The hash an enum_name_hash_index is built with by default.
+ */
+struct fnv_name_hasher {
   /**
-   * @brief Swaps the contents of this optional with another.
+   * @brief Hashes a name.
    *
-   * @param other The other optional to swap with.
+   * @param str The name.
+   * @return The name_hash() of the name.
    */
-  MGUTILITY_CNSTXPR inline void swap(optional &other) noexcept {
-    auto val = std::move(other.value_);
-    other.value_ = std::move(value_);
-    value_ = std::move(val);
-
-    auto hval = other.has_value_;
-    other.has_value_ = has_value_;
-    has_value_ = hval;
+  static MGUTILITY_CNSTXPR auto hash(mgutility::string_view str) noexcept
+      -> std::uint64_t {
+    return name_hash(str);
   }
 
   /**
-   * @brief Dereferences the stored value.
+   * @brief Feeds one character into the hash, for parsers that hash while
+   * scanning.
    *
-   * @return A reference to the stored value.
+   * @param hash The hash of the characters before.
+   * @param chr The next character.
+   * @return The hash including the character.
    */
-  MGUTILITY_CNSTXPR inline T &operator*() { return value_; }
+  static constexpr auto step(std::uint64_t hash, char chr) noexcept
+      -> std::uint64_t {
+    return name_hash_step(hash, chr);
+  }
 
   /**
-   * @brief Dereferences the stored value (const version).
+   * @brief Maps a character the way the index sees it.
    *
-   * @return A reference to the stored value.
+   * @param chr The character.
+   * @return The character itself.
    */
-  MGUTILITY_CNSTXPR inline T &operator*() const { return value_; }
+  static constexpr auto fold(char chr) noexcept -> char { return chr; }
 
   /**
-   * @brief Accesses the stored value.
+   * @brief Compares two names the way the index matches them.
    *
-   * @return A reference to the stored value.
-   * @throws bad_optional_access if the optional has no value.
+   * @param lhs The left-hand side name.
+   * @param rhs The right-hand side name.
+   * @return True if the names are equal, otherwise false.
    */
-  MGUTILITY_CNSTXPR inline T &value() {
-    if (!has_value_) {
-      throw bad_optional_access();
-    }
-    return value_;
+  static MGUTILITY_CNSTXPR auto equal(mgutility::string_view lhs,
+                                      mgutility::string_view rhs) noexcept
+      -> bool {
+    return equal_names(lhs, rhs);
   }
+};
 
+/**
+ * @brief The hash of the case-insensitive name index.
+ *
+ * Hashes and compares names with ASCII letters folded to lower case, so the
+ * input is folded on the fly and never copied.
+ */
+struct folded_name_hasher {
   /**
-   * @brief Accesses the stored value (const version).
+   * @brief Hashes a name, ignoring ASCII case.
    *
-   * @return A reference to the stored value.
-   * @throws bad_optional_access if the optional has no value.
+   * @param str The name.
+   * @return The name_hash() of the folded name.
    */
-  MGUTILITY_CNSTXPR inline T &value() const {
-    if (!has_value_) {
-      throw bad_optional_access();
+  static MGUTILITY_CNSTXPR auto hash(mgutility::string_view str) noexcept
+      -> std::uint64_t {
+    std::uint64_t hash = name_hash_seed;
+    for (std::size_t i = 0; i < str.size(); ++i) {
+      hash = name_hash_step(hash, fold_ascii(str[i]));
     }
-    return value_;
+    return hash;
   }
 
   /**
-   * @brief Returns the stored value or a default value if empty.
+   * @brief Feeds one character into the hash, ignoring ASCII case.
    *
-   * @param value The default value to return if empty.
-   * @return The stored value or the default value.
+   * @param hash The hash of the characters before.
+   * @param chr The next character.
+   * @return The hash including the folded character.
    */
-  MGUTILITY_CNSTXPR inline T value_or(T &&value) {
-    return has_value_ ? value_ : std::move(value);
+  static constexpr auto step(std::uint64_t hash, char chr) noexcept
+      -> std::uint64_t {
+    return name_hash_step(hash, fold_ascii(chr));
   }
 
   /**
-   * @brief Returns the stored value or a default value if empty (const
-   * version).
+   * @brief Maps a character the way the index sees it.
    *
-   * @param value The default value to return if empty.
-   * @return The stored value or the default value.
+   * @param chr The character.
+   * @return The character folded to lower case.
    */
-  MGUTILITY_CNSTXPR inline T value_or(T &&value) const {
-    return has_value_ ? value_ : std::move(value);
+  static constexpr auto fold(char chr) noexcept -> char {
+    return fold_ascii(chr);
   }
 
   /**
-   * @brief Returns the stored value or a default value if empty.
+   * @brief Compares two names, ignoring ASCII case.
    *
-   * @param value The default value to return if empty.
-   * @return The stored value or the default value.
+   * @param lhs The left-hand side name.
+   * @param rhs The right-hand side name.
+   * @return True if the names are equal after folding, otherwise false.
    */
-  MGUTILITY_CNSTXPR inline T value_or(const T &value) {
-    return has_value_ ? value_ : value;
+  static MGUTILITY_CNSTXPR auto equal(mgutility::string_view lhs,
+                                      mgutility::string_view rhs) noexcept
+      -> bool {
+    return equal_folded_names(lhs, rhs);
   }
+};
 
-  /**
-   * @brief Returns the stored value or a default value if empty (const
-   * version).
-   *
-   * @param value The default value to return if empty.
-   * @return The stored value or the default value.
-   */
-  MGUTILITY_CNSTXPR inline T value_or(const T &value) const {
-    return has_value_ ? value_ : value;
-  }
+/**
+ * @brief Maps a 32-bit value onto [0, range) without a division.
+ *
+ * @param value The value to reduce.
+ * @param range The size of the target range.
+ * @return The reduced value.
+ */
+constexpr auto reduce_range(std::uint32_t value, std::size_t range) noexcept
+    -> std::size_t {
+  return static_cast<std::size_t>((static_cast<std::uint64_t>(value) *
+                                   static_cast<std::uint64_t>(range)) >>
+                                  32U);
+}
 
-  /**
-   * @brief Constructs the value in-place.
-   *
-   * @param value The value to emplace.
-   */
-  MGUTILITY_CNSTXPR inline void emplace(T value) {
-    value_ = std::move(value);
-    has_value_ = true;
-  }
+/**
+ * @brief Picks the bucket of a name hash.
+ *
+ * FNV-1a leaves its high bits almost untouched by the last characters, so
+ * names sharing a long prefix would pile into a few buckets; one multiply
+ * spreads the low bits into the word the bucket is taken from.
+ *
+ * @param hash The name hash.
+ * @param range The number of buckets.
+ * @return The bucket index.
+ */
+constexpr auto hash_bucket(std::uint64_t hash, std::size_t range) noexcept
+    -> std::size_t {
+  return reduce_range(
+      static_cast<std::uint32_t>((hash * 0x9e3779b97f4a7c15ULL) >> 32U), range);
+}
 
-  /**
-   * @brief Constructs the value in-place with arguments.
-   *
-   * @tparam Args The types of the arguments.
-   * @param args The arguments to construct the value.
-   */
-  template <typename... Args>
-  MGUTILITY_CNSTXPR inline void emplace(Args &&...args) {
-    value_ = std::move(T{std::forward<Args>(args)...});
-    has_value_ = true;
-  }
+/**
+ * @brief Remixes a name hash with a bucket displacement.
+ *
+ * @param hash The name hash.
+ * @param disp The displacement of the bucket the name falls into.
+ * @return The mixed 32-bit value used to pick the table position.
+ */
+MGUTILITY_CNSTXPR inline auto displace(std::uint64_t hash,
+                                       std::uint32_t disp) noexcept
+    -> std::uint32_t {
+  hash += static_cast<std::uint64_t>(disp) * 0x9e3779b97f4a7c15ULL;
+  hash ^= hash >> 33U;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33U;
+  return static_cast<std::uint32_t>(hash);
+}
 
-  /**
-   * @brief Checks if the optional has a value.
-   *
-   * @return True if the optional has a value, otherwise false.
-   */
-  MGUTILITY_CNSTXPR inline bool has_value() const { return has_value_; }
+/**
+ * @brief Minimal perfect hash index from enum names to slots of the reflected
+ * range.
+ *
+ * Built with the hash-and-displace scheme: every name hashes into one of
+ * `size` buckets, and each bucket stores a displacement that sends all of its
+ * names to distinct, free table positions. A lookup is one hash, one table
+ * probe and one compare against the name table. Only small integers are
+ * stored; the names themselves stay in the name table.
+ *
+ * @tparam N The capacity of the index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash, a type with a static hash(string_view) and a
+ * static equal(string_view, string_view).
+ */
+template <std::size_t N, std::size_t Slots,
+          typename Hasher = fnv_name_hasher>
+struct enum_name_hash_index {
+  static constexpr auto npos = static_cast<std::size_t>(-1);
+  static constexpr auto max_displacement = 64U * N + 1024U;
 
-  /**
-   * @brief Resets the optional, making it empty.
-   */
-  template <typename U = T,
-            detail::enable_if_t<!std::is_destructible<U>::value, bool> = true>
-  MGUTILITY_CNSTXPR inline void reset() {
-    value_ = T{};
-    has_value_ = false;
-  }
+  using displacement_type = uint_fit_t<max_displacement>;
+  using slot_type = uint_fit_t<Slots>;
 
-  /**
-   * @brief Resets the optional, making it empty.
-   */
-  template <typename U = T,
-            detail::enable_if_t<std::is_destructible<T>::value, bool> = true>
-  MGUTILITY_CNSTXPR inline void reset() {
-    value_.~T();
-    has_value_ = false;
-  }
+  std::size_t size{};    /**< Number of names in the index. */
+  bool collision_free{}; /**< Every name resolves to its own slot. */
+  constant_array<displacement_type, N> displacements{}; /**< Per bucket. */
+  constant_array<slot_type, N> slots{}; /**< Range slot, Slots if unused. */
 
   /**
-   * @brief Checks if the optional has a value.
+   * @brief Finds the slot of a name.
    *
-   * @return True if the optional has a value, otherwise false.
+   * @param str The name to look up.
+   * @param names The name table the index was built from.
+   * @return The slot of the name within the reflected range, or npos.
    */
-  MGUTILITY_CNSTXPR operator bool() { return has_value_; }
-
-private:
-  union {
-    T value_;
-    char dummy_[sizeof(T)];
-  };
-  bool has_value_;
-};
+  template <typename Names>
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view str,
+                              const Names &names) const noexcept
+      -> std::size_t {
+    return find(str, Hasher::hash(str), names);
+  }
 
-/**
- * @brief Represents a null optional.
- */
-struct nullopt_t {
   /**
-   * @brief Converts nullopt_t to an empty optional.
+   * @brief Finds the slot of a name whose hash is already known.
    *
-   * @tparam T The type of the optional.
-   * @return An empty optional.
+   * @param str The name to look up.
+   * @param hash The Hasher::hash() of the name.
+   * @param names The name table the index was built from.
+   * @return The slot of the name within the reflected range, or npos.
    */
-  template <typename T> MGUTILITY_CNSTXPR operator optional<T>() {
-    return optional<T>{};
+  template <typename Names>
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view str, std::uint64_t hash,
+                              const Names &names) const noexcept
+      -> std::size_t {
+    if (size == 0 || str.empty()) {
+      return npos;
+    }
+    const auto bucket = hash_bucket(hash, size);
+    const auto pos = reduce_range(displace(hash, displacements[bucket]), size);
+    const auto slot = static_cast<std::size_t>(slots[pos]);
+    return slot < Slots && Hasher::equal(names[slot], str) ? slot : npos;
   }
 };
 
+#if MGUTILITY_CPLUSPLUS == 201103L
 /**
- * @brief A global instance of nullopt_t to represent null optional.
+ * @brief A work array of make_name_hash_index (C++11).
+ *
+ * C++11 builds the index at runtime, sized for the whole range, so the work
+ * arrays are allocated instead of taking several megabytes of stack.
+ *
+ * @tparam T The element type.
+ * @tparam N The number of elements.
  */
-auto nullopt = nullopt_t{};
-
+template <typename T, std::size_t N> struct hash_work_array : std::vector<T> {
+  hash_work_array() : std::vector<T>(N) {}
+};
 #else
 /**
- * @brief Alias template for std::optional.
+ * @brief A work array of make_name_hash_index, assignable in a constant
+ * expression.
  *
- * @tparam T The type of the value.
+ * @tparam T The element type.
+ * @tparam N The number of elements.
  */
-template <typename T> using optional = std::optional<T>;
+template <typename T, std::size_t N>
+using hash_work_array = constant_array<T, N>;
+#endif
 
 /**
- * @brief A global constant representing a null optional.
+ * @brief Builds the perfect hash index for a name table.
+ *
+ * Buckets are placed largest first; for each one the displacement is
+ * increased until all of its names land on free positions. When a name
+ * occurs more than once, the lowest slot wins, matching a front-to-back
+ * search. The result is verified by looking every name up again, and
+ * `collision_free` reports whether that succeeded.
+ *
+ * @tparam N The capacity of the index, at least the number of names.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash of the index.
+ * @param names The name table, indexed by slot.
+ * @return The hash index.
  */
-inline constexpr auto nullopt{std::nullopt};
+template <std::size_t N, std::size_t Slots,
+          typename Hasher = fnv_name_hasher, typename Names>
+MGUTILITY_CNSTXPR auto make_name_hash_index(const Names &names) noexcept
+    -> enum_name_hash_index<N, Slots, Hasher> {
+  using index_type = enum_name_hash_index<N, Slots, Hasher>;
+  using displacement_type = typename index_type::displacement_type;
+  using slot_type = typename index_type::slot_type;
+  index_type index{};
+
+  hash_work_array<std::size_t, N> key_slots{};
+  hash_work_array<std::uint64_t, N> hashes{};
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < Slots && count < N; ++slot) {
+    if (!names[slot].empty()) {
+      key_slots[count] = slot;
+      hashes[count] = Hasher::hash(names[slot]);
+      ++count;
+    }
+  }
 
-#endif
+  index.size = count;
+  for (std::size_t pos = 0; pos < N; ++pos) {
+    index.slots[pos] = static_cast<slot_type>(Slots);
+  }
+
+  // Counting sort of the names by bucket, keeping slot order inside buckets.
+  hash_work_array<std::size_t, N + 1> bucket_start{};
+  for (std::size_t key = 0; key < count; ++key) {
+    ++bucket_start[hash_bucket(hashes[key], count) + 1];
+  }
+  std::size_t max_bucket = 0;
+  for (std::size_t bucket = 0; bucket < count; ++bucket) {
+    max_bucket = bucket_start[bucket + 1] > max_bucket
+                     ? bucket_start[bucket + 1]
+                     : max_bucket;
+    bucket_start[bucket + 1] += bucket_start[bucket];
+  }
+
+  hash_work_array<std::size_t, N> order{};
+  hash_work_array<std::size_t, N> cursor{};
+  for (std::size_t bucket = 0; bucket < count; ++bucket) {
+    cursor[bucket] = bucket_start[bucket];
+  }
+  for (std::size_t key = 0; key < count; ++key) {
+    const auto bucket = hash_bucket(hashes[key], count);
+    order[cursor[bucket]++] = key;
+  }
+
+  hash_work_array<bool, N> taken{};
+  hash_work_array<std::size_t, N> positions{};
+  const auto max_disp = static_cast<std::uint32_t>(64U * count + 1024U);
+
+  for (auto bucket_size = max_bucket; bucket_size > 0; --bucket_size) {
+    for (std::size_t bucket = 0; bucket < count; ++bucket) {
+      const auto first = bucket_start[bucket];
+      const auto last = bucket_start[bucket + 1];
+      if (last - first != bucket_size) {
+        continue;
+      }
+
+      std::uint32_t disp = 0;
+      for (; disp < max_disp; ++disp) {
+        auto placed = true;
+        for (auto idx = first; idx < last && placed; ++idx) {
+          const auto key = order[idx];
+          positions[idx] = index_type::npos;
+          auto duplicate = false;
+          for (auto prev = first; prev < idx && !duplicate; ++prev) {
+            duplicate = hashes[order[prev]] == hashes[key] &&
+                        Hasher::equal(names[key_slots[order[prev]]],
+                                      names[key_slots[key]]);
+          }
+          if (duplicate) {
+            continue;
+          }
+          const auto pos = reduce_range(displace(hashes[key], disp), count);
+          placed = !taken[pos];
+          for (auto prev = first; prev < idx && placed; ++prev) {
+            placed = positions[prev] != pos;
+          }
+          positions[idx] = pos;
+        }
+        if (placed) {
+          break;
+        }
+      }
+
+      if (disp == max_disp) {
+        return index;
+      }
+
+      index.displacements[bucket] = static_cast<displacement_type>(disp);
+      for (auto idx = first; idx < last; ++idx) {
+        const auto pos = positions[idx];
+        if (pos != index_type::npos) {
+          taken[pos] = true;
+          index.slots[pos] = static_cast<slot_type>(key_slots[order[idx]]);
+        }
+      }
+    }
+  }
+
+  auto resolved = true;
+  for (std::size_t key = 0; key < count && resolved; ++key) {
+    const auto slot = index.find(names[key_slots[key]], names);
+    resolved = slot != index_type::npos &&
+               Hasher::equal(names[slot], names[key_slots[key]]);
+  }
+  index.collision_free = resolved;
+
+  return index;
+}
+
+/**
+ * @brief Checks that every name of a table is found as itself.
+ *
+ * An index whose Hasher::equal is looser than equality, like the
+ * case-insensitive one, merges names that only differ in what it ignores;
+ * the lowest slot wins, so the other names would silently resolve to a
+ * different value.
+ *
+ * @tparam N The capacity of the index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash of the index.
+ * @param index The hash index.
+ * @param names The name table the index was built from.
+ * @return True if no two distinct names match each other, otherwise false.
+ */
+template <std::size_t N, std::size_t Slots, typename Hasher, typename Names>
+MGUTILITY_CNSTXPR auto
+names_unambiguous(const enum_name_hash_index<N, Slots, Hasher> &index,
+                  const Names &names) noexcept -> bool {
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    if (names[slot].empty()) {
+      continue;
+    }
+    const auto found = index.find(names[slot], names);
+    if (found == index.npos || !equal_names(names[found], names[slot])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace detail
 } // namespace mgutility
 
-#endif // DETAIL_OPTIONAL_HPP
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_HASH_HPP
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_OVERLAY_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_OVERLAY_HPP
+
 #include <algorithm>
-#include <array>
+#include <atomic>
 #include <cstddef>
-#include <cstring>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mgutility {
 
 /**
- * @brief Checks for MSVC compiler version.
+ * @brief A table of display names for values of an enum, set at runtime.
  *
- * If the MSVC version is less than 2017, an error is raised.
+ * Build the table with set(), then hand it to publish_enum_overlay(): from
+ * then on enum_name returns the names of the table for the values it has and
+ * the reflected names for every other value. Values without a reflected
+ * name, e.g. ones added by a newer peer, can be named too. Entries are kept
+ * sorted by value, so find() is a binary search.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
  */
-#if defined(_MSC_VER) && _MSC_VER < 1910
-#error "Requires MSVC 2017 or newer!"
+template <typename Enum> class enum_overlay {
+  /**
+   * @brief An entry of the table: a value and where its name is in the
+   * name buffer.
+   */
+  struct entry {
+    std::uint64_t key;  /**< The bits of the value. */
+    std::size_t offset; /**< The offset of the name in the name buffer. */
+    std::size_t size;   /**< The length of the name. */
+  };
+
+  /**
+   * @brief Gets the key of a value, without sign extension.
+   *
+   * @param value The value.
+   * @return The key.
+   */
+  static constexpr auto key_of(Enum value) noexcept -> std::uint64_t {
+    return static_cast<std::uint64_t>(
+        static_cast<detail::flag_type_t<Enum>>(value));
+  }
+
+  /**
+   * @brief Finds the first entry whose key is not less than a key.
+   *
+   * @param key The key.
+   * @return The position of the entry, or the number of entries.
+   */
+  auto lower_bound(std::uint64_t key) const noexcept -> std::size_t {
+    return static_cast<std::size_t>(
+        std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                         [](const entry &lhs, std::uint64_t rhs) {
+                           return lhs.key < rhs;
+                         }) -
+        m_entries.begin());
+  }
+
+  /**
+   * @brief Rebuilds the name buffer from the entries, dropping the bytes of
+   * replaced and removed names.
+   */
+  void compact() {
+    std::string names;
+    names.reserve(m_names.size());
+    for (auto &item : m_entries) {
+      const auto offset = names.size();
+      names.append(m_names, item.offset, item.size);
+      item.offset = offset;
+    }
+    m_names.swap(names);
+  }
+
+public:
+  /**
+   * @brief Sets the display name of a value.
+   *
+   * A later name replaces an earlier one; an empty name removes the value,
+   * so that enum_name falls back to the reflected name. Either way the name
+   * buffer is compacted, so a table keeps only the bytes of its live names.
+   *
+   * @param value The value.
+   * @param name The display name, copied into the table.
+   * @return A reference to this table.
+   */
+  auto set(Enum value, mgutility::string_view name) -> enum_overlay & {
+    const auto key = key_of(value);
+    const auto pos = lower_bound(key);
+    const auto found = pos < m_entries.size() && m_entries[pos].key == key;
+    if (name.empty()) {
+      if (found) {
+        m_entries.erase(m_entries.begin() +
+                        static_cast<std::ptrdiff_t>(pos));
+        compact();
+      }
+      return *this;
+    }
+
+    const entry item{key, m_names.size(), name.size()};
+    m_names.append(name.data(), name.size());
+    if (found) {
+      m_entries[pos] = item;
+      compact();
+    } else {
+      m_entries.insert(m_entries.begin() + static_cast<std::ptrdiff_t>(pos),
+                       item);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Finds the display name of a value.
+   *
+   * @param value The value.
+   * @return The display name, or an empty string_view if the table has no
+   * name for the value.
+   */
+  auto find(Enum value) const noexcept -> mgutility::string_view {
+    const auto key = key_of(value);
+    const auto pos = lower_bound(key);
+    if (pos == m_entries.size() || m_entries[pos].key != key) {
+      return mgutility::string_view{};
+    }
+    return mgutility::string_view(m_names.data() + m_entries[pos].offset,
+                                  m_entries[pos].size);
+  }
+
+  /**
+   * @brief Gets the number of values the table names.
+   *
+   * @return The number of values.
+   */
+  auto size() const noexcept -> std::size_t { return m_entries.size(); }
+
+  /**
+   * @brief Checks whether the table names no value.
+   *
+   * @return True if the table is empty, otherwise false.
+   */
+  auto empty() const noexcept -> bool { return m_entries.empty(); }
+
+private:
+  std::vector<entry> m_entries; /**< The entries, sorted by key. */
+  std::string m_names;          /**< The names, back to back. */
+};
+
+namespace detail {
+
 /**
- * @brief Checks for Clang compiler version.
+ * @brief A published overlay and the ones it replaced.
  *
- * If the Clang version is less than 6, an error is raised.
+ * enum_name hands out views into published overlays, so a replaced overlay
+ * is not freed when it is replaced: it stays on the retired chain of the
+ * current one until reclaim_enum_overlays() or the end of the program.
+ *
+ * @tparam Enum The enum type.
  */
-#elif defined(__clang__) && __clang_major__ < 6
-#error "Requires clang 6 or newer!"
+template <typename Enum> struct enum_overlay_node {
+  enum_overlay<Enum> overlay; /**< The overlay. */
+  enum_overlay_node *previous; /**< The retired overlays, newest first. */
+};
+
 /**
- * @brief Checks for GCC compiler version.
+ * @brief Frees a chain of overlay nodes.
  *
- * If the GCC version is less than 9 and it is not Clang, an error is raised.
+ * @tparam Enum The enum type.
+ * @param node The first node of the chain, or nullptr.
  */
-#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 9
-#error "Requires gcc 9 or newer!"
+template <typename Enum> void free_overlay_chain(enum_overlay_node<Enum> *node) {
+  while (node != nullptr) {
+    auto *previous = node->previous;
+    // NOLINTNEXTLINE [cppcoreguidelines-owning-memory]
+    delete node;
+    node = previous;
+  }
+}
+
 /**
- * @brief Checks for unsupported compilers.
+ * @brief Gets the slot the current overlay of an enum is published in.
  *
- * If the compiler is not MSVC, Clang, or GCC, an error is raised.
+ * The atomic is constant-initialized, so reading it takes no guard.
+ *
+ * @tparam Enum The enum type.
+ * @return A reference to the slot.
  */
-#elif !defined(_MSC_VER) && !defined(__clang__) && !defined(__GNUC__)
-#error "Your compiler is not supported!"
-#endif
+template <typename Enum>
+auto enum_overlay_slot() noexcept -> std::atomic<enum_overlay_node<Enum> *> & {
+  static std::atomic<enum_overlay_node<Enum> *> slot{nullptr};
+  return slot;
+}
 
 /**
- * @brief Defines the MGUTILITY_CPLUSPLUS macro for MSVC and other compilers.
+ * @brief Gets the lock that orders the writers of the overlay of an enum.
  *
- * For MSVC, it uses _MSVC_LANG. For other compilers, it uses __cplusplus.
+ * Only publish_enum_overlay() and reclaim_enum_overlays() take it; readers
+ * never do.
+ *
+ * @tparam Enum The enum type.
+ * @return A reference to the lock.
  */
-#ifdef _MSC_VER
-#define __PRETTY_FUNCTION__ __FUNCSIG__
-#endif
+template <typename Enum> auto enum_overlay_lock() -> std::mutex & {
+  static std::mutex lock;
+  return lock;
+}
+
+/**
+ * @brief Frees the published overlays of an enum when the program exits.
+ *
+ * Constructed by the first publication, so it is destroyed after every
+ * static object constructed later.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_overlay_reaper {
+  enum_overlay_reaper() = default;
+  enum_overlay_reaper(const enum_overlay_reaper &) = delete;
+  auto operator=(const enum_overlay_reaper &) -> enum_overlay_reaper & = delete;
+
+  ~enum_overlay_reaper() {
+    free_overlay_chain(
+        enum_overlay_slot<Enum>().exchange(nullptr, std::memory_order_acq_rel));
+  }
+};
+
+/**
+ * @brief Gets the current overlay of an enum without an overlay.
+ *
+ * @tparam Enum The enum type.
+ * @return nullptr.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<!enum_name_overlay<Enum>::value, bool> = true>
+constexpr auto current_overlay() noexcept -> const enum_overlay<Enum> * {
+  return nullptr;
+}
+
+/**
+ * @brief Gets the current overlay of an enum.
+ *
+ * One acquire load, so batch functions can fetch it once for all their
+ * values.
+ *
+ * @tparam Enum The enum type.
+ * @return The current overlay, or nullptr if none was published.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<enum_name_overlay<Enum>::value, bool> = true>
+auto current_overlay() noexcept -> const enum_overlay<Enum> * {
+  const auto *node = enum_overlay_slot<Enum>().load(std::memory_order_acquire);
+  return node == nullptr ? nullptr : &node->overlay;
+}
+
+/**
+ * @brief Gets the overlay name of a value of an enum without an overlay.
+ *
+ * @tparam Enum The enum type.
+ * @return An empty string_view.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<!enum_name_overlay<Enum>::value, bool> = true>
+constexpr auto overlay_name(Enum /*unused*/) noexcept
+    -> mgutility::string_view {
+  return mgutility::string_view{};
+}
+
+/**
+ * @brief Gets the overlay name of a value.
+ *
+ * Wait-free: one acquire load of the current overlay and a binary search in
+ * it.
+ *
+ * @tparam Enum The enum type.
+ * @param value The value.
+ * @return The name of the value in the current overlay, or an empty
+ * string_view.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum,
+          detail::enable_if_t<enum_name_overlay<Enum>::value, bool> = true>
+auto overlay_name(Enum value) noexcept -> mgutility::string_view {
+  const auto *overlay = current_overlay<Enum>();
+  return overlay == nullptr ? mgutility::string_view{} : overlay->find(value);
+}
+
+} // namespace detail
+
+/**
+ * @brief Publishes the display names of an enum.
+ *
+ * The overlay replaces the current one in a single atomic store; readers
+ * never wait for it, and a reader that loaded the previous overlay keeps
+ * using it safely. Replaced overlays are retired, not freed, so views
+ * returned by enum_name stay valid; each publication costs the memory of
+ * its table until reclaim_enum_overlays() is called or the program exits.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ * @param overlay The display names.
+ */
+template <typename Enum> void publish_enum_overlay(enum_overlay<Enum> overlay) {
+  static_assert(enum_name_overlay<Enum>::value,
+                "enum_name_overlay is not enabled for this enum!");
+  static detail::enum_overlay_reaper<Enum> reaper;
+  // NOLINTNEXTLINE [cppcoreguidelines-owning-memory]
+  auto *node = new detail::enum_overlay_node<Enum>{std::move(overlay), nullptr};
+  auto &slot = detail::enum_overlay_slot<Enum>();
+  const std::lock_guard<std::mutex> guard(detail::enum_overlay_lock<Enum>());
+  node->previous = slot.load(std::memory_order_relaxed);
+  slot.store(node, std::memory_order_release);
+}
+
+/**
+ * @brief Frees the overlays of an enum that were replaced by a later
+ * publication, keeping the current one.
+ *
+ * The caller must make sure that no thread is still reading a replaced
+ * overlay: no enum_name call that started before the last publication is
+ * still running, and no name it returned is still in use. Views into the
+ * current overlay stay valid.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ */
+template <typename Enum> void reclaim_enum_overlays() {
+  static_assert(enum_name_overlay<Enum>::value,
+                "enum_name_overlay is not enabled for this enum!");
+  detail::enum_overlay_node<Enum> *retired = nullptr;
+  {
+    const std::lock_guard<std::mutex> guard(detail::enum_overlay_lock<Enum>());
+    auto *current =
+        detail::enum_overlay_slot<Enum>().load(std::memory_order_relaxed);
+    if (current != nullptr) {
+      retired = current->previous;
+      current->previous = nullptr;
+    }
+  }
+  detail::free_overlay_chain(retired);
+}
+
+/**
+ * @brief Removes the display names of an enum, so that enum_name returns the
+ * reflected names again.
+ *
+ * @tparam Enum The enum type; enum_name_overlay<Enum> must be enabled.
+ */
+template <typename Enum> void clear_enum_overlay() {
+  publish_enum_overlay(enum_overlay<Enum>{});
+}
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_OVERLAY_HPP
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PADDED_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PADDED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if MGUTILITY_ENUM_NAME_PADDED_SLOTS != 0 &&                                  \
+    MGUTILITY_ENUM_NAME_PADDED_SLOTS != 16 &&                                 \
+    MGUTILITY_ENUM_NAME_PADDED_SLOTS != 32
+#error "MGUTILITY_ENUM_NAME_PADDED_SLOTS must be 0, 16 or 32!"
+#endif
+
+/**
+ * @brief Detects the vector instructions the padded name layout can use.
+ *
+ * SSE2 is part of every x86-64 target, so it is picked at compile time; the
+ * 32-byte compare uses AVX2 only when the translation unit is built for it.
+ */
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MGUTILITY_ENUM_NAME_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define MGUTILITY_ENUM_NAME_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Defines MGUTILITY_ENUM_NAME_PADDED when the padded name layout is
+ * requested and usable; otherwise to_enum keeps the default layout.
+ */
+#if MGUTILITY_ENUM_NAME_PADDED_SLOTS != 0 &&                                  \
+    defined(MGUTILITY_ENUM_NAME_HAS_SSE2) &&                                   \
+    defined(MGUTILITY_IS_CONSTANT_EVALUATED)
+#define MGUTILITY_ENUM_NAME_PADDED
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#define MGUTILITY_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define MGUTILITY_NO_SANITIZE_ADDRESS
+#endif
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
+
+/**
+ * @brief Gets the multiplier of a word of a padded name.
+ *
+ * @param word The word index; 0 is used for the length.
+ * @return An odd 64-bit constant.
+ */
+constexpr auto padded_hash_key(std::size_t word) noexcept -> std::uint64_t {
+  return word == 0   ? 0x9e3779b97f4a7c15ULL
+         : word == 1 ? 0xc2b2ae3d27d4eb4fULL
+         : word == 2 ? 0x165667b19e3779f9ULL
+         : word == 3 ? 0xd6e8feb86659fd93ULL
+                     : 0xff51afd7ed558ccdULL;
+}
+
+/**
+ * @brief Hashes a name zero-padded to Width bytes, one multiply per 8-byte
+ * word.
+ *
+ * The words are multiplied independently, so the cost does not grow with
+ * the name length the way a byte-wise hash does.
+ *
+ * @tparam Width The slot width, 16 or 32.
+ */
+template <std::size_t Width> struct padded_name_hasher {
+  static constexpr std::size_t words = Width / 8;
+
+  /**
+   * @brief Hashes the little-endian words of a padded name.
+   *
+   * @param padded The words.
+   * @param size The length of the name.
+   * @return The hash value.
+   */
+  static MGUTILITY_CNSTXPR auto hash_words(const std::uint64_t *padded,
+                                           std::size_t size) noexcept
+      -> std::uint64_t {
+    std::uint64_t hash = static_cast<std::uint64_t>(size) * padded_hash_key(0);
+    for (std::size_t word = 0; word < words; ++word) {
+      hash ^= padded[word] * padded_hash_key(word + 1);
+    }
+    return hash;
+  }
+
+  /**
+   * @brief Hashes a name of at most Width bytes.
+   *
+   * @param str The name.
+   * @return The hash value.
+   */
+  static MGUTILITY_CNSTXPR auto hash(mgutility::string_view str) noexcept
+      -> std::uint64_t {
+    std::uint64_t padded[words]{};
+    for (std::size_t idx = 0; idx < str.size() && idx < Width; ++idx) {
+      padded[idx / 8] |= static_cast<std::uint64_t>(
+                             static_cast<unsigned char>(str[idx]))
+                         << (8U * (idx % 8));
+    }
+    return hash_words(padded, str.size());
+  }
+
+  /**
+   * @brief Compares two names the way the index matches them.
+   *
+   * @param lhs The left-hand side name.
+   * @param rhs The right-hand side name.
+   * @return True if the names are equal, otherwise false.
+   */
+  static MGUTILITY_CNSTXPR auto equal(mgutility::string_view lhs,
+                                      mgutility::string_view rhs) noexcept
+      -> bool {
+    return equal_names(lhs, rhs);
+  }
+};
+
+/**
+ * @brief Shows only the names that fit into a padded slot.
+ *
+ * @tparam Width The slot width.
+ * @tparam Names The name table type.
+ */
+template <std::size_t Width, typename Names> struct padded_names_view {
+  const Names &names; /**< The name table. */
+
+  /**
+   * @brief Gets the name of a slot if it fits into a padded slot.
+   *
+   * @param slot The slot within the reflected range.
+   * @return The name, or an empty view if it is longer than Width.
+   */
+  constexpr auto operator[](std::size_t slot) const noexcept
+      -> mgutility::string_view {
+    return names[slot].size() <= Width ? names[slot]
+                                       : mgutility::string_view{};
+  }
+
+  /**
+   * @brief Gets the number of slots.
+   *
+   * @return The number of slots of the name table.
+   */
+  constexpr auto size() const noexcept -> std::size_t { return names.size(); }
+};
+
+/**
+ * @brief Names zero-padded into Width-byte slots, in the order of the
+ * positions of their hash index.
+ *
+ * @tparam N The capacity of the hash index.
+ * @tparam Width The slot width.
+ */
+template <std::size_t N, std::size_t Width> struct padded_name_table {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  alignas(Width) char bytes[N][Width];
+};
+
+/**
+ * @brief Builds the padded names for the positions of a hash index.
+ *
+ * @tparam N The capacity of the hash index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Width The slot width.
+ * @param index The hash index built over padded_names_view.
+ * @param names The name table, indexed by slot.
+ * @return The padded names.
+ */
+template <std::size_t N, std::size_t Slots, std::size_t Width, typename Names>
+MGUTILITY_CNSTXPR auto make_padded_name_table(
+    const enum_name_hash_index<N, Slots, padded_name_hasher<Width>> &index,
+    const Names &names) noexcept -> padded_name_table<N, Width> {
+  padded_name_table<N, Width> table{};
+  for (std::size_t pos = 0; pos < index.size; ++pos) {
+    const auto slot = static_cast<std::size_t>(index.slots[pos]);
+    if (slot >= Slots) {
+      continue;
+    }
+    const auto name = names[slot];
+    for (std::size_t idx = 0; idx < name.size() && idx < Width; ++idx) {
+      table.bytes[pos][idx] = name[idx];
+    }
+  }
+  return table;
+}
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+
+/**
+ * @brief Loads a name of at most Width bytes into zero-padded vectors.
+ *
+ * The name is read with full-width loads unless that would cross into the
+ * next page, in which case it is copied first; the bytes past its end are
+ * cleared either way.
+ *
+ * @tparam Width The slot width.
+ * @param str The name, not empty and at most Width bytes long.
+ * @param lanes The padded name, 16 bytes per vector.
+ * @return False if the name contains a '\0', which no enum name does.
+ */
+template <std::size_t Width>
+MGUTILITY_NO_SANITIZE_ADDRESS inline auto
+load_padded_name(mgutility::string_view str, __m128i *lanes) noexcept -> bool {
+  const auto *src = str.data();
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  alignas(16) char buffer[Width]{};
+  if ((reinterpret_cast<std::uintptr_t>(src) & 4095U) > 4096U - Width) {
+    std::memcpy(buffer, src, str.size());
+    src = buffer;
+  }
+
+  const auto limit = _mm_set1_epi8(static_cast<char>(str.size()));
+  const auto zero = _mm_setzero_si128();
+  auto offsets = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+                               14, 15);
+  auto nul = 0;
+  for (std::size_t lane = 0; lane < Width / 16; ++lane) {
+    const auto live = _mm_cmplt_epi8(offsets, limit);
+    const auto bytes = _mm_and_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16 * lane)),
+        live);
+    nul |= _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(bytes, zero), live));
+    lanes[lane] = bytes;
+    offsets = _mm_add_epi8(offsets, _mm_set1_epi8(16));
+  }
+  return nul == 0;
+}
+
+/**
+ * @brief Compares a loaded name with a padded slot.
+ *
+ * @tparam Width The slot width.
+ * @param lanes The padded name.
+ * @param slot The padded slot.
+ * @return True if both hold the same bytes.
+ */
+template <std::size_t Width>
+inline auto equal_padded_name(const __m128i *lanes, const char *slot) noexcept
+    -> bool {
+#if defined(MGUTILITY_ENUM_NAME_HAS_AVX2)
+  if (Width == 32) {
+    const auto name = _mm256_set_m128i(lanes[1], lanes[0]);
+    const auto row = _mm256_load_si256(reinterpret_cast<const __m256i *>(slot));
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(name, row)) == -1;
+  }
+#endif
+  auto equal = 0xFFFF;
+  for (std::size_t lane = 0; lane < Width / 16; ++lane) {
+    const auto row =
+        _mm_load_si128(reinterpret_cast<const __m128i *>(slot + 16 * lane));
+    equal &= _mm_movemask_epi8(_mm_cmpeq_epi8(lanes[lane], row));
+  }
+  return equal == 0xFFFF;
+}
+
+/**
+ * @brief Finds the slot of a name through the padded layout.
+ *
+ * @tparam N The capacity of the hash index.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Width The slot width.
+ * @param index The hash index built over padded_names_view.
+ * @param table The padded names of the index positions.
+ * @param str The name to look up, at most Width bytes long.
+ * @return The slot of the name within the reflected range, or npos.
+ */
+template <std::size_t N, std::size_t Slots, std::size_t Width>
+inline auto find_padded_name(
+    const enum_name_hash_index<N, Slots, padded_name_hasher<Width>> &index,
+    const padded_name_table<N, Width> &table,
+    mgutility::string_view str) noexcept -> std::size_t {
+  using index_type = enum_name_hash_index<N, Slots, padded_name_hasher<Width>>;
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  __m128i lanes[Width / 16];
+  if (index.size == 0 || str.empty() ||
+      !load_padded_name<Width>(str, lanes)) {
+    return index_type::npos;
+  }
+
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  alignas(16) std::uint64_t words[Width / 8];
+  for (std::size_t lane = 0; lane < Width / 16; ++lane) {
+    _mm_store_si128(reinterpret_cast<__m128i *>(words + 2 * lane),
+                    lanes[lane]);
+  }
+  const auto hash = padded_name_hasher<Width>::hash_words(words, str.size());
+
+  const auto bucket = hash_bucket(hash, index.size);
+  const auto pos =
+      reduce_range(displace(hash, index.displacements[bucket]), index.size);
+  const auto slot = static_cast<std::size_t>(index.slots[pos]);
+  return slot < Slots && equal_padded_name<Width>(lanes, table.bytes[pos])
+             ? slot
+             : index_type::npos;
+}
+
+#endif // MGUTILITY_ENUM_NAME_PADDED
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PADDED_HPP
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PREFIX_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PREFIX_HPP
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef DETAIL_OPTIONAL_HPP
+#define DETAIL_OPTIONAL_HPP
+
+// NOLINTNEXTLINE [unused-includes]
+
+// NOLINTNEXTLINE [unused-includes]
+#include <exception>
+
+#if MGUTILITY_CPLUSPLUS >= 201703L
+#include <optional>
+#endif
+
+namespace mgutility {
+
+#if MGUTILITY_CPLUSPLUS < 201703L
+
+/**
+ * @brief Exception thrown when accessing an empty optional.
+ */
+struct bad_optional_access : public std::exception {
+  /**
+   * @brief Returns the exception message.
+   *
+   * @return A C-string with the exception message.
+   */
+  const char *what() const noexcept override { return "optional has no value"; }
+};
+
+struct nullopt_t;
+
+/**
+ * @brief A class template that provides optional (nullable) objects.
+ *
+ * @tparam T The type of the value.
+ */
+template <typename T> class optional {
+public:
+  /**
+   * @brief Constructs an empty optional.
+   */
+  MGUTILITY_CNSTXPR inline explicit optional(nullopt_t & /*unused*/)
+      : dummy_{0}, has_value_{false} {}
+
+  /**
+   * @brief Constructs an empty optional.
+   */
+  MGUTILITY_CNSTXPR inline optional() : dummy_{0}, has_value_{false} {}
+
+  /**
+   * @brief Constructs an optional with a value.
+   *
+   * @tparam Args The types of the arguments.
+   * @param args The arguments to construct the value.
+   */
+  template <typename... Args>
+  MGUTILITY_CNSTXPR inline explicit optional(Args &&...args)
+      : value_{T{std::forward<Args>(args)...}}, has_value_{true} {}
+
+  /**
+   * @brief Constructs an optional with a value.
+   *
+   * @param value The value to initialize with.
+   */
+  MGUTILITY_CNSTXPR inline explicit optional(T &&value)
+      : value_{std::move(value)}, has_value_{true} {}
+
+  /**
+   * @brief Copy constructor.
+   *
+   * @param other The other optional to copy.
+   */
+  MGUTILITY_CNSTXPR inline optional(const optional &other)
+      : value_{other.value_}, has_value_{other.has_value_} {}
+
+  /**
+   * @brief Move constructor.
+   *
+   * @param other The other optional to move.
+   */
+  MGUTILITY_CNSTXPR inline optional(optional &&other) noexcept
+      : value_{other.value_}, has_value_{other.has_value_} {
+    other.reset();
+  }
+
+  /**
+   * @brief Destructor.
+   */
+  ~optional() = default;
+
+  /**
+   * @brief Copy assignment operator.
+   *
+   * @param other The other optional to copy.
+   * @return A reference to this optional.
+   */
+  MGUTILITY_CNSTXPR inline optional &operator=(const optional &other) {
+    value_ = other.value_;
+    has_value_ = other.has_value_;
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator.
+   *
+   * @param other The other optional to move.
+   * @return A reference to this optional.
+   */
+  MGUTILITY_CNSTXPR inline optional &operator=(optional &&other) noexcept {
+    value_ = other.value_;
+    has_value_ = other.has_value_;
+    other.reset();
+    return *this;
+  }
+
+  /**
+   * @brief Swaps the contents of this optional with another.
+   *
+   * @param other The other optional to swap with.
+   */
+  MGUTILITY_CNSTXPR inline void swap(optional &other) noexcept {
+    auto val = std::move(other.value_);
+    other.value_ = std::move(value_);
+    value_ = std::move(val);
+
+    auto hval = other.has_value_;
+    other.has_value_ = has_value_;
+    has_value_ = hval;
+  }
+
+  /**
+   * @brief Dereferences the stored value.
+   *
+   * @return A reference to the stored value.
+   */
+  MGUTILITY_CNSTXPR inline T &operator*() { return value_; }
+
+  /**
+   * @brief Dereferences the stored value (const version).
+   *
+   * @return A reference to the stored value.
+   */
+  MGUTILITY_CNSTXPR inline T &operator*() const { return value_; }
+
+  /**
+   * @brief Accesses the stored value.
+   *
+   * @return A reference to the stored value.
+   * @throws bad_optional_access if the optional has no value.
+   */
+  MGUTILITY_CNSTXPR inline T &value() {
+    if (!has_value_) {
+      throw bad_optional_access();
+    }
+    return value_;
+  }
+
+  /**
+   * @brief Accesses the stored value (const version).
+   *
+   * @return A reference to the stored value.
+   * @throws bad_optional_access if the optional has no value.
+   */
+  MGUTILITY_CNSTXPR inline T &value() const {
+    if (!has_value_) {
+      throw bad_optional_access();
+    }
+    return value_;
+  }
+
+  /**
+   * @brief Returns the stored value or a default value if empty.
+   *
+   * @param value The default value to return if empty.
+   * @return The stored value or the default value.
+   */
+  MGUTILITY_CNSTXPR inline T value_or(T &&value) {
+    return has_value_ ? value_ : std::move(value);
+  }
+
+  /**
+   * @brief Returns the stored value or a default value if empty (const
+   * version).
+   *
+   * @param value The default value to return if empty.
+   * @return The stored value or the default value.
+   */
+  MGUTILITY_CNSTXPR inline T value_or(T &&value) const {
+    return has_value_ ? value_ : std::move(value);
+  }
+
+  /**
+   * @brief Returns the stored value or a default value if empty.
+   *
+   * @param value The default value to return if empty.
+   * @return The stored value or the default value.
+   */
+  MGUTILITY_CNSTXPR inline T value_or(const T &value) {
+    return has_value_ ? value_ : value;
+  }
+
+  /**
+   * @brief Returns the stored value or a default value if empty (const
+   * version).
+   *
+   * @param value The default value to return if empty.
+   * @return The stored value or the default value.
+   */
+  MGUTILITY_CNSTXPR inline T value_or(const T &value) const {
+    return has_value_ ? value_ : value;
+  }
+
+  /**
+   * @brief Constructs the value in-place.
+   *
+   * @param value The value to emplace.
+   */
+  MGUTILITY_CNSTXPR inline void emplace(T value) {
+    value_ = std::move(value);
+    has_value_ = true;
+  }
+
+  /**
+   * @brief Constructs the value in-place with arguments.
+   *
+   * @tparam Args The types of the arguments.
+   * @param args The arguments to construct the value.
+   */
+  template <typename... Args>
+  MGUTILITY_CNSTXPR inline void emplace(Args &&...args) {
+    value_ = std::move(T{std::forward<Args>(args)...});
+    has_value_ = true;
+  }
+
+  /**
+   * @brief Checks if the optional has a value.
+   *
+   * @return True if the optional has a value, otherwise false.
+   */
+  MGUTILITY_CNSTXPR inline bool has_value() const { return has_value_; }
+
+  /**
+   * @brief Resets the optional, making it empty.
+   */
+  template <typename U = T,
+            detail::enable_if_t<!std::is_destructible<U>::value, bool> = true>
+  MGUTILITY_CNSTXPR inline void reset() {
+    value_ = T{};
+    has_value_ = false;
+  }
+
+  /**
+   * @brief Resets the optional, making it empty.
+   */
+  template <typename U = T,
+            detail::enable_if_t<std::is_destructible<T>::value, bool> = true>
+  MGUTILITY_CNSTXPR inline void reset() {
+    value_.~T();
+    has_value_ = false;
+  }
+
+  /**
+   * @brief Checks if the optional has a value.
+   *
+   * @return True if the optional has a value, otherwise false.
+   */
+  MGUTILITY_CNSTXPR operator bool() { return has_value_; }
+
+private:
+  union {
+    T value_;
+    char dummy_[sizeof(T)];
+  };
+  bool has_value_;
+};
+
+/**
+ * @brief Represents a null optional.
+ */
+struct nullopt_t {
+  /**
+   * @brief Converts nullopt_t to an empty optional.
+   *
+   * @tparam T The type of the optional.
+   * @return An empty optional.
+   */
+  template <typename T> MGUTILITY_CNSTXPR operator optional<T>() {
+    return optional<T>{};
+  }
+};
+
+/**
+ * @brief A global instance of nullopt_t to represent null optional.
+ */
+auto nullopt = nullopt_t{};
+
+#else
+/**
+ * @brief Alias template for std::optional.
+ *
+ * @tparam T The type of the value.
+ */
+template <typename T> using optional = std::optional<T>;
+
+/**
+ * @brief A global constant representing a null optional.
+ */
+inline constexpr auto nullopt{std::nullopt};
+
+#endif
+} // namespace mgutility
+
+#endif // DETAIL_OPTIONAL_HPP
+#include <array>
+#include <cstddef>
+
+namespace mgutility {
+
+/**
+ * @brief The result of to_enum_prefix.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_prefix_match {
+  /**
+   * @brief The value of the name equal to the prefix or, failing that, of the
+   * only name starting with it.
+   */
+  mgutility::optional<Enum> value;
+  std::size_t count; /**< The number of names starting with the prefix. */
+
+  /**
+   * @brief Checks whether several names start with the prefix and none of
+   * them is equal to it.
+   *
+   * @return True if the prefix is ambiguous, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto ambiguous() const noexcept -> bool {
+    return !value.has_value() && count > 1;
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Compares two names lexicographically, characters mapped by a name
+ * hash.
+ *
+ * @tparam Hasher The name hash, whose fold() maps the characters.
+ * @param lhs The left-hand side name.
+ * @param rhs The right-hand side name.
+ * @return A negative value, 0 or a positive value if lhs sorts before,
+ * with or after rhs.
+ */
+template <typename Hasher>
+MGUTILITY_CNSTXPR auto compare_names(mgutility::string_view lhs,
+                                     mgutility::string_view rhs) noexcept
+    -> int {
+  const auto size = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    const auto left = static_cast<unsigned char>(Hasher::fold(lhs[idx]));
+    const auto right = static_cast<unsigned char>(Hasher::fold(rhs[idx]));
+    if (left != right) {
+      return left < right ? -1 : 1;
+    }
+  }
+  return lhs.size() == rhs.size() ? 0 : lhs.size() < rhs.size() ? -1 : 1;
+}
+
+/**
+ * @brief The slots of the named values of an enum, sorted by name.
+ *
+ * @tparam N The capacity, at least the number of names.
+ * @tparam Slot The slot type.
+ */
+template <std::size_t N, typename Slot> struct enum_name_order {
+  std::size_t size{};          /**< The number of names. */
+  constant_array<Slot, N> slots{}; /**< The slots, in name order. */
+
+  /**
+   * @brief Finds the first position whose name, cut to the length of the
+   * prefix, sorts after the prefix or, with Upper, with or after it.
+   *
+   * @tparam Hasher The name hash the order was built with.
+   * @tparam Upper False for the first name not before the prefix, true for
+   * the first name past the names starting with it.
+   * @param prefix The prefix.
+   * @param names The name table the order was built from.
+   * @return The position.
+   */
+  template <typename Hasher, bool Upper, typename Names>
+  MGUTILITY_CNSTXPR auto bound(mgutility::string_view prefix,
+                               const Names &names) const noexcept
+      -> std::size_t {
+    std::size_t first = 0;
+    auto count = size;
+    while (count > 0) {
+      const auto half = count / 2;
+      const auto name = names[static_cast<std::size_t>(slots[first + half])];
+      const auto order = compare_names<Hasher>(
+          name.substr(0, prefix.size() < name.size() ? prefix.size()
+                                                     : name.size()),
+          prefix);
+      if (Upper ? order <= 0 : order < 0) {
+        first += half + 1;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+    return first;
+  }
+};
+
+/**
+ * @brief Checks whether a slot sorts before another one.
+ *
+ * Names equal under Hasher::fold() are ordered exactly, then by slot, so the
+ * order is total.
+ *
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param lhs The left-hand side slot.
+ * @param rhs The right-hand side slot.
+ * @param names The name table.
+ * @return True if lhs sorts before rhs, otherwise false.
+ */
+template <typename Hasher, typename Names>
+MGUTILITY_CNSTXPR auto slot_before(std::size_t lhs, std::size_t rhs,
+                                   const Names &names) noexcept -> bool {
+  const auto order = compare_names<Hasher>(names[lhs], names[rhs]);
+  if (order != 0) {
+    return order < 0;
+  }
+  const auto exact = compare_names<fnv_name_hasher>(names[lhs], names[rhs]);
+  return exact != 0 ? exact < 0 : lhs < rhs;
+}
+
+/**
+ * @brief Moves a slot down a max-heap of slots until the heap is ordered.
+ *
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param slots The slots.
+ * @param root The position of the slot.
+ * @param end The number of slots in the heap.
+ * @param names The name table.
+ */
+template <typename Hasher, typename Slots, typename Names>
+MGUTILITY_CNSTXPR void sift_slot(Slots &slots, std::size_t root,
+                                 std::size_t end, const Names &names) noexcept {
+  while (2 * root + 1 < end) {
+    auto child = 2 * root + 1;
+    if (child + 1 < end &&
+        slot_before<Hasher>(slots[child], slots[child + 1], names)) {
+      ++child;
+    }
+    if (!slot_before<Hasher>(slots[root], slots[child], names)) {
+      return;
+    }
+    const auto tmp = slots[root];
+    slots[root] = slots[child];
+    slots[child] = tmp;
+    root = child;
+  }
+}
+
+/**
+ * @brief Sorts the named slots of a name table by name.
+ *
+ * Heapsort, so building the order takes O(n log n) steps in constant
+ * evaluation whatever the names are.
+ *
+ * @tparam N The capacity of the order, at least the number of names.
+ * @tparam Slots The number of slots in the reflected range.
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param names The name table, indexed by slot.
+ * @return The order.
+ */
+template <std::size_t N, std::size_t Slots, typename Hasher, typename Names>
+MGUTILITY_CNSTXPR auto make_name_order(const Names &names) noexcept
+    -> enum_name_order<N, uint_fit_t<Slots>> {
+  using slot_type = uint_fit_t<Slots>;
+  enum_name_order<N, slot_type> order{};
+  for (std::size_t slot = 0; slot < Slots && order.size < N; ++slot) {
+    if (!names[slot].empty()) {
+      order.slots[order.size++] = static_cast<slot_type>(slot);
+    }
+  }
+
+  for (auto root = order.size / 2; root > 0; --root) {
+    sift_slot<Hasher>(order.slots, root - 1, order.size, names);
+  }
+  for (auto end = order.size; end > 1; --end) {
+    const auto tmp = order.slots[0];
+    order.slots[0] = order.slots[end - 1];
+    order.slots[end - 1] = tmp;
+    sift_slot<Hasher>(order.slots, 0, end - 1, names);
+  }
+  return order;
+}
+
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_PREFIX_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Checks for MSVC compiler version.
+ *
+ * If the MSVC version is less than 2017, an error is raised.
+ */
+#if defined(_MSC_VER) && _MSC_VER < 1910
+#error "Requires MSVC 2017 or newer!"
+/**
+ * @brief Checks for Clang compiler version.
+ *
+ * If the Clang version is less than 6, an error is raised.
+ */
+#elif defined(__clang__) && __clang_major__ < 6
+#error "Requires clang 6 or newer!"
+/**
+ * @brief Checks for GCC compiler version.
+ *
+ * If the GCC version is less than 9 and it is not Clang, an error is raised.
+ */
+#elif defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 9
+#error "Requires gcc 9 or newer!"
+/**
+ * @brief Checks for unsupported compilers.
+ *
+ * If the compiler is not MSVC, Clang, or GCC, an error is raised.
+ */
+#elif !defined(_MSC_VER) && !defined(__clang__) && !defined(__GNUC__)
+#error "Your compiler is not supported!"
+#endif
+
+/**
+ * @brief Defines the MGUTILITY_CPLUSPLUS macro for MSVC and other compilers.
+ *
+ * For MSVC, it uses _MSVC_LANG. For other compilers, it uses __cplusplus.
+ */
+#ifdef _MSC_VER
+#define __PRETTY_FUNCTION__ __FUNCSIG__
+#endif
+
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
+
+#ifndef MGUTILITY_STRLEN
+// NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
+#define MGUTILITY_STRLEN(x) sizeof(x) - 1
+#endif
+
+template <typename T, int Min, int Max>
+using enum_name_array =
+    std::array<mgutility::string_view, static_cast<std::size_t>(Max - Min)>;
+
+template <typename T>
+using enum_flag_array = std::array<mgutility::string_view, flag_bits<T>() + 1>;
+
+template <typename Enum, int Lo, std::size_t Count> struct enum_name_chunk;
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+/**
+ * @brief Names parsed from a probe signature in a constant expression, and
+ * where the token after them starts.
+ *
+ * @tparam Count The number of names.
+ */
+template <std::size_t Count> struct parsed_names {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  mgutility::string_view items[Count == 0 ? 1 : Count]; /**< The names. */
+  std::size_t next; /**< The position of the token after the names. */
+};
+
+/**
+ * @brief Finds a character in a string.
+ *
+ * @param str The string.
+ * @param chr The character.
+ * @param pos The position to start from.
+ * @return The position of the character, or the size of the string.
+ */
+constexpr auto find_char(mgutility::string_view str, char chr,
+                         std::size_t pos) noexcept -> std::size_t {
+  return pos >= str.size() || str[pos] == chr ? pos
+                                              : find_char(str, chr, pos + 1);
+}
+
+/**
+ * @brief Finds the last occurrence of a character before a position.
+ *
+ * @param str The string.
+ * @param chr The character.
+ * @param pos The position to search back from.
+ * @return The position of the character, or the size of the string.
+ */
+constexpr auto find_last_char(mgutility::string_view str, char chr,
+                              std::size_t pos) noexcept -> std::size_t {
+  return pos == 0                ? str.size()
+         : str[pos - 1] == chr ? pos - 1
+                               : find_last_char(str, chr, pos - 1);
+}
+
+/**
+ * @brief Checks whether a token is a value printed as a cast, i.e. a value
+ * without a name.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return True if the token has a parenthesis, otherwise false.
+ */
+constexpr auto is_cast_token(mgutility::string_view str, std::size_t first,
+                             std::size_t last) noexcept -> bool {
+  return first != last && (str[first] == '(' || str[first] == ')' ||
+                           is_cast_token(str, first + 1, last));
+}
+
+/**
+ * @brief Skips the scope qualifiers of a token.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return The position after the last ':' of the token, or first.
+ */
+constexpr auto skip_scope(mgutility::string_view str, std::size_t first,
+                          std::size_t last) noexcept -> std::size_t {
+  return last == first || str[last - 1] == ':'
+             ? last
+             : skip_scope(str, first, last - 1);
+}
+
+/**
+ * @brief Skips the blanks at the front of a token.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return The position of the first non-blank character, or last.
+ */
+constexpr auto skip_front_blanks(mgutility::string_view str,
+                                 std::size_t first, std::size_t last) noexcept
+    -> std::size_t {
+  return first < last && str[first] == ' '
+             ? skip_front_blanks(str, first + 1, last)
+             : first;
+}
+
+/**
+ * @brief Skips the blanks at the back of a token.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position past the token.
+ * @return The position past the last non-blank character, or first.
+ */
+constexpr auto skip_back_blanks(mgutility::string_view str,
+                                std::size_t first, std::size_t last) noexcept
+    -> std::size_t {
+  return last > first && str[last - 1] == ' '
+             ? skip_back_blanks(str, first, last - 1)
+             : last;
+}
+
+/**
+ * @brief Gets the name of a token without its blanks.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the name.
+ * @param last The position past the token.
+ * @return The name.
+ */
+constexpr auto trimmed_token(mgutility::string_view str, std::size_t first,
+                             std::size_t last) noexcept
+    -> mgutility::string_view {
+  return mgutility::string_view(str.data() + first,
+                                skip_back_blanks(str, first, last) - first);
+}
+
+/**
+ * @brief Gets the name of the value printed as a token of a probe signature.
+ *
+ * Mirrors enum_type::parse_names(): the part after the last scope qualifier
+ * is kept, and a value printed as a cast has no name.
+ *
+ * @param str The probe signature.
+ * @param first The first position of the token.
+ * @param last The position of the separator after the token.
+ * @return The name, or an empty string_view for a value without a name.
+ */
+constexpr auto token_name(mgutility::string_view str, std::size_t first,
+                          std::size_t last) noexcept
+    -> mgutility::string_view {
+  return is_cast_token(str, first, last)
+             ? mgutility::string_view{}
+             : trimmed_token(
+                   str,
+                   skip_front_blanks(str, skip_scope(str, first, last), last),
+                   last);
+}
+
+/**
+ * @brief Joins two runs of parsed names.
+ *
+ * @param left The first names.
+ * @param right The names following them.
+ * @return The names of both runs, ending where the right one ends.
+ */
+template <std::size_t Left, std::size_t Right, std::size_t... L,
+          std::size_t... R>
+constexpr auto join_names(const parsed_names<Left> &left,
+                          const parsed_names<Right> &right,
+                          index_sequence<L...> /*unused*/,
+                          index_sequence<R...> /*unused*/) noexcept
+    -> parsed_names<Left + Right> {
+  return parsed_names<Left + Right>{{left.items[L]..., right.items[R]...},
+                                    right.next};
+}
+
+/**
+ * @brief Splits the tokens of a probe signature into names in a C++11
+ * constant expression.
+ *
+ * C++11 constexpr functions cannot loop, so the tokens are split in halves:
+ * the recursion is only log2(Count) calls deep apart from the characters of
+ * a single token, and every character is visited once.
+ *
+ * @tparam Count The number of tokens to split.
+ */
+template <std::size_t Count> struct name_splitter {
+  static constexpr auto half = Count / 2;
+
+  /**
+   * @brief Splits tokens into names.
+   *
+   * @param str The probe signature.
+   * @param pos The position of the first token.
+   * @return The names of the tokens.
+   */
+  static constexpr auto split(mgutility::string_view str,
+                              std::size_t pos) noexcept
+      -> parsed_names<Count> {
+    return append(name_splitter<half>::split(str, pos), str);
+  }
+
+private:
+  static constexpr auto append(const parsed_names<half> &left,
+                               mgutility::string_view str) noexcept
+      -> parsed_names<Count> {
+    return join_names(left, name_splitter<Count - half>::split(str, left.next),
+                      make_probe_sequence<half>{},
+                      make_probe_sequence<Count - half>{});
+  }
+};
+
+/**
+ * @brief Specialization of name_splitter for a single token.
+ */
+template <> struct name_splitter<1> {
+  static constexpr auto split(mgutility::string_view str,
+                              std::size_t pos) noexcept -> parsed_names<1> {
+    return token(str, pos, find_char(str, ',', pos));
+  }
+
+private:
+  static constexpr auto token(mgutility::string_view str, std::size_t pos,
+                              std::size_t sep) noexcept -> parsed_names<1> {
+    return parsed_names<1>{{token_name(str, pos, sep)},
+                           sep < str.size() ? sep + 1 : sep};
+  }
+};
+
+/**
+ * @brief Specialization of name_splitter for no token.
+ */
+template <> struct name_splitter<0> {
+  static constexpr auto split(mgutility::string_view /*unused*/,
+                              std::size_t pos) noexcept -> parsed_names<0> {
+    return parsed_names<0>{{}, pos};
+  }
+};
+#endif
+
+/**
+ * @brief Provides functionality to extract and parse enum names at
+ * compile-time.
+ */
+struct enum_type {
+private:
+  /**
+   * @brief Extracts raw name from compiler's __PRETTY_FUNCTION__.
+   *
+   * @tparam Enum The enum type.
+   * @tparam e The enum value.
+   * @return The raw string_view from __PRETTY_FUNCTION__.
+   */
+  template <typename Enum, Enum... e>
+  constexpr static auto
+  raw_name(detail::enum_sequence<Enum, e...> /*unused*/) noexcept
+      -> mgutility::string_view {
+#if defined(__GNUC__) && !defined(__clang__)
+#define PREFIX                                                                 \
+  MGUTILITY_STRLEN("static constexpr mgutility::string_view "                  \
+                   "mgutility::detail::enum_type::raw_name(mgutility::detail:" \
+                   ":enum_sequence<Enum, e ...>) [with Enum = ")
+#elif defined(__clang__) || defined(__GNUC__)
+#define PREFIX                                                                 \
+  MGUTILITY_STRLEN("static mgutility::string_view "                            \
+                   "mgutility::detail::enum_type::raw_name(mgutility::detail:" \
+                   ":enum_sequence<Enum, e ...>) [with Enum = ")
+#elif defined(_MSC_VER)
+#if MGUTILITY_CPLUSPLUS > 201402L
+#define PREFIX                                                                 \
+  MGUTILITY_STRLEN(                                                            \
+      "class std::basic_string_view<char,struct std::char_traits<char> > "     \
+      "__cdecl mgutility::detail::enum_type::raw_name")
+#else
+#define PREFIX                                                                 \
+  MGUTILITY_STRLEN("class mgutility::basic_string_view<char> __cdecl "         \
+                   "mgutility::detail::enum_type::raw_name")
+#endif
+#else
+#define PREFIX 0
+#endif
+
+    return mgutility::string_view(__PRETTY_FUNCTION__ + PREFIX,
+                                  MGUTILITY_STRLEN(__PRETTY_FUNCTION__) -
+                                      PREFIX + 1);
+  }
+
+  /**
+   * @brief Parses the names of probed values from the raw string based on
+   * compiler.
+   *
+   * The probe must end with one extra value so that every parsed value is
+   * followed by a separator. The parsed names are views into the raw string;
+   * nothing is copied.
+   *
+   * @tparam Count The number of probed values to parse.
+   * @param str The raw string of the probe.
+   * @param result The array of names, indexed by slot.
+   * @param first The slot of the first probed value in the array.
+   */
+  template <std::size_t Count, typename Names>
+  MGUTILITY_CNSTXPR static void parse_names(mgutility::string_view str,
+                                            Names &result,
+                                            std::size_t first) noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+#if defined(__clang__)
+    auto end = str.rfind(']');
+#elif defined(__GNUC__) && !defined(__clang__)
+    auto end = str.rfind(';');
+#endif
+
+    auto enum_names = str.substr(0, end);
+
+#elif defined(_MSC_VER)
+    // MSVC: different format
+    auto pos = str.find(',');
+    if (pos == mgutility::string_view::npos)
+      return;
+
+    ++pos;
+
+    auto end = str.rfind('>');
+    auto enum_names = str.substr(pos, end - pos);
+
+#else
+    return;
+#endif
+
+    // One pass over the characters: a ',' ends a token, a '(' or ')' marks a
+    // value without a name (printed as a cast), and only the part after the
+    // last scope qualifier is kept.
+    const auto *const chars = enum_names.data();
+    const auto size = enum_names.size();
+    std::size_t begin = 0;
+    std::size_t idx = 0;
+    auto unnamed = false;
+
+    for (std::size_t pos = 0; pos < size; ++pos) {
+      switch (chars[pos]) {
+      case ':':
+        begin = pos + 1;
+        break;
+      case '(':
+      case ')':
+        unnamed = true;
+        break;
+      case ',': {
+        if (!unnamed) {
+          auto last = pos;
+          // remove whitespace
+          while (begin < last && chars[begin] == ' ') {
+            ++begin;
+          }
+          while (last > begin && chars[last - 1] == ' ') {
+            --last;
+          }
+          result[first + idx] =
+              mgutility::string_view(chars + begin, last - begin);
+        }
+        if (++idx == Count) {
+          return;
+        }
+        begin = pos + 1;
+        unnamed = false;
+        break;
+      }
+      default:
+        break;
+      }
+    }
+  }
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+  /**
+   * @brief Gets the part of a probe signature that holds the probed values,
+   * the way parse_names() cuts it.
+   *
+   * @param str The raw string of the probe.
+   * @return The probed values, separated by ','.
+   */
+  static constexpr auto probe_body(mgutility::string_view str) noexcept
+      -> mgutility::string_view {
+#if defined(__clang__)
+    return str.substr(0, find_last_char(str, ']', str.size()));
+#elif defined(__GNUC__)
+    return str.substr(0, find_last_char(str, ';', str.size()));
+#elif defined(_MSC_VER)
+    return find_char(str, ',', 0) == str.size()
+               ? mgutility::string_view{}
+               : str.substr(find_char(str, ',', 0) + 1,
+                            find_last_char(str, '>', str.size()) -
+                                find_char(str, ',', 0) - 1);
+#else
+    return mgutility::string_view{};
+#endif
+  }
+#endif
+
+  /**
+   * @brief Parses the names of one chunk of the range.
+   *
+   * The chunk is probed with one value past its end so that every value of
+   * the chunk is followed by a separator.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @param result The array of names, indexed by slot.
+   * @param first The slot of Lo in the array.
+   */
+  template <typename Enum, int Lo, std::size_t Count, typename Names>
+  MGUTILITY_CNSTXPR static void parse_chunk(Names &result,
+                                            std::size_t first) noexcept {
+    parse_names<Count>(
+        raw_name<Enum>(
+            detail::make_enum_sequence<Enum, Lo,
+                                       Lo + static_cast<int>(Count)>{}),
+        result, first);
+  }
+
+  /**
+   * @brief Loads the names of one chunk of the range into an array.
+   *
+   * From C++17 on the chunk is parsed in a constant evaluation of its own
+   * (see enum_name_chunk) and only its stored names are copied here, so the
+   * evaluation of a whole range never walks the probe signatures.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @param result The array of names, indexed by slot.
+   * @param first The slot of Lo in the array.
+   */
+  template <typename Enum, int Lo, std::size_t Count, typename Names>
+  MGUTILITY_CNSTXPR static void load_chunk(Names &result,
+                                           std::size_t first) noexcept {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    for (std::size_t idx = 0; idx < Count; ++idx) {
+      result[first + idx] = enum_name_chunk<Enum, Lo, Count>::names[idx];
+    }
+#else
+    parse_chunk<Enum, Lo, Count>(result, first);
+#endif
+  }
+
+  /**
+   * @brief Parses every chunk of the range into one array.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Min The minimum enum value.
+   * @tparam Slots The number of slots in the range.
+   * @tparam Chunk The chunk numbers.
+   * @param result The array of names, indexed by slot.
+   */
+  template <typename Enum, int Min, std::size_t Slots, typename Names,
+            std::size_t... Chunk>
+  MGUTILITY_CNSTXPR static void
+  parse_chunks(Names &result, index_sequence<Chunk...> /*unused*/) noexcept {
+    constexpr auto chunk = static_cast<std::size_t>(MGUTILITY_ENUM_PROBE_CHUNK);
+    // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+    const int expand[] = {
+        0, (load_chunk<Enum, Min + static_cast<int>(Chunk * chunk),
+                       (Slots - Chunk * chunk < chunk ? Slots - Chunk * chunk
+                                                      : chunk)>(
+                result, Chunk * chunk),
+            0)...};
+    static_cast<void>(expand);
+  }
+
+  /**
+   * @brief Parses the enum names of a range chunk by chunk.
+   *
+   * Each chunk of MGUTILITY_ENUM_PROBE_CHUNK values gets its own probe
+   * function, so the length of a single signature and the work of parsing it
+   * stay bounded however wide the range is; only the merge grows with the
+   * range.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Min The minimum enum value.
+   * @tparam Max The maximum enum value.
+   * @return The parsed enum names, indexed by slot.
+   */
+  template <typename Enum, int Min, int Max>
+  MGUTILITY_CNSTXPR static auto parse() noexcept
+      -> enum_name_array<Enum, Min, Max> {
+    static_assert(MGUTILITY_ENUM_PROBE_CHUNK > 0,
+                  "MGUTILITY_ENUM_PROBE_CHUNK must be positive!");
+    constexpr auto slots = static_cast<std::size_t>(Max - Min);
+    constexpr auto chunk = static_cast<std::size_t>(MGUTILITY_ENUM_PROBE_CHUNK);
+
+    enum_name_array<Enum, Min, Max> result{};
+    parse_chunks<Enum, Min, slots>(
+        result, make_probe_sequence<(slots + chunk - 1) / chunk>{});
+    return result;
+  }
+
+public:
+  /**
+   * @brief Gets the reflected names of the enum values in a range.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Min The minimum enum value.
+   * @tparam Max The maximum enum value.
+   * @return The reflected names, indexed by slot.
+   */
+  template <typename Enum, int Min, int Max>
+  MGUTILITY_CNSTXPR static auto name() noexcept
+      -> enum_name_array<Enum, Min, Max> {
+    return parse<Enum, Min, Max>();
+  }
+
+  /**
+   * @brief Gets the reflected names of one chunk of a range.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @return The reflected names, indexed from Lo, as views into the probe
+   * signature.
+   */
+  template <typename Enum, int Lo, std::size_t Count>
+  MGUTILITY_CNSTXPR static auto chunk() noexcept
+      -> std::array<mgutility::string_view, Count> {
+    std::array<mgutility::string_view, Count> result{};
+    parse_chunk<Enum, Lo, Count>(result, 0);
+    return result;
+  }
+
+  /**
+   * @brief Gets the reflected names of 0 and of each single bit of a flag
+   * enum.
+   *
+   * @tparam Enum The enum type.
+   * @return The reflected names: slot 0 holds the name of 0 and slot n + 1
+   * the name of bit n.
+   */
+  template <typename Enum>
+  MGUTILITY_CNSTXPR static auto flags() noexcept -> enum_flag_array<Enum> {
+    enum_flag_array<Enum> result{};
+    parse_names<flag_bits<Enum>() + 1>(
+        raw_name<Enum>(detail::make_flag_sequence<Enum>{}), result, 0);
+    return result;
+  }
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+  /**
+   * @brief Gets the reflected names of one chunk of a range in a constant
+   * expression.
+   *
+   * @tparam Enum The enum type.
+   * @tparam Lo The first enum value of the chunk.
+   * @tparam Count The number of enum values in the chunk.
+   * @return The names of the chunk.
+   */
+  template <typename Enum, int Lo, std::size_t Count>
+  static constexpr auto constant_chunk() noexcept -> parsed_names<Count> {
+    return name_splitter<Count>::split(
+        probe_body(raw_name<Enum>(
+            detail::make_enum_sequence<Enum, Lo,
+                                       Lo + static_cast<int>(Count)>{})),
+        0);
+  }
+
+  /**
+   * @brief Gets the reflected names of 0 and of each single bit of a flag
+   * enum in a constant expression.
+   *
+   * @tparam Enum The enum type.
+   * @return The reflected names: slot 0 holds the name of 0 and slot n + 1
+   * the name of bit n.
+   */
+  template <typename Enum>
+  static constexpr auto constant_flags() noexcept
+      -> parsed_names<flag_bits<Enum>() + 1> {
+    return name_splitter<flag_bits<Enum>() + 1>::split(
+        probe_body(raw_name<Enum>(detail::make_flag_sequence<Enum>{})), 0);
+  }
+#endif
+};
+
+/**
+ * @brief Total length and count of a set of enum names.
+ */
+struct enum_name_stats {
+  std::size_t size;  /**< Sum of the name lengths. */
+  std::size_t count; /**< Number of non-empty names. */
+};
+
+/**
+ * @brief Measures the names that a name table will have to store.
+ *
+ * @param names The array of names, indexed by slot.
+ * @return The total length and the count of the names.
+ */
+template <typename Names>
+MGUTILITY_CNSTXPR auto measure_names(const Names &names) noexcept
+    -> enum_name_stats {
+  enum_name_stats stats{0, 0};
+  for (std::size_t slot = 0; slot < names.size(); ++slot) {
+    stats.size += names[slot].size();
+    stats.count += names[slot].empty() ? 0 : 1;
+  }
+  return stats;
+}
+
+/**
+ * @brief Enum names stored back-to-back in a blob sized exactly to them.
+ *
+ * Names are kept in slot order, so one offset per slot is enough: the name of
+ * a slot spans from its offset to the offset of the next slot, and empty
+ * slots have a zero-length span. Offsets use the smallest unsigned type that
+ * can address the blob, so a lookup touches one small offset array and the
+ * blob.
+ *
+ * @tparam Size The total length of the names.
+ * @tparam Slots The number of slots in the reflected range.
+ */
+template <std::size_t Size, std::size_t Slots> struct enum_name_table {
+  using offset_type = uint_fit_t<Size>;
+
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  char strings[Size == 0 ? 1 : Size];
+  std::array<offset_type, Slots + 1> offsets;
+
+  /**
+   * @brief Gets the name stored for a slot.
+   *
+   * @param slot The slot within the reflected range.
+   * @return The name, or an empty view if the slot has none.
+   */
+  constexpr auto operator[](std::size_t slot) const noexcept
+      -> mgutility::string_view {
+    return mgutility::string_view(
+        strings + offsets[slot],
+        static_cast<std::size_t>(offsets[slot + 1] - offsets[slot]));
+  }
+
+  /**
+   * @brief Gets the number of slots.
+   *
+   * @return The number of slots in the reflected range.
+   */
+  static constexpr auto size() noexcept -> std::size_t { return Slots; }
+
+  /**
+   * @brief Gets the number of bytes the stored names occupy.
+   *
+   * @return The sum of the stored name lengths.
+   */
+  constexpr auto stored_size() const noexcept -> std::size_t {
+    return offsets[Slots];
+  }
+};
+
+/**
+ * @brief Copies names into an exactly sized name table.
+ *
+ * A name that does not fit is dropped rather than truncated, which makes
+ * stored_size() fall short of the measured size.
+ *
+ * @tparam Size The blob size, as measured by measure_names().
+ * @tparam Slots The number of slots in the reflected range.
+ * @param names The array of names, indexed by slot.
+ * @return The name table.
+ */
+template <std::size_t Size, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_name_table(const Names &names) noexcept
+    -> enum_name_table<Size, Slots> {
+  using offset_type = typename enum_name_table<Size, Slots>::offset_type;
+  enum_name_table<Size, Slots> table{};
+  std::size_t cursor = 0;
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    const auto name = names[slot];
+    table.offsets[slot] = static_cast<offset_type>(cursor);
+    if (cursor + name.size() > Size) {
+      continue;
+    }
+    for (std::size_t i = 0; i < name.size(); ++i) {
+      table.strings[cursor + i] = name[i];
+    }
+    cursor += name.size();
+  }
+  table.offsets[Slots] = static_cast<offset_type>(cursor);
+  return table;
+}
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+/**
+ * @brief The names of one probe chunk, copied out of its probe signature.
+ *
+ * Every chunk is measured and stored in its own constant evaluations, which
+ * keeps the constexpr operation count of each evaluation bounded by the chunk
+ * size. The tables only exist at compile time.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Lo The first enum value of the chunk.
+ * @tparam Count The number of enum values in the chunk.
+ */
+template <typename Enum, int Lo, std::size_t Count> struct enum_name_chunk {
+  static constexpr auto stats =
+      measure_names(enum_type::template chunk<Enum, Lo, Count>());
+
+  static constexpr auto names = make_name_table<stats.size, Count>(
+      enum_type::template chunk<Enum, Lo, Count>());
+};
+#else
+/**
+ * @brief The names of one probe chunk, as views into its probe signature.
+ *
+ * Every chunk is parsed in a constant evaluation of its own, which keeps the
+ * constexpr operation count of each evaluation bounded by the chunk size.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Lo The first enum value of the chunk.
+ * @tparam Count The number of enum values in the chunk.
+ */
+template <typename Enum, int Lo, std::size_t Count> struct enum_name_chunk {
+  static constexpr parsed_names<Count> names =
+      enum_type::template constant_chunk<Enum, Lo, Count>();
+};
+
+template <typename Enum, int Lo, std::size_t Count>
+constexpr parsed_names<Count> enum_name_chunk<Enum, Lo, Count>::names;
+
+/**
+ * @brief The reflected names of 0 and of each single bit of a flag enum, as
+ * views into their probe signature.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_flag_chunk {
+  static constexpr parsed_names<flag_bits<Enum>() + 1> names =
+      enum_type::template constant_flags<Enum>();
+};
+
+template <typename Enum>
+constexpr parsed_names<flag_bits<Enum>() + 1> enum_flag_chunk<Enum>::names;
+
+/**
+ * @brief Points at the name tables of the chunks of a range, so that the
+ * name of any slot can be read in a constant expression without copying the
+ * chunks into one table first.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Slots The number of slots in the range.
+ * @tparam Seq The chunk numbers.
+ */
+template <typename Enum, int Min, std::size_t Slots,
+          typename Seq = make_probe_sequence<
+              (Slots + MGUTILITY_ENUM_PROBE_CHUNK - 1) /
+              MGUTILITY_ENUM_PROBE_CHUNK>>
+struct enum_chunk_index;
+
+/**
+ * @brief Specialization of enum_chunk_index for the chunk numbers.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Slots The number of slots in the range.
+ * @tparam Chunk The chunk numbers.
+ */
+template <typename Enum, int Min, std::size_t Slots, std::size_t... Chunk>
+struct enum_chunk_index<Enum, Min, Slots, index_sequence<Chunk...>> {
+  static constexpr auto chunk =
+      static_cast<std::size_t>(MGUTILITY_ENUM_PROBE_CHUNK);
+
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  static constexpr const mgutility::string_view
+      *chunks[sizeof...(Chunk) == 0 ? 1 : sizeof...(Chunk)] = {
+          enum_name_chunk<Enum, Min + static_cast<int>(Chunk * chunk),
+                          (Slots - Chunk * chunk < chunk ? Slots - Chunk * chunk
+                                                         : chunk)>::names
+              .items...};
+
+  /**
+   * @brief Gets the reflected name of a slot.
+   *
+   * @param slot The slot.
+   * @return The name, as a view into the probe signature of its chunk.
+   */
+  static constexpr auto name(std::size_t slot) noexcept
+      -> mgutility::string_view {
+    return chunks[slot / chunk][slot % chunk];
+  }
+};
+
+template <typename Enum, int Min, std::size_t Slots, std::size_t... Chunk>
+// NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+constexpr const mgutility::string_view
+    *enum_chunk_index<Enum, Min, Slots, index_sequence<Chunk...>>::chunks
+        [sizeof...(Chunk) == 0 ? 1 : sizeof...(Chunk)];
+#endif
+
+/**
+ * @brief Gets the bits of an enum value, without sign extension.
+ *
+ * @tparam Enum The enum type.
+ * @param value The enum value.
+ * @return The bits of the value.
+ */
+template <typename Enum>
+constexpr auto flag_value(Enum value) noexcept -> std::uint64_t {
+  return static_cast<std::uint64_t>(static_cast<flag_type_t<Enum>>(value));
+}
+
+/**
+ * @brief Gets the enum value of a set of bits.
+ *
+ * @tparam Enum The enum type.
+ * @param bits The bits of the value.
+ * @return The enum value.
+ */
+template <typename Enum>
+constexpr auto flag_enum(std::uint64_t bits) noexcept -> Enum {
+  return static_cast<Enum>(static_cast<underlying_type_t<Enum>>(
+      static_cast<flag_type_t<Enum>>(bits)));
+}
+
+/**
+ * @brief Gets the slot of a flag value in a flag name table.
+ *
+ * @param bits The bits of the value.
+ * @return 0 for no bits, n + 1 for the single bit n, otherwise npos.
+ */
+constexpr auto flag_slot(std::uint64_t bits) noexcept -> std::size_t {
+  return bits == 0                   ? 0
+         : (bits & (bits - 1)) == 0 ? count_trailing_zeros(bits) + 1
+                                    : static_cast<std::size_t>(-1);
+}
+
+/**
+ * @brief A composite mask of a bitmask enum and its name.
+ */
+struct enum_mask {
+  std::uint64_t mask;          /**< The bits of the composite value. */
+  mgutility::string_view name; /**< The name of the composite value. */
+};
+
+/**
+ * @brief Precomputed masks used to format the values of a bitmask enum.
+ *
+ * Every bit of the underlying type maps to the slot of its name, so the set
+ * bits of a value are resolved one by one with count-trailing-zeros. Named
+ * values with several bits set are kept apart, ordered by popcount from the
+ * widest down, to be matched greedily before the single bits.
+ *
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Composites The capacity of the composite list.
+ */
+template <std::size_t Bits, std::size_t Slots, std::size_t Composites>
+struct enum_mask_list {
+  using slot_type = uint_fit_t<Slots>;
+
+  constant_array<slot_type, Bits> bit_slots{}; /**< Slots if unnamed. */
+  constant_array<enum_mask, Composites> composites{}; /**< Widest first. */
+  std::size_t composite_count{}; /**< Number of composites in the list. */
+
+  /**
+   * @brief Adds a named value to the list.
+   *
+   * A single bit keeps the first slot it is given; a composite is inserted
+   * after the composites with at least as many bits.
+   *
+   * @param bits The bits of the value.
+   * @param name The name of the value.
+   * @param slot The slot of the name in the name table.
+   */
+  MGUTILITY_CNSTXPR void add(std::uint64_t bits, mgutility::string_view name,
+                             std::size_t slot) noexcept {
+    if (bits == 0 || name.empty()) {
+      return;
+    }
+    if ((bits & (bits - 1)) == 0) {
+      auto &bit_slot = bit_slots[count_trailing_zeros(bits)];
+      if (bit_slot == static_cast<slot_type>(Slots)) {
+        bit_slot = static_cast<slot_type>(slot);
+      }
+      return;
+    }
+    if (composite_count == Composites) {
+      return;
+    }
+    auto pos = composite_count++;
+    for (; pos > 0 && count_bits(composites[pos - 1].mask) < count_bits(bits);
+         --pos) {
+      composites[pos] = composites[pos - 1];
+    }
+    composites[pos] = enum_mask{bits, name};
+  }
+};
+
+/**
+ * @brief Creates an empty mask list, with every bit unnamed.
+ *
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Composites The capacity of the composite list.
+ * @return The mask list.
+ */
+template <std::size_t Bits, std::size_t Slots, std::size_t Composites>
+MGUTILITY_CNSTXPR auto make_mask_list() noexcept
+    -> enum_mask_list<Bits, Slots, Composites> {
+  using list_type = enum_mask_list<Bits, Slots, Composites>;
+  list_type list{};
+  for (std::size_t bit = 0; bit < Bits; ++bit) {
+    list.bit_slots[bit] = static_cast<typename list_type::slot_type>(Slots);
+  }
+  return list;
+}
+
+/**
+ * @brief Counts the named values of a range with several bits set.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @param names The name table, indexed by slot.
+ * @return The number of composite values.
+ */
+template <typename Enum, int Min, typename Names>
+MGUTILITY_CNSTXPR auto count_range_composites(const Names &names) noexcept
+    -> std::size_t {
+  std::size_t count = 0;
+  for (std::size_t slot = 0; slot < names.size(); ++slot) {
+    count += !names[slot].empty() &&
+                     count_bits(flag_value(static_cast<Enum>(
+                         Min + static_cast<int>(slot)))) > 1
+                 ? 1
+                 : 0;
+  }
+  return count;
+}
+
+/**
+ * @brief Builds the mask list of a bitmask enum reflected over a range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Composites The capacity of the composite list.
+ * @param names The name table, indexed by slot.
+ * @return The mask list.
+ */
+template <typename Enum, int Min, std::size_t Slots, std::size_t Composites,
+          typename Names>
+MGUTILITY_CNSTXPR auto make_range_masks(const Names &names) noexcept
+    -> enum_mask_list<flag_bits<Enum>(), Slots, Composites> {
+  auto list = make_mask_list<flag_bits<Enum>(), Slots, Composites>();
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    list.add(flag_value(static_cast<Enum>(Min + static_cast<int>(slot))),
+             names[slot], slot);
+  }
+  return list;
+}
+
+/**
+ * @brief Gets the number of entries in the custom names map of an enum.
+ *
+ * @tparam Enum The enum type.
+ * @return The number of custom names.
+ */
+template <typename Enum>
+constexpr auto custom_map_size() noexcept -> std::size_t {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+  return mgutility::custom_enum<Enum>::map.size();
+#else
+  return sizeof(mgutility::custom_enum<Enum>::map) /
+         sizeof(mgutility::custom_enum<Enum>::map[0]);
+#endif
+}
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+/**
+ * @brief Gets an entry of the custom names map of an enum.
+ *
+ * @tparam Enum The enum type.
+ * @param idx The index of the entry.
+ * @return The entry.
+ */
+template <typename Enum>
+constexpr auto custom_map_entry(std::size_t idx) noexcept
+    -> const mgutility::pair<Enum, const char *> & {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+  return mgutility::custom_enum<Enum>::map.begin()[idx];
+#else
+  return mgutility::custom_enum<Enum>::map[idx];
+#endif
+}
+
+/**
+ * @brief Resolves the name of a range slot against the custom names map.
+ *
+ * The map is searched from its last entry, so that a later entry wins as it
+ * does in enum_array_cache::apply_custom().
+ *
+ * @tparam Enum The enum type.
+ * @param value The value of the slot.
+ * @param name The reflected name of the slot.
+ * @param count The number of map entries left to search.
+ * @return The custom name of the value if it has one, otherwise name.
+ */
+template <typename Enum>
+constexpr auto custom_range_name(Enum value, mgutility::string_view name,
+                                 std::size_t count) noexcept
+    -> mgutility::string_view {
+  return count == 0 ? name
+         : custom_map_entry<Enum>(count - 1).first == value
+             ? mgutility::string_view(custom_map_entry<Enum>(count - 1).second)
+             : custom_range_name(value, name, count - 1);
+}
+
+/**
+ * @brief Resolves the name of a flag slot against the custom names map.
+ *
+ * @tparam Enum The enum type.
+ * @param slot The flag slot.
+ * @param name The reflected name of the slot.
+ * @param count The number of map entries left to search.
+ * @return The custom name of the slot if it has one, otherwise name.
+ */
+template <typename Enum>
+constexpr auto custom_flag_name(std::size_t slot, mgutility::string_view name,
+                                std::size_t count) noexcept
+    -> mgutility::string_view {
+  return count == 0 ? name
+         : flag_slot(flag_value(custom_map_entry<Enum>(count - 1).first)) ==
+                 slot
+             ? mgutility::string_view(custom_map_entry<Enum>(count - 1).second)
+             : custom_flag_name<Enum>(slot, name, count - 1);
+}
+
+/**
+ * @brief Builds the name table of a range in a constant expression, custom
+ * names applied.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam I The slots.
+ * @return The resolved name table.
+ */
+template <typename Enum, int Min, int Max, std::size_t... I>
+constexpr auto make_constant_names(index_sequence<I...> /*unused*/) noexcept
+    -> enum_name_array<Enum, Min, Max> {
+  return enum_name_array<Enum, Min, Max>{{custom_range_name(
+      static_cast<Enum>(Min + static_cast<int>(I)),
+      enum_chunk_index<Enum, Min, sizeof...(I)>::name(I),
+      custom_map_size<Enum>())...}};
+}
+
+/**
+ * @brief Builds the flag name table of a flag enum in a constant expression,
+ * custom names applied.
+ *
+ * @tparam Enum The enum type.
+ * @tparam I The flag slots.
+ * @param names The reflected names, indexed by flag slot.
+ * @return The resolved flag name table.
+ */
+template <typename Enum, std::size_t... I>
+constexpr auto make_constant_flags(const parsed_names<sizeof...(I)> &names,
+                                   index_sequence<I...> /*unused*/) noexcept
+    -> enum_flag_array<Enum> {
+  return enum_flag_array<Enum>{{custom_flag_name<Enum>(
+      I, names.items[I], custom_map_size<Enum>())...}};
+}
+#endif
+
+/**
+ * @brief Builds the mask list of a flag enum.
+ *
+ * Bit n is named by slot n + 1 of the flag name table; composites come from
+ * the custom names map, which is the only source of names with several bits
+ * set.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Slots The number of slots of the flag name table.
+ * @param names The flag name table, indexed by flag slot.
+ * @return The mask list.
+ */
+template <typename Enum, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_flag_masks(const Names &names) noexcept
+    -> enum_mask_list<flag_bits<Enum>(), Slots, custom_map_size<Enum>()> {
+  auto list =
+      make_mask_list<flag_bits<Enum>(), Slots, custom_map_size<Enum>()>();
+  for (std::size_t slot = 1; slot < Slots; ++slot) {
+    list.add(std::uint64_t{1} << (slot - 1), names[slot], slot);
+  }
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+  constexpr auto map = mgutility::custom_enum<Enum>::map;
+  for (const auto &pair : map) {
+#else
+  for (const auto &pair : mgutility::custom_enum<Enum>::map) {
+#endif
+    const auto bits = flag_value(pair.first);
+    if (count_bits(bits) > 1) {
+      list.add(bits, pair.second, Slots);
+    }
+  }
+  return list;
+}
+
+#if MGUTILITY_CPLUSPLUS < 201402L
+/**
+ * @brief The mask list of a bitmask enum as a constant aggregate (C++11).
+ *
+ * Same layout as enum_mask_list, without its default member initializers, so
+ * that it can be brace-initialized from packs in a constant expression.
+ *
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Composites The number of composites.
+ */
+template <std::size_t Bits, std::size_t Slots, std::size_t Composites>
+struct constant_mask_list {
+  using slot_type = uint_fit_t<Slots>;
+
+  std::array<slot_type, Bits> bit_slots;     /**< Slots if the bit is unnamed. */
+  std::array<enum_mask, Composites> composites; /**< Widest first. */
+  std::size_t composite_count; /**< Number of composites in the list. */
+};
+
+/**
+ * @brief The named values of a range, as a source of masks (C++11).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Slots The number of slots in the range.
+ */
+template <typename Enum, int Min, std::size_t Slots> struct range_mask_source {
+  static constexpr auto size = Slots;
+
+  static constexpr auto bits(std::size_t slot) noexcept -> std::uint64_t {
+    return flag_value(static_cast<Enum>(Min + static_cast<int>(slot)));
+  }
+
+  static constexpr auto name(std::size_t slot) noexcept
+      -> mgutility::string_view {
+    return custom_range_name(static_cast<Enum>(Min + static_cast<int>(slot)),
+                             enum_chunk_index<Enum, Min, Slots>::name(slot),
+                             custom_map_size<Enum>());
+  }
+
+  /**
+   * @brief Gets the popcount of a named composite, 0 for any other slot.
+   */
+  static constexpr auto width(std::size_t slot) noexcept -> std::size_t {
+    return count_bits(bits(slot)) > 1 && !name(slot).empty()
+               ? count_bits(bits(slot))
+               : 0;
+  }
+
+  static constexpr auto item(std::size_t slot) noexcept -> enum_mask {
+    return enum_mask{bits(slot), name(slot)};
+  }
+
+  static constexpr auto named_slot(long long slot) noexcept -> std::size_t {
+    return slot >= 0 && slot < static_cast<long long>(Slots) &&
+                   !name(static_cast<std::size_t>(slot)).empty()
+               ? static_cast<std::size_t>(slot)
+               : Slots;
+  }
+
+  /**
+   * @brief Gets the slot that names a single bit, Slots if it is unnamed.
+   */
+  static constexpr auto bit_slot(std::size_t bit) noexcept -> std::size_t {
+    return named_slot(static_cast<long long>(static_cast<underlying_type_t<Enum>>(
+                          flag_enum<Enum>(std::uint64_t{1} << bit))) -
+                      Min);
+  }
+};
+
+/**
+ * @brief The named values of a flag enum, as a source of masks (C++11).
+ *
+ * Single bits are named by the flag slots, composites by the custom names
+ * map.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct flag_mask_source {
+  static constexpr auto size = custom_map_size<Enum>();
+
+  static constexpr auto bits(std::size_t idx) noexcept -> std::uint64_t {
+    return flag_value(custom_map_entry<Enum>(idx).first);
+  }
+
+  static constexpr auto name(std::size_t idx) noexcept
+      -> mgutility::string_view {
+    return mgutility::string_view(custom_map_entry<Enum>(idx).second);
+  }
+
+  static constexpr auto width(std::size_t idx) noexcept -> std::size_t {
+    return count_bits(bits(idx)) > 1 && !name(idx).empty()
+               ? count_bits(bits(idx))
+               : 0;
+  }
+
+  static constexpr auto item(std::size_t idx) noexcept -> enum_mask {
+    return enum_mask{bits(idx), name(idx)};
+  }
+
+  static constexpr auto bit_slot(std::size_t bit) noexcept -> std::size_t {
+    return custom_flag_name<Enum>(bit + 1,
+                                  enum_flag_chunk<Enum>::names.items[bit + 1],
+                                  custom_map_size<Enum>())
+                   .empty()
+               ? flag_bits<Enum>() + 1
+               : bit + 1;
+  }
+};
+
+/**
+ * @brief Counts and selects the composites of a mask source by width in a
+ * constant expression (C++11).
+ *
+ * C++11 constexpr functions cannot loop, so ranges are halved instead, which
+ * keeps the recursion depth logarithmic in the size of the source.
+ *
+ * @tparam Source The mask source.
+ */
+template <typename Source> struct composite_search {
+  /**
+   * @brief Counts the composites of a width in [first, last).
+   */
+  static constexpr auto count(std::size_t width, std::size_t first,
+                              std::size_t last) noexcept -> std::size_t {
+    return last - first == 0 ? 0
+           : last - first == 1
+               ? (Source::width(first) == width ? 1 : 0)
+               : count(width, first, first + (last - first) / 2) +
+                     count(width, first + (last - first) / 2, last);
+  }
+
+  /**
+   * @brief Finds the nth composite of a width in [first, last).
+   */
+  static constexpr auto select(std::size_t width, std::size_t nth,
+                               std::size_t first, std::size_t last) noexcept
+      -> std::size_t {
+    return last - first == 1
+               ? first
+               : select_half(width, nth, first, first + (last - first) / 2,
+                             last,
+                             count(width, first, first + (last - first) / 2));
+  }
+
+  static constexpr auto select_half(std::size_t width, std::size_t nth,
+                                    std::size_t first, std::size_t mid,
+                                    std::size_t last, std::size_t left) noexcept
+      -> std::size_t {
+    return nth < left ? select(width, nth, first, mid)
+                      : select(width, nth - left, mid, last);
+  }
+};
+
+/**
+ * @brief The number of composites of each width of a mask source (C++11).
+ *
+ * @tparam Source The mask source.
+ * @tparam Seq The widths, 0 to 64.
+ */
+template <typename Source, typename Seq = make_probe_sequence<65>>
+struct composite_widths;
+
+/**
+ * @brief Specialization of composite_widths for the widths.
+ *
+ * @tparam Source The mask source.
+ * @tparam Width The widths.
+ */
+template <typename Source, std::size_t... Width>
+struct composite_widths<Source, index_sequence<Width...>> {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  static constexpr std::size_t counts[sizeof...(Width)] = {
+      (Width < 2 ? 0
+                 : composite_search<Source>::count(Width, 0, Source::size))...};
+
+  /**
+   * @brief Counts the composites no wider than a width.
+   */
+  static constexpr auto total(std::size_t width) noexcept -> std::size_t {
+    return width < 2 ? 0 : counts[width] + total(width - 1);
+  }
+
+  /**
+   * @brief Gets the nth composite, widest first and in source order within
+   * a width, counting from the given width down.
+   */
+  static constexpr auto nth(std::size_t idx, std::size_t width) noexcept
+      -> enum_mask {
+    return idx < counts[width]
+               ? Source::item(composite_search<Source>::select(
+                     width, idx, 0, Source::size))
+               : nth(idx - counts[width], width - 1);
+  }
+};
+
+template <typename Source, std::size_t... Width>
+// NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+constexpr std::size_t
+    composite_widths<Source, index_sequence<Width...>>::counts
+        [sizeof...(Width)];
+
+/**
+ * @brief Builds the mask list of a mask source in a constant expression
+ * (C++11), in the order enum_mask_list::add() gives.
+ *
+ * @tparam Source The mask source.
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam BitSeq The bits.
+ * @tparam CompositeSeq The composite positions.
+ */
+template <typename Source, std::size_t Bits, std::size_t Slots,
+          typename BitSeq = make_probe_sequence<Bits>,
+          typename CompositeSeq =
+              make_probe_sequence<composite_widths<Source>::total(64)>>
+struct constant_masks;
+
+/**
+ * @brief Specialization of constant_masks for the bits and composite
+ * positions.
+ *
+ * @tparam Source The mask source.
+ * @tparam Bits The number of bits of the underlying type.
+ * @tparam Slots The number of slots of the name table.
+ * @tparam Bit The bits.
+ * @tparam Composite The composite positions.
+ */
+template <typename Source, std::size_t Bits, std::size_t Slots,
+          std::size_t... Bit, std::size_t... Composite>
+struct constant_masks<Source, Bits, Slots, index_sequence<Bit...>,
+                      index_sequence<Composite...>> {
+  using list_type = constant_mask_list<Bits, Slots, sizeof...(Composite)>;
+
+  static constexpr list_type list{
+      {{static_cast<typename list_type::slot_type>(
+          Source::bit_slot(Bit))...}},
+      {{composite_widths<Source>::nth(Composite, 64)...}},
+      sizeof...(Composite)};
+};
+
+template <typename Source, std::size_t Bits, std::size_t Slots,
+          std::size_t... Bit, std::size_t... Composite>
+constexpr typename constant_masks<Source, Bits, Slots, index_sequence<Bit...>,
+                                  index_sequence<Composite...>>::list_type
+    constant_masks<Source, Bits, Slots, index_sequence<Bit...>,
+                   index_sequence<Composite...>>::list;
+#endif
+
+/**
+ * @brief The named values of an enum, in ascending order.
+ *
+ * @tparam T The stored item, a slot of a range or the bits of a flag value.
+ * @tparam N The capacity of the list.
+ */
+template <typename T, std::size_t N> struct enum_value_list {
+  static constexpr auto capacity = N;
+
+  std::size_t size{};       /**< Number of values in the list. */
+  constant_array<T, N> items{}; /**< The values, ascending. */
+
+  /**
+   * @brief Adds a value to the list, after the values not greater than it.
+   *
+   * @param item The value.
+   */
+  MGUTILITY_CNSTXPR void insert(T item) noexcept {
+    if (size == N) {
+      return;
+    }
+    auto pos = size++;
+    for (; pos > 0 && items[pos - 1] > item; --pos) {
+      items[pos] = items[pos - 1];
+    }
+    items[pos] = item;
+  }
+};
+
+/**
+ * @brief Lists the named slots of a range, in slot order.
+ *
+ * @tparam N The capacity of the list, at least the number of names.
+ * @tparam Slots The number of slots in the reflected range.
+ * @param names The name table, indexed by slot.
+ * @return The list of named slots.
+ */
+template <std::size_t N, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_slot_list(const Names &names) noexcept
+    -> enum_value_list<uint_fit_t<Slots>, N> {
+  enum_value_list<uint_fit_t<Slots>, N> list{};
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    if (!names[slot].empty()) {
+      list.insert(static_cast<uint_fit_t<Slots>>(slot));
+    }
+  }
+  return list;
+}
+
+/**
+ * @brief Lists the named values of a flag enum, ascending by their bits.
+ *
+ * Covers 0 and the single bits named in the flag name table, and the
+ * composites of the mask list.
+ *
+ * @tparam N The capacity of the list, at least the number of names.
+ * @param names The flag name table, indexed by flag slot.
+ * @param masks The mask list of the flag enum.
+ * @return The list of named values.
+ */
+template <std::size_t N, typename Names, typename Masks>
+MGUTILITY_CNSTXPR auto make_flag_value_list(const Names &names,
+                                            const Masks &masks) noexcept
+    -> enum_value_list<std::uint64_t, N> {
+  enum_value_list<std::uint64_t, N> list{};
+  for (std::size_t slot = 0; slot < names.size(); ++slot) {
+    if (!names[slot].empty()) {
+      list.insert(slot == 0 ? 0 : std::uint64_t{1} << (slot - 1));
+    }
+  }
+  for (std::size_t idx = 0; idx < masks.composite_count; ++idx) {
+    list.insert(masks.composites[idx].mask);
+  }
+  return list;
+}
+
+/**
+ * @brief Counts, for every slot of a range, the named slots before it.
+ *
+ * Slot s is named when entries s and s + 1 differ, so the table answers
+ * both the ordinal of a value and its neighbours in O(1).
+ *
+ * @tparam N The number of names in the range.
+ * @tparam Slots The number of slots in the reflected range.
+ * @param names The name table, indexed by slot.
+ * @return The rank table, with one more entry than there are slots.
+ */
+template <std::size_t N, std::size_t Slots, typename Names>
+MGUTILITY_CNSTXPR auto make_rank_table(const Names &names) noexcept
+    -> constant_array<uint_fit_t<N>, Slots + 1> {
+  constant_array<uint_fit_t<N>, Slots + 1> ranks{};
+  std::size_t rank = 0;
+  for (std::size_t slot = 0; slot < Slots; ++slot) {
+    ranks[slot] = static_cast<uint_fit_t<N>>(rank);
+    rank += !names[slot].empty() && rank < N ? 1 : 0;
+  }
+  ranks[Slots] = static_cast<uint_fit_t<N>>(rank);
+  return ranks;
+}
+
+/**
+ * @brief Appends the hexadecimal form of a value, with a 0x prefix.
+ *
+ * @param str The string to append to.
+ * @param value The value.
+ */
+template <typename String>
+MGUTILITY_CNSTXPR void append_hex(String &str, std::uint64_t value) noexcept {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  char digits[18]{'0', 'x'};
+  std::size_t nibbles = 1;
+  while (nibbles < 16 && (value >> (4U * nibbles)) != 0) {
+    ++nibbles;
+  }
+  for (std::size_t idx = 0; idx < nibbles; ++idx) {
+    digits[2 + idx] =
+        "0123456789abcdef"[(value >> (4U * (nibbles - 1 - idx))) & 0xFU];
+  }
+  str.append(mgutility::string_view(digits, 2 + nibbles));
+}
+
+/**
+ * @brief Writes names into a caller provided buffer.
+ *
+ * Every name is copied with one memcpy, cut at the end of the buffer, and
+ * every byte is counted, so `size` ends up as the number of bytes the whole
+ * text needs.
+ */
+struct buffer_sink {
+  char *out;        /**< The buffer. */
+  std::size_t cap;  /**< The capacity of the buffer. */
+  std::size_t size; /**< The number of bytes appended so far. */
+
+  /**
+   * @brief Appends a string, as much of it as fits.
+   *
+   * @param str The string.
+   * @return This sink.
+   */
+  auto append(mgutility::string_view str) noexcept -> buffer_sink & {
+    if (size < cap) {
+      const auto len = (std::min)(str.size(), cap - size);
+      std::memcpy(out + size, str.data(), len);
+    }
+    size += str.size();
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes names through an output iterator.
+ *
+ * @tparam OutputIt The output iterator type.
+ */
+template <typename OutputIt> struct iterator_sink {
+  OutputIt out; /**< The position to write the next character to. */
+
+  /**
+   * @brief Appends a string.
+   *
+   * @param str The string.
+   * @return This sink.
+   */
+  MGUTILITY_CNSTXPR auto append(mgutility::string_view str)
+      -> iterator_sink & {
+    out = std::copy(str.data(), str.data() + str.size(), out);
+    return *this;
+  }
+};
+
+/**
+ * @brief Appends names to a std::string.
+ */
+struct string_sink {
+  std::string &str; /**< The string to append to. */
+
+  /**
+   * @brief Appends a string.
+   *
+   * @param name The string.
+   * @return This sink.
+   */
+  auto append(mgutility::string_view name) -> string_sink & {
+    str.append(name.data(), name.size());
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes names into a fixed_string, cut at its capacity.
+ *
+ * fixed_string::append does not check the room left, so every string is cut
+ * to it first: a text longer than the buffer keeps its leading bytes, as
+ * enum_name_to does with a char buffer.
+ *
+ * @tparam N The capacity of the fixed_string, its terminator included.
+ */
+template <std::size_t N> struct fixed_string_sink {
+  static_assert(N > 0, "The name buffer needs room for its terminator!");
+
+  mgutility::fixed_string<N> &str; /**< The string to append to. */
+
+  /**
+   * @brief Appends a string, as much of it as fits.
+   *
+   * @param name The string.
+   * @return This sink.
+   */
+  MGUTILITY_CNSTXPR auto append(mgutility::string_view name) noexcept
+      -> fixed_string_sink & {
+    const auto room = N - 1 - str.size();
+    str.append(mgutility::string_view(
+        name.data(), name.size() < room ? name.size() : room));
+    return *this;
+  }
+};
+
+/**
+ * @brief Writes a bitmask value from its precomputed masks.
+ *
+ * Composites are matched greedily from the widest down, then the remaining
+ * set bits are walked with count-trailing-zeros. Bits without a name are
+ * appended as one hexadecimal suffix, so a value without any named bit is
+ * written as its hexadecimal form alone and no set bit is lost.
+ *
+ * @tparam Sink A type with an append(string_view) member, such as one of
+ * the sinks above.
+ * @param bits The bits of the value.
+ * @param names The name table the masks refer to.
+ * @param masks The mask list of the enum.
+ * @param sink The sink the names, joined with '|', are appended to.
+ */
+template <typename Names, typename Masks, typename Sink>
+MGUTILITY_CNSTXPR void write_bitmask(std::uint64_t bits, const Names &names,
+                                     const Masks &masks, Sink &sink) {
+  auto named = false;
+
+  for (std::size_t idx = 0; idx < masks.composite_count; ++idx) {
+    const auto &composite = masks.composites[idx];
+    if ((bits & composite.mask) == composite.mask) {
+      if (named) {
+        sink.append("|");
+      }
+      sink.append(composite.name);
+      named = true;
+      bits &= ~composite.mask;
+    }
+  }
+
+  std::uint64_t unknown = 0;
+  for (; bits != 0; bits &= bits - 1) {
+    const auto slot =
+        static_cast<std::size_t>(masks.bit_slots[count_trailing_zeros(bits)]);
+    if (slot < names.size()) {
+      if (named) {
+        sink.append("|");
+      }
+      sink.append(names[slot]);
+      named = true;
+    } else {
+      unknown |= bits & (~bits + 1);
+    }
+  }
+
+  if (unknown != 0) {
+    if (named) {
+      sink.append("|");
+    }
+    append_hex(sink, unknown);
+  }
+}
+
+/**
+ * @brief Caches an array of enum names for a given enum sequence.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Seq The enum sequence.
+ */
+template <typename Enum, int Min, int Max> struct enum_array_cache;
+
+/**
+ * @brief Specialization of enum_array_cache for enum_sequence.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Is The enum values.
+ */
+template <typename Enum, int Min, int Max> struct enum_array_cache {
+  static constexpr auto slots = static_cast<std::size_t>(Max - Min);
+
+  static MGUTILITY_CNSTXPR auto
+  apply_custom(enum_name_array<Enum, Min, Max> arr) noexcept
+      -> enum_name_array<Enum, Min, Max> {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+    constexpr auto map = mgutility::custom_enum<Enum>::map;
+    for (const auto &pair : map) {
+#else
+    for (const auto &pair : mgutility::custom_enum<Enum>::map) {
+#endif
+      if (pair.first >= static_cast<Enum>(Min) &&
+          pair.first < static_cast<Enum>(Max)) {
+        arr[static_cast<std::size_t>(pair.first) - Min] = pair.second;
+      }
+    }
+
+    return arr;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+
+  /**
+   * @brief Total length and count of the resolved names (first pass).
+   */
+  static constexpr auto stats =
+      measure_names(apply_custom(enum_type::template name<Enum, Min, Max>()));
+
+  /**
+   * @brief The resolved name table, custom names applied, indexed by slot
+   * (second pass, sized by the first one).
+   */
+  using table_type = enum_name_table<stats.size, slots>;
+
+  static constexpr auto names = make_name_table<stats.size, slots>(
+      apply_custom(enum_type::template name<Enum, Min, Max>()));
+
+  static_assert(names.stored_size() == stats.size,
+                "Enum names do not fit the name table!");
+
+  static constexpr auto name_count = stats.count;
+
+  static constexpr auto name_index =
+      make_name_hash_index<name_count, slots>(names);
+
+  static_assert(name_index.collision_free,
+                "Enum name hash index is not collision-free!");
+
+  static constexpr auto composite_count =
+      count_range_composites<Enum, Min>(names);
+
+  static constexpr auto masks =
+      make_range_masks<Enum, Min, slots, composite_count>(names);
+
+  using values_type = enum_value_list<uint_fit_t<slots>, name_count>;
+
+  static constexpr auto values = make_slot_list<name_count, slots>(names);
+
+  static constexpr auto ranks = make_rank_table<name_count, slots>(names);
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  using padded_hasher = padded_name_hasher<MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  static constexpr auto padded_index =
+      make_name_hash_index<name_count, slots, padded_hasher>(
+          padded_names_view<MGUTILITY_ENUM_NAME_PADDED_SLOTS, table_type>{
+              names});
+
+  static_assert(padded_index.collision_free,
+                "Padded enum name hash index is not collision-free!");
+
+  static constexpr auto padded_names =
+      make_padded_name_table(padded_index, names);
+#endif
+
+#else
+  using table_type = enum_name_array<Enum, Min, Max>;
+
+  // C++11: constant table of views into the probe signatures, custom names
+  // applied, so nothing is parsed at runtime
+  static constexpr table_type name_table =
+      make_constant_names<Enum, Min, Max>(make_probe_sequence<slots>{});
+
+  static constexpr auto names() noexcept -> const table_type & {
+    return name_table;
+  }
+
+#if MGUTILITY_CPLUSPLUS >= 201402L
+  // C++14: the other tables are constants too, sized by the names like the
+  // C++17 ones
+  static constexpr std::size_t name_count = measure_names(name_table).count;
+
+  using index_type = enum_name_hash_index<name_count, slots>;
+
+  static constexpr index_type index_table =
+      make_name_hash_index<name_count, slots>(name_table);
+
+  static_assert(index_table.collision_free,
+                "Enum name hash index is not collision-free!");
+
+  static constexpr auto name_index() noexcept -> const index_type & {
+    return index_table;
+  }
+
+  static constexpr std::size_t composite_count =
+      count_range_composites<Enum, Min>(name_table);
+
+  using masks_type = enum_mask_list<flag_bits<Enum>(), slots, composite_count>;
+
+  static constexpr masks_type mask_table =
+      make_range_masks<Enum, Min, slots, composite_count>(name_table);
+
+  static constexpr auto masks() noexcept -> const masks_type & {
+    return mask_table;
+  }
+
+  using values_type = enum_value_list<uint_fit_t<slots>, name_count>;
+
+  static constexpr values_type value_table =
+      make_slot_list<name_count, slots>(name_table);
+
+  static constexpr auto values() noexcept -> const values_type & {
+    return value_table;
+  }
+
+  using ranks_type = constant_array<uint_fit_t<name_count>, slots + 1>;
+
+  static constexpr ranks_type rank_table =
+      make_rank_table<name_count, slots>(name_table);
+
+  static constexpr auto ranks() noexcept -> const ranks_type & {
+    return rank_table;
+  }
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  using padded_hasher = padded_name_hasher<MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  using padded_index_type =
+      enum_name_hash_index<name_count, slots, padded_hasher>;
+
+  static constexpr padded_index_type padded_index_table =
+      make_name_hash_index<name_count, slots, padded_hasher>(
+          padded_names_view<MGUTILITY_ENUM_NAME_PADDED_SLOTS, table_type>{
+              name_table});
+
+  static_assert(padded_index_table.collision_free,
+                "Padded enum name hash index is not collision-free!");
+
+  static constexpr auto padded_index() noexcept -> const padded_index_type & {
+    return padded_index_table;
+  }
+
+  using padded_table_type =
+      padded_name_table<name_count, MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  static constexpr padded_table_type padded_table =
+      make_padded_name_table(padded_index_table, name_table);
+
+  static constexpr auto padded_names() noexcept -> const padded_table_type & {
+    return padded_table;
+  }
+#endif
+#else
+  // C++11: constant mask list, so enum_name of a bitmask value builds nothing
+  // at runtime
+  static constexpr auto masks() noexcept -> const typename constant_masks<
+      range_mask_source<Enum, Min, slots>, flag_bits<Enum>(), slots>::list_type & {
+    return constant_masks<range_mask_source<Enum, Min, slots>,
+                          flag_bits<Enum>(), slots>::list;
+  }
+
+  // C++11: lazy runtime index, sized for the whole range
+  static auto name_index() -> const enum_name_hash_index<slots, slots> & {
+    static const auto index = make_name_hash_index<slots, slots>(names());
+
+    return index;
+  }
+
+  using values_type = enum_value_list<uint_fit_t<slots>, slots>;
+
+  // C++11: lazy runtime list of the named slots
+  static auto values() -> const values_type & {
+    static const auto list = make_slot_list<slots, slots>(names());
+
+    return list;
+  }
+
+  // C++11: lazy runtime rank table, one entry per slot and one past the end
+  static auto ranks() -> const constant_array<uint_fit_t<slots>, slots + 1> & {
+    static const auto table = make_rank_table<slots, slots>(names());
+
+    return table;
+  }
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  using padded_hasher = padded_name_hasher<MGUTILITY_ENUM_NAME_PADDED_SLOTS>;
+
+  // C++11: lazy runtime index over the names that fit a padded slot
+  static auto padded_index()
+      -> const enum_name_hash_index<slots, slots, padded_hasher> & {
+    static const auto index = make_name_hash_index<slots, slots, padded_hasher>(
+        padded_names_view<MGUTILITY_ENUM_NAME_PADDED_SLOTS, table_type>{
+            names()});
+
+    return index;
+  }
+
+  // C++11: lazy runtime padded names, one per position of padded_index()
+  static auto padded_names()
+      -> const padded_name_table<slots, MGUTILITY_ENUM_NAME_PADDED_SLOTS> & {
+    static const auto table = make_padded_name_table(padded_index(), names());
+
+    return table;
+  }
+#endif
+#endif
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::table_type
+    enum_array_cache<Enum, Min, Max>::name_table;
+#endif
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Enum, int Min, int Max>
+constexpr std::size_t enum_array_cache<Enum, Min, Max>::name_count;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::index_type
+    enum_array_cache<Enum, Min, Max>::index_table;
+
+template <typename Enum, int Min, int Max>
+constexpr std::size_t enum_array_cache<Enum, Min, Max>::composite_count;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::masks_type
+    enum_array_cache<Enum, Min, Max>::mask_table;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::values_type
+    enum_array_cache<Enum, Min, Max>::value_table;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::ranks_type
+    enum_array_cache<Enum, Min, Max>::rank_table;
+
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::padded_index_type
+    enum_array_cache<Enum, Min, Max>::padded_index_table;
+
+template <typename Enum, int Min, int Max>
+constexpr typename enum_array_cache<Enum, Min, Max>::padded_table_type
+    enum_array_cache<Enum, Min, Max>::padded_table;
+#endif
+#endif
+
+/**
+ * @brief Gets the resolved array of enum names for the enum type within the
+ * specified range.
+ *
+ * The array is built once per enum and range; callers get a reference to it.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @return A reference to the name table, indexable by slot like an array of
+ * string_views.
+ */
+template <typename Enum, int Min = mgutility::enum_range<Enum>::min,
+          int Max = mgutility::enum_range<Enum>::max>
+constexpr auto get_enum_array() noexcept
+    -> const typename enum_array_cache<Enum, Min, Max>::table_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_array_cache<Enum, Min, Max>::names;
+#else
+  return enum_array_cache<Enum, Min, Max>::names();
+#endif
+}
+
+/**
+ * @brief Caches the names of 0 and of each single bit of a flag enum.
+ *
+ * Only 0 and the bits of the underlying type are probed, so a flag enum
+ * costs at most 65 probes whatever its widest flag is, and enum_range is not
+ * used.
+ *
+ * @tparam Enum The enum type.
+ */
+template <typename Enum> struct enum_flag_cache {
+  static constexpr auto slots = flag_bits<Enum>() + 1;
+
+  static MGUTILITY_CNSTXPR auto
+  apply_custom(enum_flag_array<Enum> arr) noexcept -> enum_flag_array<Enum> {
+#if MGUTILITY_CPLUSPLUS >= 201402L || defined(__GNUC__) && !defined(__clang__)
+    constexpr auto map = mgutility::custom_enum<Enum>::map;
+    for (const auto &pair : map) {
+#else
+    for (const auto &pair : mgutility::custom_enum<Enum>::map) {
+#endif
+      const auto slot = flag_slot(flag_value(pair.first));
+      if (slot < slots) {
+        arr[slot] = pair.second;
+      }
+    }
+
+    return arr;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+
+  /**
+   * @brief Total length and count of the resolved names (first pass).
+   */
+  static constexpr auto stats =
+      measure_names(apply_custom(enum_type::template flags<Enum>()));
+
+  /**
+   * @brief The resolved name table, custom names applied, indexed by flag
+   * slot (second pass, sized by the first one).
+   */
+  using table_type = enum_name_table<stats.size, slots>;
+
+  static constexpr auto names = make_name_table<stats.size, slots>(
+      apply_custom(enum_type::template flags<Enum>()));
+
+  static_assert(names.stored_size() == stats.size,
+                "Enum flag names do not fit the name table!");
+
+  static constexpr auto name_count = stats.count;
+
+  static constexpr auto name_index =
+      make_name_hash_index<name_count, slots>(names);
+
+  static_assert(name_index.collision_free,
+                "Enum flag name hash index is not collision-free!");
+
+  static constexpr auto masks = make_flag_masks<Enum, slots>(names);
+
+  using values_type =
+      enum_value_list<std::uint64_t, name_count + masks.composite_count>;
+
+  static constexpr auto values =
+      make_flag_value_list<name_count + masks.composite_count>(names, masks);
+
+#else
+  using table_type = enum_flag_array<Enum>;
+
+  // C++11: constant table of views into the probe signature, custom names
+  // applied, so nothing is parsed at runtime
+  static constexpr table_type name_table = make_constant_flags<Enum>(
+      enum_flag_chunk<Enum>::names, make_probe_sequence<slots>{});
+
+  static constexpr auto names() noexcept -> const table_type & {
+    return name_table;
+  }
+
+#if MGUTILITY_CPLUSPLUS >= 201402L
+  // C++14: the other tables are constants too, sized by the names like the
+  // C++17 ones
+  static constexpr std::size_t name_count = measure_names(name_table).count;
+
+  using index_type = enum_name_hash_index<name_count, slots>;
+
+  static constexpr index_type index_table =
+      make_name_hash_index<name_count, slots>(name_table);
+
+  static_assert(index_table.collision_free,
+                "Enum flag name hash index is not collision-free!");
+
+  static constexpr auto name_index() noexcept -> const index_type & {
+    return index_table;
+  }
+
+  using masks_type =
+      enum_mask_list<flag_bits<Enum>(), slots, custom_map_size<Enum>()>;
+
+  static constexpr masks_type mask_table =
+      make_flag_masks<Enum, slots>(name_table);
+
+  static constexpr auto masks() noexcept -> const masks_type & {
+    return mask_table;
+  }
+
+  using values_type =
+      enum_value_list<std::uint64_t, name_count + mask_table.composite_count>;
+
+  static constexpr values_type value_table =
+      make_flag_value_list<name_count + mask_table.composite_count>(
+          name_table, mask_table);
+
+  static constexpr auto values() noexcept -> const values_type & {
+    return value_table;
+  }
+#else
+  // C++11: constant mask list, so enum_name of a flag value builds nothing
+  // at runtime
+  static constexpr auto masks() noexcept -> const typename constant_masks<
+      flag_mask_source<Enum>, flag_bits<Enum>(), slots>::list_type & {
+    return constant_masks<flag_mask_source<Enum>, flag_bits<Enum>(),
+                          slots>::list;
+  }
+
+  // C++11: lazy runtime index, sized for every flag slot
+  static auto name_index() -> const enum_name_hash_index<slots, slots> & {
+    static const auto index = make_name_hash_index<slots, slots>(names());
+
+    return index;
+  }
+
+  using values_type =
+      enum_value_list<std::uint64_t, slots + custom_map_size<Enum>()>;
+
+  // C++11: lazy runtime list of the named values
+  static auto values() -> const values_type & {
+    static const auto list =
+        make_flag_value_list<slots + custom_map_size<Enum>()>(names(), masks());
+
+    return list;
+  }
+#endif
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS <= 201402L
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::table_type
+    enum_flag_cache<Enum>::name_table;
+#endif
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Enum>
+constexpr std::size_t enum_flag_cache<Enum>::name_count;
+
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::index_type
+    enum_flag_cache<Enum>::index_table;
+
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::masks_type
+    enum_flag_cache<Enum>::mask_table;
+
+template <typename Enum>
+constexpr typename enum_flag_cache<Enum>::values_type
+    enum_flag_cache<Enum>::value_table;
+#endif
+
+/**
+ * @brief Gets the resolved flag name table of a flag enum.
+ *
+ * @tparam Enum The enum type.
+ * @return A reference to the name table, indexable by flag slot like an
+ * array of string_views.
+ */
+template <typename Enum>
+constexpr auto get_enum_flags() noexcept
+    -> const typename enum_flag_cache<Enum>::table_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_flag_cache<Enum>::names;
+#else
+  return enum_flag_cache<Enum>::names();
+#endif
+}
+
+/**
+ * @brief Selects the name index of a name cache for a name hash.
+ *
+ * @tparam Cache The name cache, enum_array_cache or enum_flag_cache.
+ * @tparam Hasher The name hash of the index.
+ */
+template <typename Cache, typename Hasher> struct name_index_of;
+
+/**
+ * @brief The exact name index, owned by the name cache itself.
+ *
+ * @tparam Cache The name cache.
+ */
+template <typename Cache> struct name_index_of<Cache, fnv_name_hasher> {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static constexpr auto get() noexcept -> decltype((Cache::name_index)) {
+    return Cache::name_index;
+  }
+#else
+  static auto get() -> decltype(Cache::name_index()) {
+    return Cache::name_index();
+  }
+#endif
+};
+
+/**
+ * @brief The case-insensitive name index of a name cache.
+ *
+ * Kept apart from the cache, so it is only built for enums that are looked
+ * up case-insensitively. It indexes the names of the cache in place, so no
+ * folded copy of them is stored.
+ *
+ * @tparam Cache The name cache.
+ */
+template <typename Cache> struct name_index_of<Cache, folded_name_hasher> {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static constexpr auto index =
+      make_name_hash_index<Cache::name_count, Cache::slots,
+                           folded_name_hasher>(Cache::names);
+
+  static_assert(index.collision_free,
+                "Folded enum name hash index is not collision-free!");
+
+  static_assert(names_unambiguous(index, Cache::names),
+                "Enum names differ only in case, so they are ambiguous when "
+                "compared case-insensitively!");
+
+  static constexpr auto get() noexcept -> decltype((index)) { return index; }
+#elif MGUTILITY_CPLUSPLUS >= 201402L
+  using index_type = enum_name_hash_index<Cache::name_count, Cache::slots,
+                                          folded_name_hasher>;
+
+  static constexpr index_type index =
+      make_name_hash_index<Cache::name_count, Cache::slots,
+                           folded_name_hasher>(Cache::name_table);
+
+  static_assert(index.collision_free,
+                "Folded enum name hash index is not collision-free!");
+
+  static_assert(names_unambiguous(index, Cache::name_table),
+                "Enum names differ only in case, so they are ambiguous when "
+                "compared case-insensitively!");
+
+  static constexpr auto get() noexcept -> const index_type & { return index; }
+#else
+  // C++11: lazy runtime index, sized for every slot
+  static auto get() -> const
+      enum_name_hash_index<Cache::slots, Cache::slots, folded_name_hasher> & {
+    static const auto index =
+        make_name_hash_index<Cache::slots, Cache::slots, folded_name_hasher>(
+            Cache::names());
+
+    return index;
+  }
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Cache>
+constexpr typename name_index_of<Cache, folded_name_hasher>::index_type
+    name_index_of<Cache, folded_name_hasher>::index;
+#endif
+
+/**
+ * @brief Gets the list of named values of an enum reflected over a range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @return A reference to the list of named slots.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto get_enum_values() noexcept
+    -> const typename enum_array_cache<Enum, Min, Max>::values_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_array_cache<Enum, Min, Max>::values;
+#else
+  return enum_array_cache<Enum, Min, Max>::values();
+#endif
+}
+
+/**
+ * @brief Gets the list of named values of a flag enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @return A reference to the list of named values.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto get_enum_values() noexcept
+    -> const typename enum_flag_cache<Enum>::values_type & {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  return enum_flag_cache<Enum>::values;
+#else
+  return enum_flag_cache<Enum>::values();
+#endif
+}
+
+/**
+ * @brief Selects the cache that holds the named values of an enum.
+ *
+ * Only the selected cache is instantiated, so a range enum never reflects
+ * its flags and the other way around.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ */
+template <typename Enum, int Min, int Max,
+          bool Flags = enum_flags<Enum>::value>
+struct enum_value_source {
+  using type = typename enum_array_cache<Enum, Min, Max>::values_type;
+};
+
+template <typename Enum, int Min, int Max>
+struct enum_value_source<Enum, Min, Max, true> {
+  using type = typename enum_flag_cache<Enum>::values_type;
+};
+
+/**
+ * @brief The number of named values an enum can have, known at compile
+ * time: exact in C++14 and later, the whole range in C++11.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ */
+template <typename Enum, int Min, int Max>
+constexpr auto enum_capacity() noexcept -> std::size_t {
+  return enum_value_source<Enum, Min, Max>::type::capacity;
+}
+
+/**
+ * @brief Gets the named value at a position of a range enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param idx The position, less than the number of named values.
+ * @return The enum value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto nth_enum_value(std::size_t idx) noexcept -> Enum {
+  return static_cast<Enum>(
+      static_cast<int>(get_enum_values<Enum, Min, Max>().items[idx]) + Min);
+}
+
+/**
+ * @brief Gets the named value at a position of a flag enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param idx The position, less than the number of named values.
+ * @return The enum value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto nth_enum_value(std::size_t idx) noexcept -> Enum {
+  return flag_enum<Enum>(get_enum_values<Enum, Min, Max>().items[idx]);
+}
+
+/**
+ * @brief Where a value falls among the named values of its enum.
+ */
+struct enum_rank {
+  std::size_t before; /**< Number of named values below the value. */
+  bool named;         /**< Whether the value itself is named. */
+};
+
+/**
+ * @brief Ranks a value of a range enum, in O(1) through the rank table.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param value The enum value.
+ * @return The rank of the value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto rank_enum_value(Enum value) noexcept -> enum_rank {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &ranks = enum_array_cache<Enum, Min, Max>::ranks;
+#else
+  const auto &ranks = enum_array_cache<Enum, Min, Max>::ranks();
+#endif
+  const auto raw = static_cast<int>(value);
+  if (raw < Min) {
+    return enum_rank{0, false};
+  }
+  const auto slot = static_cast<std::size_t>(static_cast<unsigned>(raw) -
+                                             static_cast<unsigned>(Min));
+  if (slot + 1 >= ranks.size()) {
+    return enum_rank{ranks[ranks.size() - 1], false};
+  }
+  return enum_rank{ranks[slot], ranks[slot + 1] != ranks[slot]};
+}
+
+/**
+ * @brief Ranks a value of a flag enum.
+ *
+ * Flag values span the whole underlying type, so the sorted value list is
+ * searched instead of indexed; it holds at most one entry per bit, 0 and
+ * the custom composites.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param value The enum value.
+ * @return The rank of the value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto rank_enum_value(Enum value) noexcept -> enum_rank {
+  const auto &values = get_enum_values<Enum, Min, Max>();
+  const auto bits = flag_value(value);
+  std::size_t first = 0;
+  std::size_t last = values.size;
+  while (first < last) {
+    const auto mid = first + (last - first) / 2;
+    if (values.items[mid] < bits) {
+      first = mid + 1;
+    } else {
+      last = mid;
+    }
+  }
+  return enum_rank{first, first < values.size && values.items[first] == bits};
+}
+
+/**
+ * @brief The named slots of a name cache in name order, for prefix lookups.
+ *
+ * Kept apart from the cache, so it is only built for enums that are looked
+ * up by prefix.
+ *
+ * @tparam Cache The name cache.
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ */
+template <typename Cache, typename Hasher> struct name_order_of {
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static constexpr auto order =
+      make_name_order<Cache::name_count, Cache::slots, Hasher>(Cache::names);
+
+  static constexpr auto get() noexcept -> decltype((order)) { return order; }
+#elif MGUTILITY_CPLUSPLUS >= 201402L
+  using order_type =
+      enum_name_order<Cache::name_count, uint_fit_t<Cache::slots>>;
+
+  static constexpr order_type order =
+      make_name_order<Cache::name_count, Cache::slots, Hasher>(
+          Cache::name_table);
+
+  static constexpr auto get() noexcept -> const order_type & { return order; }
+#else
+  // C++11: lazy runtime order, sized for every slot
+  static auto get()
+      -> const enum_name_order<Cache::slots, uint_fit_t<Cache::slots>> & {
+    static const auto order =
+        make_name_order<Cache::slots, Cache::slots, Hasher>(Cache::names());
+
+    return order;
+  }
+#endif
+};
+
+#if MGUTILITY_CPLUSPLUS == 201402L
+template <typename Cache, typename Hasher>
+constexpr typename name_order_of<Cache, Hasher>::order_type
+    name_order_of<Cache, Hasher>::order;
+#endif
+
+/**
+ * @brief Finds the slot of an enum name.
+ *
+ * Uses the padded name layout at runtime when it is enabled, the name fits a
+ * padded slot and the lookup is exact, otherwise the perfect hash index of
+ * enum_array_cache for the name hash.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The name.
+ * @return The slot of the name within the range, or static_cast<size_t>(-1).
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+MGUTILITY_CNSTXPR inline auto find_enum_slot(mgutility::string_view str) noexcept
+    -> std::size_t {
+#if defined(MGUTILITY_ENUM_NAME_PADDED)
+  if (std::is_same<Hasher, fnv_name_hasher>::value &&
+      !MGUTILITY_IS_CONSTANT_EVALUATED() &&
+      str.size() <= MGUTILITY_ENUM_NAME_PADDED_SLOTS) {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    return find_padded_name(enum_array_cache<Enum, Min, Max>::padded_index,
+                            enum_array_cache<Enum, Min, Max>::padded_names,
+                            str);
+#else
+    return find_padded_name(enum_array_cache<Enum, Min, Max>::padded_index(),
+                            enum_array_cache<Enum, Min, Max>::padded_names(),
+                            str);
+#endif
+  }
+#endif
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  constexpr auto &index =
+      name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#else
+  const auto &index =
+      name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#endif
+
+  return index.find(str, get_enum_array<Enum, Min, Max>());
+}
+
+/**
+ * @brief Converts a string to an enum value.
+ *
+ * Looks the name up with find_enum_slot().
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The string view representing the enum name.
+ * @return An optional enum value.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+MGUTILITY_CNSTXPR inline auto to_enum_impl(mgutility::string_view str) noexcept
+    -> mgutility::optional<Enum> {
+  const auto slot = find_enum_slot<Enum, Min, Max, Hasher>(str);
+  return slot == static_cast<std::size_t>(-1)
+             ? mgutility::nullopt
+             : mgutility::optional<Enum>{
+                   static_cast<Enum>(static_cast<int>(slot) + Min)};
+}
+
+/**
+ * @brief Converts a prefix of a name to an enum value.
+ *
+ * Two binary searches over the names in name order find the names starting
+ * with the prefix; a name equal to the prefix sorts first among them.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The prefix.
+ * @return The match.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+MGUTILITY_CNSTXPR auto to_enum_prefix_impl(mgutility::string_view str) noexcept
+    -> enum_prefix_match<Enum> {
+  if (str.empty()) {
+    return enum_prefix_match<Enum>{mgutility::nullopt, 0};
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  constexpr auto &order =
+      name_order_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#else
+  const auto &order =
+      name_order_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#endif
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto first = order.template bound<Hasher, false>(str, names);
+  const auto last = order.template bound<Hasher, true>(str, names);
+  const auto count = last - first;
+  if (count == 0) {
+    return enum_prefix_match<Enum>{mgutility::nullopt, 0};
+  }
+
+  const auto slot = static_cast<std::size_t>(order.slots[first]);
+  const auto exact = Hasher::equal(names[slot], str) &&
+                     (count == 1 || !Hasher::equal(
+                                        names[static_cast<std::size_t>(
+                                            order.slots[first + 1])],
+                                        str));
+  if (count == 1 || exact) {
+    return enum_prefix_match<Enum>{
+        mgutility::optional<Enum>{
+            static_cast<Enum>(static_cast<int>(slot) + Min)},
+        count};
+  }
+  return enum_prefix_match<Enum>{mgutility::nullopt, count};
+}
+
+/**
+ * @brief Checks whether a character is a blank that may surround names.
+ *
+ * @param chr The character.
+ * @return True for a space or a tab, otherwise false.
+ */
+constexpr auto is_blank(char chr) noexcept -> bool {
+  return chr == ' ' || chr == '\t';
+}
+
+/**
+ * @brief Removes the blanks around a string.
+ *
+ * @param str The string.
+ * @return The string without leading and trailing blanks.
+ */
+MGUTILITY_CNSTXPR inline auto trim_blanks(mgutility::string_view str) noexcept
+    -> mgutility::string_view {
+  std::size_t begin = 0;
+  auto end = str.size();
+  while (begin < end && is_blank(str[begin])) {
+    ++begin;
+  }
+  while (end > begin && is_blank(str[end - 1])) {
+    --end;
+  }
+  return str.substr(begin, end - begin);
+}
+
+/**
+ * @brief Checks whether a separator starts at a position of a string.
+ *
+ * @param str The string.
+ * @param pos The position.
+ * @param sep The separator.
+ * @return True if str continues with sep at pos, otherwise false.
+ */
+MGUTILITY_CNSTXPR inline auto at_separator(mgutility::string_view str,
+                                           std::size_t pos,
+                                           mgutility::string_view sep) noexcept
+    -> bool {
+  return sep.size() == 1 ? str[pos] == sep[0]
+                         : str.size() - pos >= sep.size() &&
+                               equal_names(str.substr(pos, sep.size()), sep);
+}
+
+/**
+ * @brief Scans separated names in one pass, handing each one to a visitor.
+ *
+ * Every name is hashed while it is scanned for the next separator, so its
+ * lookup costs one index probe and one compare. Blanks around names and
+ * separators are ignored, and the separator itself is matched without its
+ * surrounding blanks, so "A|B", "A | B" and, with ", ", "A,B" are all
+ * accepted. An empty name, or one the visitor rejects, fails the whole
+ * scan.
+ *
+ * @tparam Hasher The name hash the names are hashed with.
+ * @tparam Visit The visitor, called as visit(name, hash) and returning
+ * whether it accepted the name.
+ * @param str The string view representing the names.
+ * @param separator The separator between names.
+ * @param visit The visitor.
+ * @return True if every name was accepted, otherwise false.
+ */
+template <typename Hasher = fnv_name_hasher, typename Visit>
+MGUTILITY_CNSTXPR auto scan_names(mgutility::string_view str,
+                                  mgutility::string_view separator,
+                                  Visit &visit) noexcept -> bool {
+  auto sep = trim_blanks(separator);
+  if (sep.empty()) {
+    sep = mgutility::string_view("|", 1);
+  }
+
+  const auto size = str.size();
+  const auto lead = sep[0];
+  std::size_t pos = 0;
+
+  while (true) {
+    while (pos < size && is_blank(str[pos])) {
+      ++pos;
+    }
+
+    const auto begin = pos;
+    auto hash = name_hash_seed;
+    while (pos < size) {
+      const auto chr = str[pos];
+      if (static_cast<unsigned char>(chr) <= ' ' ||
+          (chr == lead && at_separator(str, pos, sep))) {
+        break;
+      }
+      hash = Hasher::step(hash, chr);
+      ++pos;
+    }
+
+    if (pos == begin || !visit(str.substr(begin, pos - begin), hash)) {
+      return false;
+    }
+
+    while (pos < size && is_blank(str[pos])) {
+      ++pos;
+    }
+
+    if (pos == size) {
+      return true;
+    }
+    if (!at_separator(str, pos, sep)) {
+      return false;
+    }
+    pos += sep.size();
+  }
+}
+
+/**
+ * @brief Collects the bits of the names scan_names() visits.
+ *
+ * @tparam Lookup The name lookup, called as lookup(name, hash, bits) and
+ * returning whether it found the name and ORed its bits into bits.
+ */
+template <typename Lookup> struct bitmask_collector {
+  const Lookup &lookup; /**< The name lookup. */
+  std::uint64_t bits;   /**< The bits collected so far. */
+
+  /**
+   * @brief Looks a name up and collects its bits.
+   *
+   * @param name The name.
+   * @param hash The name_hash() of the name.
+   * @return True if the name was found, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                    std::uint64_t hash) noexcept -> bool {
+    return lookup(name, hash, bits);
+  }
+};
+
+/**
+ * @brief Parses separated names into the bits of a bitmask value in one pass.
+ *
+ * See scan_names() for the accepted syntax.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Lookup The name lookup, called as lookup(name, hash, bits) and
+ * returning whether it found the name and ORed its bits into bits; its
+ * `hasher` type is the name hash the names are hashed with.
+ * @param str The string view representing the names.
+ * @param separator The separator between names.
+ * @param lookup The name lookup.
+ * @return An optional enum value.
+ */
+template <typename Enum, typename Lookup>
+MGUTILITY_CNSTXPR auto parse_bitmask(mgutility::string_view str,
+                                     mgutility::string_view separator,
+                                     const Lookup &lookup) noexcept
+    -> mgutility::optional<Enum> {
+  bitmask_collector<Lookup> collector{lookup, 0};
+  if (!scan_names<typename Lookup::hasher>(str, separator, collector)) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<Enum>{flag_enum<Enum>(collector.bits)};
+}
+
+/**
+ * @brief Looks up the names of a bitmask enum reflected over a range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher>
+struct range_name_lookup {
+  using hasher = Hasher;
+
+  /**
+   * @brief Looks a name up and ORs the bits of its value into bits.
+   *
+   * @param name The name.
+   * @param hash The Hasher::hash() of the name.
+   * @param bits The bits parsed so far.
+   * @return True if the name was found, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                    std::uint64_t hash,
+                                    std::uint64_t &bits) const noexcept
+      -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    constexpr auto &index =
+        name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#else
+    const auto &index =
+        name_index_of<enum_array_cache<Enum, Min, Max>, Hasher>::get();
+#endif
+    const auto slot =
+        index.find(name, hash, get_enum_array<Enum, Min, Max>());
+    if (slot == index.npos) {
+      return false;
+    }
+    bits |= flag_value(static_cast<Enum>(static_cast<int>(slot) + Min));
+    return true;
+  }
+};
+
+/**
+ * @brief Looks up the names of a flag enum.
+ *
+ * Bit names go through the flag name index; composite custom names, which
+ * are few, are compared against the mask list only when the index misses.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ */
+template <typename Enum, typename Hasher = fnv_name_hasher>
+struct flag_name_lookup {
+  using hasher = Hasher;
+
+  /**
+   * @brief Looks a name up and ORs its bits into bits.
+   *
+   * @param name The name.
+   * @param hash The Hasher::hash() of the name.
+   * @param bits The bits parsed so far.
+   * @return True if the name was found, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                    std::uint64_t hash,
+                                    std::uint64_t &bits) const noexcept
+      -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+    constexpr auto &index =
+        name_index_of<enum_flag_cache<Enum>, Hasher>::get();
+    constexpr auto &masks = enum_flag_cache<Enum>::masks;
+#else
+    const auto &index = name_index_of<enum_flag_cache<Enum>, Hasher>::get();
+    const auto &masks = enum_flag_cache<Enum>::masks();
+#endif
+    const auto slot = index.find(name, hash, get_enum_flags<Enum>());
+    if (slot != index.npos) {
+      bits |= slot == 0 ? 0 : std::uint64_t{1} << (slot - 1);
+      return true;
+    }
+    for (std::size_t idx = 0; idx < masks.composite_count; ++idx) {
+      if (Hasher::equal(masks.composites[idx].name, name)) {
+        bits |= masks.composites[idx].mask;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Converts a string to an enum bitmask value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The string view representing the enum names.
+ * @param separator The separator between names.
+ * @return An optional enum bitmask value, empty if any name is unknown.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher,
+          detail::enable_if_t<!enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto
+to_enum_bitmask_impl(mgutility::string_view str,
+                     mgutility::string_view separator) noexcept
+    -> mgutility::optional<Enum> {
+  return parse_bitmask<Enum>(str, separator,
+                             range_name_lookup<Enum, Min, Max, Hasher>{});
+}
+
+/**
+ * @brief Converts a string to a flag enum value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @tparam Hasher The name hash, folded_name_hasher to ignore ASCII case.
+ * @param str The string view representing the flag names.
+ * @param separator The separator between names.
+ * @return An optional enum value, empty if any name is unknown.
+ */
+template <typename Enum, int Min, int Max, typename Hasher = fnv_name_hasher,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto
+to_enum_bitmask_impl(mgutility::string_view str,
+                     mgutility::string_view separator) noexcept
+    -> mgutility::optional<Enum> {
+  return parse_bitmask<Enum>(str, separator, flag_name_lookup<Enum, Hasher>{});
+}
+
+/**
+ * @brief Gets the name of an enum value.
+ *
+ * The name published in the overlay of the enum, if any, comes first (see
+ * enum_name_overlay).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param e The enum value.
+ * @return A string view representing the name of the enum value.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto enum_name_impl(Enum enumValue) noexcept
+    -> mgutility::string_view {
+  const auto overlay = overlay_name(enumValue);
+  if (!overlay.empty()) {
+    return overlay;
+  }
+
+  const auto &arr = get_enum_array<Enum, Min, Max>();
+  const auto index = static_cast<int>(enumValue) - Min;
+  if (index < 0 || index >= static_cast<int>(arr.size())) {
+    return mgutility::string_view{};
+  }
+
+  return arr[static_cast<size_t>(index)];
+}
+
+/**
+ * @brief Writes the name of an enum value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param e The enum value.
+ * @param sink The sink the name is appended to.
+ */
+template <typename Enum, int Min, int Max, typename Sink,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR void write_enum_name(Enum enumValue, Sink &sink) {
+  sink.append(enum_name_impl<Enum, Min, Max>(enumValue));
+}
+
+/**
+ * @brief Writes the name of an enum bitmask value.
+ *
+ * A value named by the overlay of the enum or with a name of its own is
+ * written as is; other values are joined from the composite and single-bit
+ * names of the mask list (see write_bitmask) instead of testing every slot of
+ * the range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param e The enum value.
+ * @param sink The sink the name is appended to.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max, typename Sink,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR void write_enum_name(Enum enumValue, Sink &sink) {
+  const auto overlay = overlay_name(enumValue);
+  if (!overlay.empty()) {
+    sink.append(overlay);
+    return;
+  }
+
+  // Get the array of enum names
+  const auto &arr = get_enum_array<Enum, Min, Max>();
+
+  // Calculate the index in the array
+  const auto index = static_cast<int>(enumValue) - Min;
+
+  if (index >= 0 && index < static_cast<int>(arr.size()) &&
+      !arr[static_cast<size_t>(index)].empty()) {
+    sink.append(arr[static_cast<size_t>(index)]);
+    return;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &masks = enum_array_cache<Enum, Min, Max>::masks;
+#else
+  const auto &masks = enum_array_cache<Enum, Min, Max>::masks();
+#endif
+
+  write_bitmask(flag_value(enumValue), arr, masks, sink);
+}
+
+/**
+ * @brief Writes the name of a flag enum value.
+ *
+ * A value named by the overlay of the enum is written as is and 0 is looked
+ * up directly; other values are joined from the composite and single-bit
+ * names of the mask list (see write_bitmask).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param e The enum value.
+ * @param sink The sink the name is appended to.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max, typename Sink,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR void write_enum_name(Enum enumValue, Sink &sink) {
+  const auto overlay = overlay_name(enumValue);
+  if (!overlay.empty()) {
+    sink.append(overlay);
+    return;
+  }
+
+  const auto &names = get_enum_flags<Enum>();
+  const auto bits = flag_value(enumValue);
+
+  if (bits == 0) {
+    sink.append(names[0]);
+    return;
+  }
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  const auto &masks = enum_flag_cache<Enum>::masks;
+#else
+  const auto &masks = enum_flag_cache<Enum>::masks();
+#endif
+
+  write_bitmask(bits, names, masks, sink);
+}
+
+/**
+ * @brief Gets the name of an enum bitmask or flag enum value.
+ *
+ * The joined name is cut to enum_name_buffer<Enum>::size - 1 bytes; see
+ * fixed_string_sink.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param e The enum value.
+ * @return A string representing the name of the enum value.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR_CLANG_WA auto enum_name_impl(Enum enumValue) noexcept
+    -> mgutility::fixed_string<enum_name_buffer<Enum>::size> {
+  mgutility::fixed_string<enum_name_buffer<Enum>::size> name;
+  fixed_string_sink<enum_name_buffer<Enum>::size> sink{name};
+  write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return name;
+}
+
+/**
+ * @brief Gets a named value of an enum and its name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param idx The position of the value among the named values.
+ * @return The enum value and its name.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto enum_value_at(std::size_t idx) noexcept
+    -> enum_pair<Enum> {
+  const auto slot =
+      static_cast<std::size_t>(get_enum_values<Enum, Min, Max>().items[idx]);
+  const auto value = static_cast<Enum>(static_cast<int>(slot) + Min);
+  const auto overlay = overlay_name(value);
+  return enum_pair<Enum>{value, overlay.empty()
+                                    ? get_enum_array<Enum, Min, Max>()[slot]
+                                    : overlay};
+}
+
+/**
+ * @brief Gets a named value of a bitmask enum and its name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param idx The position of the value among the named values.
+ * @return The enum value and its name.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto enum_value_at(std::size_t idx) noexcept
+    -> enum_pair<Enum> {
+  const auto slot =
+      static_cast<std::size_t>(get_enum_values<Enum, Min, Max>().items[idx]);
+  enum_pair<Enum> pair{static_cast<Enum>(static_cast<int>(slot) + Min), {}};
+  const auto overlay = overlay_name(pair.first);
+  fixed_string_sink<enum_name_buffer<Enum>::size> sink{pair.second};
+  sink.append(overlay.empty() ? get_enum_array<Enum, Min, Max>()[slot]
+                              : overlay);
+  return pair;
+}
+
+/**
+ * @brief Gets a named value of a flag enum and its name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min Unused, flag enums are not reflected over a range.
+ * @tparam Max Unused, flag enums are not reflected over a range.
+ * @param idx The position of the value among the named values.
+ * @return The enum value and its name.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<enum_flags<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto enum_value_at(std::size_t idx) noexcept
+    -> enum_pair<Enum> {
+  const auto value = nth_enum_value<Enum, Min, Max>(idx);
+  enum_pair<Enum> pair{value, {}};
+  fixed_string_sink<enum_name_buffer<Enum>::size> sink{pair.second};
+  write_enum_name<Enum, Min, Max>(value, sink);
+  return pair;
+}
+
+/**
+ * @brief Gets the name of one value of a batch.
+ *
+ * A value outside the range reads slot 0 and gets its length cleared, so
+ * there is no data-dependent branch unless the enum has an overlay.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @param names The name table, indexed by slot.
+ * @param overlay The current overlay of the enum, or nullptr.
+ * @param value The enum value.
+ * @return The overlay name of the value if it has one, otherwise its
+ * reflected name, or an empty string_view.
+ */
+template <typename Enum, int Min, typename Names>
+auto batch_name(const Names &names, const enum_overlay<Enum> *overlay,
+                Enum value) noexcept -> mgutility::string_view {
+  if (overlay != nullptr) {
+    const auto name = overlay->find(value);
+    if (!name.empty()) {
+      return name;
+    }
+  }
+  const auto slot =
+      static_cast<std::size_t>(static_cast<unsigned>(static_cast<int>(value)) -
+                               static_cast<unsigned>(Min));
+  const auto in_range = slot < names.size();
+  const auto name = names[in_range ? slot : 0];
+  return mgutility::string_view(name.data(), in_range ? name.size() : 0);
+}
+
+/**
+ * @brief Gets the names of many enum values.
+ *
+ * The name table and the overlay are fetched once for the whole batch.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param out The names, one per value.
+ */
+template <typename Enum, int Min, int Max>
+void enum_names_impl(const Enum *values, std::size_t count,
+                     mgutility::string_view *out) noexcept {
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto *overlay = current_overlay<Enum>();
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    out[idx] = batch_name<Enum, Min>(names, overlay, values[idx]);
+  }
+}
+
+/**
+ * @brief Converts many strings to enum values.
+ *
+ * The lookups are the ones of to_enum, without building an optional per
+ * name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param names The names.
+ * @param count The number of names.
+ * @param out The enum values, value-initialized where a name is unknown.
+ * @param found Whether each name was found, or nullptr.
+ * @return The number of names found.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+auto to_enums_impl(const mgutility::string_view *names, std::size_t count,
+                   Enum *out, bool *found) noexcept -> std::size_t {
+  std::size_t hits = 0;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    const auto slot = find_enum_slot<Enum, Min, Max>(names[idx]);
+    const auto hit = slot != static_cast<std::size_t>(-1);
+    out[idx] = hit ? static_cast<Enum>(static_cast<int>(slot) + Min) : Enum{};
+    if (found != nullptr) {
+      found[idx] = hit;
+    }
+    hits += hit ? 1 : 0;
+  }
+  return hits;
+}
+
+/**
+ * @brief Converts many strings to enum bitmask values.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param names The names, each one a mask as accepted by to_enum.
+ * @param count The number of names.
+ * @param out The enum values, value-initialized where a mask is invalid.
+ * @param found Whether each mask was parsed, or nullptr.
+ * @return The number of masks parsed.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+auto to_enums_impl(const mgutility::string_view *names, std::size_t count,
+                   Enum *out, bool *found) noexcept -> std::size_t {
+  const auto separator = mgutility::string_view("|", 1);
+  std::size_t hits = 0;
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    auto parsed =
+        to_enum_bitmask_impl<Enum, Min, Max>(names[idx], separator);
+    out[idx] = parsed ? *parsed : Enum{};
+    if (found != nullptr) {
+      found[idx] = parsed.has_value();
+    }
+    hits += parsed ? 1 : 0;
+  }
+  return hits;
+}
+
+/**
+ * @brief Appends the names of many enum values, joined by a separator.
+ *
+ * The exact output length is summed from the name lengths first, so the
+ * string grows once and every name is one memcpy into it. The overlay is
+ * fetched once, so both passes see the same names.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param separator The separator between names.
+ * @param out The string to append to.
+ */
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+void join_enum_names(const Enum *values, std::size_t count,
+                     mgutility::string_view separator, std::string &out) {
+  if (count == 0) {
+    return;
+  }
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto *overlay = current_overlay<Enum>();
+
+  auto size = separator.size() * (count - 1);
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    size += batch_name<Enum, Min>(names, overlay, values[idx]).size();
+  }
+
+  const auto begin = out.size();
+  out.resize(begin + size);
+  auto *cursor = &out[begin];
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    if (idx != 0) {
+      if (separator.size() == 1) {
+        *cursor++ = separator[0];
+      } else {
+        std::memcpy(cursor, separator.data(), separator.size());
+        cursor += separator.size();
+      }
+    }
+    const auto name = batch_name<Enum, Min>(names, overlay, values[idx]);
+    std::memcpy(cursor, name.data(), name.size());
+    cursor += name.size();
+  }
+}
+
+/**
+ * @brief Appends the names of many enum bitmask values, joined by a
+ * separator.
+ *
+ * Bitmask names are assembled from several names each, so they are appended
+ * as they are written instead of being measured first.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param separator The separator between names.
+ * @param out The string to append to.
+ */
+// NOLINTNEXTLINE [modernize-use-constraints]
+template <typename Enum, int Min, int Max,
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+void join_enum_names(const Enum *values, std::size_t count,
+                     mgutility::string_view separator, std::string &out) {
+  string_sink sink{out};
+  for (std::size_t idx = 0; idx < count; ++idx) {
+    if (idx != 0) {
+      sink.append(separator);
+    }
+    write_enum_name<Enum, Min, Max>(values[idx], sink);
+  }
+}
+} // namespace detail
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_IMPL_HPP
+namespace mgutility {
+
+/**
+ * @brief Converts an enum value to its underlying integer value.
+ *
+ * @tparam Enum The enum type.
+ * @param e The enum value.
+ * @return The underlying integer value of the enum.
+ */
+template <typename Enum,
+          // NOLINTNEXTLINE [modernize-type-traits]
+          detail::enable_if_t<std::is_enum<Enum>::value, bool> = true>
+constexpr auto to_underlying(Enum enumValue) noexcept
+    -> detail::underlying_type_t<Enum> {
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  return static_cast<detail::underlying_type_t<Enum>>(enumValue);
+}
+
+/**
+ * @brief Gets the name of an enum value.
+ *
+ * The name of a bitmask or flag enum value is returned in a fixed_string of
+ * enum_name_buffer<Enum>::size bytes and cut to fit it; specialize
+ * enum_name_buffer or use enum_name_to for longer names.
+ *
+ * @tparam Min The minimum enum value.
+ * @tparam Max The maximum enum value.
+ * @tparam Enum The enum type.
+ * @param e The enum value.
+ * @return A string view or string representing the name of the enum value.
+ */
+template <int Min, int Max, typename Enum>
+MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
+    -> detail::string_or_view_t<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  return detail::enum_name_impl<Enum, Min, Max>(enumValue);
+}
+
+/**
+ * @brief Gets the name of an enum value.
+ *
+ * The name of a bitmask or flag enum value is returned in a fixed_string of
+ * enum_name_buffer<Enum>::size bytes and cut to fit it; specialize
+ * enum_name_buffer or use enum_name_to for longer names.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return A string view or string representing the name of the enum value.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
+    -> detail::string_or_view_t<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  return detail::enum_name_impl<Enum, Min, Max>(enumValue);
+}
+
+/**
+ * @brief Writes the name of an enum value into a buffer.
+ *
+ * The names are copied straight from the reflected name table, one memcpy
+ * per name or flag, without building a temporary. At most cap bytes are
+ * written and no terminating '\0' is added; like snprintf, the result is the
+ * full length of the name, so a result greater than cap means the name was
+ * cut.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param out The buffer.
+ * @param cap The capacity of the buffer.
+ * @param e The enum value.
+ * @return The number of bytes the name needs.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto enum_name_to(char *out, std::size_t cap, Enum enumValue) noexcept
+    -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  detail::buffer_sink sink{out, cap, 0};
+  detail::write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return sink.size;
+}
+
+/**
+ * @brief Appends the name of an enum value to a string.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param out The string to append to.
+ * @param e The enum value.
+ * @return The number of bytes appended.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto enum_name_to(std::string &out, Enum enumValue) -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  const auto size = out.size();
+  detail::string_sink sink{out};
+  detail::write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return out.size() - size;
+}
+
+/**
+ * @brief Writes the name of an enum value through an output iterator.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @tparam OutputIt The output iterator type.
+ * @param out The output iterator.
+ * @param e The enum value.
+ * @return The iterator past the last character written.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          typename OutputIt,
+          // NOLINTNEXTLINE [modernize-type-traits]
+          detail::enable_if_t<std::is_enum<Enum>::value, bool> = true>
+MGUTILITY_CNSTXPR auto enum_name_to(OutputIt out, Enum enumValue)
+    -> OutputIt {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  detail::iterator_sink<OutputIt> sink{out};
+  detail::write_enum_name<Enum, Min, Max>(enumValue, sink);
+  return sink.out;
+}
+
+/**
+ * @brief Gets the names of many enum values.
+ *
+ * Values outside the range get an empty name, unless the overlay of the enum
+ * names them. Bitmask and flag enums, whose names are assembled per value,
+ * are written with enum_names_join or enum_name_to instead.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param out The names, one per value.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+void enum_names(const Enum *values, std::size_t count,
+                mgutility::string_view *out) noexcept {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  detail::enum_names_impl<Enum, Min, Max>(values, count, out);
+}
+
+/**
+ * @brief Appends the names of many enum values to a string, joined by a
+ * separator.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param values The enum values.
+ * @param count The number of values.
+ * @param separator The separator between names.
+ * @param out The string to append to.
+ * @return The number of bytes appended.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto enum_names_join(const Enum *values, std::size_t count,
+                     mgutility::string_view separator, std::string &out)
+    -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  const auto size = out.size();
+  detail::join_enum_names<Enum, Min, Max>(values, count, separator, out);
+  return out.size() - size;
+}
+
+/**
+ * @brief Converts many strings to enum values.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param names The names; for bitmask and flag enums, masks joined with '|'.
+ * @param count The number of names.
+ * @param out The enum values, value-initialized where a name is unknown.
+ * @param found Whether each name was found, or nullptr.
+ * @return The number of names found.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+auto to_enums(const mgutility::string_view *names, std::size_t count,
+              Enum *out, bool *found = nullptr) noexcept -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enums_impl<Enum, Min, Max>(names, count, out, found);
+}
+
+/**
+ * @brief Gets the enum value and its name.
+ *
+ * @tparam Enum The enum type.
+ * @return A pair of the enum value and its name.
+ */
+template <typename Enum>
+MGUTILITY_CNSTXPR auto enum_for_each<Enum>::enum_iter::operator*() const noexcept
+    -> value_type {
+  return detail::enum_value_at<Enum, static_cast<int>(enum_range<Enum>::min),
+                               static_cast<int>(enum_range<Enum>::max)>(
+      static_cast<std::size_t>(m_pos));
+}
+
+/**
+ * @brief Gets the number of named values of the enum.
+ *
+ * @tparam Enum The enum type.
+ * @return The number of named values.
+ */
+template <typename Enum>
+MGUTILITY_CNSTXPR auto enum_for_each<Enum>::size() const noexcept
+    -> size_type {
+  return detail::get_enum_values<Enum,
+                                 static_cast<int>(enum_range<Enum>::min),
+                                 static_cast<int>(enum_range<Enum>::max)>()
+      .size;
+}
+
+/**
+ * @brief Converts a string to an enum value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string view representing the enum name.
+ * @return An optional enum value.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str) noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_impl<Enum, Min, Max>(str);
+}
+
+/**
+ * @brief Converts a string to an enum value, ignoring ASCII case.
+ *
+ * The name is folded while it is hashed and compared, so nothing is
+ * allocated. Names of the enum that differ only in case are rejected at
+ * compile time in C++17 and later; before that the lowest value wins.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string view representing the enum name.
+ * @return An optional enum value.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str,
+                               case_insensitive_t /*unused*/) noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_impl<Enum, Min, Max, detail::folded_name_hasher>(
+      str);
+}
+
+/**
+ * @brief Converts an abbreviated name to an enum value.
+ *
+ * A name equal to the prefix matches even if longer names start with it, so
+ * "warn" picks `warn` over `warning`; otherwise the prefix must start exactly
+ * one name. The names are kept in name order, so a lookup is two binary
+ * searches.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The prefix.
+ * @return The match: the value, if any, and the number of names starting
+ * with the prefix.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum_prefix(mgutility::string_view str) noexcept
+    -> enum_prefix_match<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_prefix_impl<Enum, Min, Max>(str);
+}
+
+/**
+ * @brief Converts an abbreviated name to an enum value, ignoring ASCII case.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The prefix.
+ * @return The match: the value, if any, and the number of names starting
+ * with the prefix.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum_prefix(mgutility::string_view str,
+                                      case_insensitive_t /*unused*/) noexcept
+    -> enum_prefix_match<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_prefix_impl<Enum, Min, Max,
+                                     detail::folded_name_hasher>(str);
+}
+
+/**
+ * @brief Converts a string to an enum bitmask value.
+ *
+ * Used for enums with a bitwise OR operator and for enum_flags enums. The
+ * names are parsed in a single pass; blanks around names and separators are
+ * ignored.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string view representing the enum names.
+ * @param separator The separator between names, default is "|".
+ * @return An optional enum bitmask value, empty if any name is unknown.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str,
+                               mgutility::string_view separator = "|") noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_bitmask_impl<Enum, Min, Max>(str, separator);
+}
+
+/**
+ * @brief Converts a string to an enum bitmask value, ignoring ASCII case.
+ *
+ * See the case-insensitive to_enum for plain enums.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param str The string view representing the enum names.
+ * @param separator The separator between names, default is "|".
+ * @return An optional enum bitmask value, empty if any name is unknown.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max),
+          detail::enable_if_t<detail::has_bit_or<Enum>::value ||
+                                  enum_flags<Enum>::value,
+                              bool> = true>
+MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str,
+                               case_insensitive_t /*unused*/,
+                               mgutility::string_view separator = "|") noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::to_enum_bitmask_impl<Enum, Min, Max,
+                                      detail::folded_name_hasher>(str,
+                                                                  separator);
+}
+
+/**
+ * @brief Casts an integer value to an enum value.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param value The integer value to cast.
+ * @return An optional enum value.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_cast(int value) noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  if (enum_name(static_cast<Enum>(value)).empty()) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<Enum>{static_cast<Enum>(value)};
+}
+
+/**
+ * @brief Gets the number of named values of an enum.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @return The number of named values.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_count() noexcept -> std::size_t {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  return detail::get_enum_values<Enum, Min, Max>().size;
+}
+
+/**
+ * @brief Gets the dense ordinal of an enum value.
+ *
+ * Named values are numbered from 0 to enum_count() - 1 in ascending order,
+ * the order of enum_for_each, so the ordinal can index a flat array.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return The ordinal, empty if the value has no name.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_index(Enum enumValue) noexcept
+    -> mgutility::optional<std::size_t> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  const auto rank = detail::rank_enum_value<Enum, Min, Max>(enumValue);
+  if (!rank.named) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<std::size_t>{rank.before};
+}
+
+/**
+ * @brief Gets the enum value with a dense ordinal, the inverse of
+ * enum_index().
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param index The ordinal.
+ * @return The enum value, empty if the ordinal is not below enum_count().
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_value(std::size_t index) noexcept
+    -> mgutility::optional<Enum> {
+  static_assert(Min < Max, "Max must be greater than Min!");
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
+  if (index >= detail::get_enum_values<Enum, Min, Max>().size) {
+    return mgutility::nullopt;
+  }
+  return mgutility::optional<Enum>{
+      detail::nth_enum_value<Enum, Min, Max>(index)};
+}
+
+/**
+ * @brief Gets the smallest named value greater than a value.
+ *
+ * The value itself does not need a name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return The next named value, empty if there is none.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_next(Enum enumValue) noexcept
+    -> mgutility::optional<Enum> {
+  const auto rank = detail::rank_enum_value<Enum, Min, Max>(enumValue);
+  return enum_value<Enum, Min, Max>(rank.before + (rank.named ? 1 : 0));
+}
+
+/**
+ * @brief Gets the largest named value less than a value.
+ *
+ * The value itself does not need a name.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ * @param e The enum value.
+ * @return The previous named value, empty if there is none.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+MGUTILITY_CNSTXPR auto enum_prev(Enum enumValue) noexcept
+    -> mgutility::optional<Enum> {
+  const auto rank = detail::rank_enum_value<Enum, Min, Max>(enumValue);
+  if (rank.before == 0) {
+    return mgutility::nullopt;
+  }
+  return enum_value<Enum, Min, Max>(rank.before - 1);
+}
+
+namespace operators {
+template <typename Enum, mgutility::detail::enable_if_t<
+                             // NOLINTNEXTLINE [modernize-type-traits]
+                             std::is_enum<Enum>::value, bool> = true>
+constexpr auto operator&(const Enum &lhs, const Enum &rhs) -> Enum {
+  return static_cast<Enum>(mgutility::to_underlying(lhs) &
+                           mgutility::to_underlying(rhs));
+}
+
+template <typename Enum, mgutility::detail::enable_if_t<
+                             // NOLINTNEXTLINE [modernize-type-traits]
+                             std::is_enum<Enum>::value, bool> = true>
+constexpr auto operator|(const Enum &lhs, const Enum &rhs) -> Enum {
+  return static_cast<Enum>(mgutility::to_underlying(lhs) |
+                           mgutility::to_underlying(rhs));
+}
+} // namespace operators
+
+} // namespace mgutility
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_MAP_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_MAP_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+
+namespace mgutility {
+
+/**
+ * @brief An element of an enum_map seen through its iterator.
+ *
+ * Supports structured bindings as `auto [key, name, value]`.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Ref The reference type of the mapped value.
+ */
+template <typename Enum, typename Ref> struct enum_map_entry {
+  Enum key;                              /**< The enum value. */
+  detail::string_or_view_t<Enum> name;   /**< The name of the enum value. */
+  Ref value;                             /**< The mapped value. */
+};
+
+/**
+ * @brief A fixed-size map from the named values of an enum to values.
+ *
+ * The values are stored in a contiguous array indexed by the dense ordinal
+ * of enum_index(), so lookups are a table load and iteration visits the
+ * named values in ascending order without hashing. Every named value has
+ * an element, value-initialized on construction.
+ *
+ * operator[] requires a named key: an unnamed one has no element and is
+ * caught by an assertion in debug builds. Use at(), which throws, or find(),
+ * which returns nullptr, when the key may be unnamed.
+ *
+ * The array holds enum_count<Enum>() elements in C++14 and later; C++11
+ * does not know the count at compile time and sizes it for the whole range
+ * instead.
+ *
+ * @tparam Enum The enum type.
+ * @tparam T The mapped type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ */
+template <typename Enum, typename T,
+          int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+class enum_map {
+  static constexpr auto capacity = detail::enum_capacity<Enum, Min, Max>();
+
+  using array_type = std::array<T, capacity == 0 ? 1 : capacity>;
+
+  /**
+   * @brief A random access iterator over the elements.
+   *
+   * @tparam Map The map type, const for a const iterator.
+   * @tparam Ref The reference type of the mapped value.
+   */
+  template <typename Map, typename Ref> class map_iter {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = enum_map_entry<Enum, Ref>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    /**
+     * @brief Default constructor, creating a singular iterator.
+     */
+    constexpr map_iter() noexcept : m_map{}, m_pos{} {}
+
+    /**
+     * @brief Constructor initializing the iterator to a position of a map.
+     *
+     * @param map The map.
+     * @param pos The position among the named values.
+     */
+    constexpr map_iter(Map *map, difference_type pos) noexcept
+        : m_map{map}, m_pos{pos} {}
+
+    /**
+     * @brief Pre-increment operator.
+     *
+     * @return A reference to the incremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator++() noexcept -> map_iter & {
+      ++m_pos;
+      return *this;
+    }
+
+    /**
+     * @brief Post-increment operator.
+     *
+     * @return A copy of the iterator before incrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator++(int) noexcept -> map_iter {
+      auto prev = *this;
+      ++m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Pre-decrement operator.
+     *
+     * @return A reference to the decremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator--() noexcept -> map_iter & {
+      --m_pos;
+      return *this;
+    }
+
+    /**
+     * @brief Post-decrement operator.
+     *
+     * @return A copy of the iterator before decrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator--(int) noexcept -> map_iter {
+      auto prev = *this;
+      --m_pos;
+      return prev;
+    }
+
+    /**
+     * @brief Advances the iterator.
+     *
+     * @param offset The number of elements to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator+=(difference_type offset) noexcept
+        -> map_iter & {
+      m_pos += offset;
+      return *this;
+    }
+
+    /**
+     * @brief Moves the iterator back.
+     *
+     * @param offset The number of elements to move by.
+     * @return A reference to the moved iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator-=(difference_type offset) noexcept
+        -> map_iter & {
+      m_pos -= offset;
+      return *this;
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param iter The iterator.
+     * @param offset The number of elements to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(const map_iter &iter,
+                                    difference_type offset) noexcept
+        -> map_iter {
+      return map_iter{iter.m_map, iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets an advanced copy of an iterator.
+     *
+     * @param offset The number of elements to move by.
+     * @param iter The iterator.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator+(difference_type offset,
+                                    const map_iter &iter) noexcept
+        -> map_iter {
+      return map_iter{iter.m_map, iter.m_pos + offset};
+    }
+
+    /**
+     * @brief Gets a copy of an iterator moved back.
+     *
+     * @param iter The iterator.
+     * @param offset The number of elements to move by.
+     * @return The moved iterator.
+     */
+    friend constexpr auto operator-(const map_iter &iter,
+                                    difference_type offset) noexcept
+        -> map_iter {
+      return map_iter{iter.m_map, iter.m_pos - offset};
+    }
+
+    /**
+     * @brief Gets the distance between two iterators of the same map.
+     *
+     * @param lhs The later iterator.
+     * @param rhs The earlier iterator.
+     * @return The number of elements between the iterators.
+     */
+    friend constexpr auto operator-(const map_iter &lhs,
+                                    const map_iter &rhs) noexcept
+        -> difference_type {
+      return lhs.m_pos - rhs.m_pos;
+    }
+
+    /**
+     * @brief Equality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are equal, otherwise false.
+     */
+    constexpr auto operator==(const map_iter &other) const noexcept -> bool {
+      return m_pos == other.m_pos;
+    }
+
+    /**
+     * @brief Inequality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are not equal, otherwise false.
+     */
+    constexpr auto operator!=(const map_iter &other) const noexcept -> bool {
+      return m_pos != other.m_pos;
+    }
+
+    /**
+     * @brief Less-than comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator comes first, otherwise false.
+     */
+    constexpr auto operator<(const map_iter &other) const noexcept -> bool {
+      return m_pos < other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator comes last, otherwise false.
+     */
+    constexpr auto operator>(const map_iter &other) const noexcept -> bool {
+      return m_pos > other.m_pos;
+    }
+
+    /**
+     * @brief Less-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come last, otherwise false.
+     */
+    constexpr auto operator<=(const map_iter &other) const noexcept -> bool {
+      return m_pos <= other.m_pos;
+    }
+
+    /**
+     * @brief Greater-than-or-equal comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if this iterator does not come first, otherwise false.
+     */
+    constexpr auto operator>=(const map_iter &other) const noexcept -> bool {
+      return m_pos >= other.m_pos;
+    }
+
+    /**
+     * @brief Dereference operator.
+     *
+     * @return The key, its name and a reference to the mapped value.
+     */
+    MGUTILITY_CNSTXPR auto operator*() const noexcept -> value_type {
+      const auto idx = static_cast<std::size_t>(m_pos);
+      auto pair = detail::enum_value_at<Enum, Min, Max>(idx);
+      return value_type{pair.first, pair.second, m_map->m_values[idx]};
+    }
+
+    /**
+     * @brief Subscript operator.
+     *
+     * @param offset The offset from the current position.
+     * @return The element at that offset.
+     */
+    MGUTILITY_CNSTXPR auto operator[](difference_type offset) const noexcept
+        -> value_type {
+      return *(*this + offset);
+    }
+
+  private:
+    Map *m_map;            /**< The map iterated over. */
+    difference_type m_pos; /**< The position among the named values. */
+  };
+
+public:
+  using key_type = Enum;
+  using mapped_type = T;
+  using size_type = std::size_t;
+  using iterator = map_iter<enum_map, T &>;
+  using const_iterator = map_iter<const enum_map, const T &>;
+
+  /**
+   * @brief Default constructor, value-initializing every element.
+   */
+  constexpr enum_map() noexcept(noexcept(T{})) : m_values{} {}
+
+  /**
+   * @brief Returns the number of elements, one per named value.
+   *
+   * @return The number of elements.
+   */
+  MGUTILITY_CNSTXPR auto size() const noexcept -> size_type {
+    return enum_count<Enum, Min, Max>();
+  }
+
+  /**
+   * @brief Checks whether the enum has no named values.
+   *
+   * @return True if the map has no element, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto empty() const noexcept -> bool { return size() == 0; }
+
+  /**
+   * @brief Checks whether an enum value has an element.
+   *
+   * @param key The enum value.
+   * @return True if the value is named, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto contains(Enum key) const noexcept -> bool {
+    return enum_index<Enum, Min, Max>(key).has_value();
+  }
+
+  /**
+   * @brief Gets the element of a named value.
+   *
+   * @param key The enum value, which must be named.
+   * @return A reference to the mapped value.
+   */
+  MGUTILITY_CNSTXPR auto operator[](Enum key) noexcept -> T & {
+    return m_values[named_index(key)];
+  }
+
+  /**
+   * @brief Gets the element of a named value.
+   *
+   * @param key The enum value, which must be named.
+   * @return A const reference to the mapped value.
+   */
+  MGUTILITY_CNSTXPR auto operator[](Enum key) const noexcept -> const T & {
+    return m_values[named_index(key)];
+  }
+
+  /**
+   * @brief Gets the element of an enum value, checking that it is named.
+   *
+   * @param key The enum value.
+   * @return A reference to the mapped value.
+   * @throws std::out_of_range if the value is not named.
+   */
+  auto at(Enum key) -> T & { return m_values[checked_index(key)]; }
+
+  /**
+   * @brief Gets the element of an enum value, checking that it is named.
+   *
+   * @param key The enum value.
+   * @return A const reference to the mapped value.
+   * @throws std::out_of_range if the value is not named.
+   */
+  auto at(Enum key) const -> const T & { return m_values[checked_index(key)]; }
+
+  /**
+   * @brief Finds the element of an enum value.
+   *
+   * @param key The enum value.
+   * @return A pointer to the mapped value, nullptr if the value is not named.
+   */
+  MGUTILITY_CNSTXPR auto find(Enum key) noexcept -> T * {
+    auto index = enum_index<Enum, Min, Max>(key);
+    return index ? &m_values[*index] : nullptr;
+  }
+
+  /**
+   * @brief Finds the element of an enum value.
+   *
+   * @param key The enum value.
+   * @return A pointer to the mapped value, nullptr if the value is not named.
+   */
+  MGUTILITY_CNSTXPR auto find(Enum key) const noexcept -> const T * {
+    auto index = enum_index<Enum, Min, Max>(key);
+    return index ? &m_values[*index] : nullptr;
+  }
+
+  /**
+   * @brief Finds the element of an enum value by its name.
+   *
+   * The name is looked up with to_enum().
+   *
+   * @param name The name of the enum value.
+   * @return A pointer to the mapped value, nullptr if no named value has
+   * that name.
+   */
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view name) noexcept -> T * {
+    auto key = to_enum<Enum, Min, Max>(name);
+    return key ? find(*key) : nullptr;
+  }
+
+  /**
+   * @brief Finds the element of an enum value by its name.
+   *
+   * The name is looked up with to_enum().
+   *
+   * @param name The name of the enum value.
+   * @return A pointer to the mapped value, nullptr if no named value has
+   * that name.
+   */
+  MGUTILITY_CNSTXPR auto find(mgutility::string_view name) const noexcept
+      -> const T * {
+    auto key = to_enum<Enum, Min, Max>(name);
+    return key ? find(*key) : nullptr;
+  }
+
+  /**
+   * @brief Gets the mapped values, in the order of the named values.
+   *
+   * @return A pointer to the first of size() values.
+   */
+  MGUTILITY_CNSTXPR auto data() noexcept -> T * { return m_values.data(); }
+
+  /**
+   * @brief Gets the mapped values, in the order of the named values.
+   *
+   * @return A pointer to the first of size() values.
+   */
+  MGUTILITY_CNSTXPR auto data() const noexcept -> const T * {
+    return m_values.data();
+  }
+
+  /**
+   * @brief Assigns a value to every element.
+   *
+   * @param value The value.
+   */
+  MGUTILITY_CNSTXPR void fill(const T &value) {
+    for (size_type idx = 0; idx < size(); ++idx) {
+      m_values[idx] = value;
+    }
+  }
+
+  /**
+   * @brief Returns an iterator to the first element.
+   *
+   * @return The beginning iterator.
+   */
+  MGUTILITY_CNSTXPR auto begin() noexcept -> iterator {
+    return iterator{this, 0};
+  }
+
+  /**
+   * @brief Returns an iterator past the last element.
+   *
+   * @return The end iterator.
+   */
+  MGUTILITY_CNSTXPR auto end() noexcept -> iterator {
+    return iterator{this, static_cast<std::ptrdiff_t>(size())};
+  }
+
+  /**
+   * @brief Returns a const iterator to the first element.
+   *
+   * @return The beginning iterator.
+   */
+  MGUTILITY_CNSTXPR auto begin() const noexcept -> const_iterator {
+    return const_iterator{this, 0};
+  }
+
+  /**
+   * @brief Returns a const iterator past the last element.
+   *
+   * @return The end iterator.
+   */
+  MGUTILITY_CNSTXPR auto end() const noexcept -> const_iterator {
+    return const_iterator{this, static_cast<std::ptrdiff_t>(size())};
+  }
+
+private:
+  /**
+   * @brief Gets the dense ordinal of a key that must be named.
+   *
+   * @param key The enum value.
+   * @return The dense ordinal of the value.
+   */
+  static MGUTILITY_CNSTXPR auto named_index(Enum key) noexcept -> std::size_t {
+    auto index = enum_index<Enum, Min, Max>(key);
+    assert(index.has_value() && "enum_map::operator[] needs a named key");
+    return index.value_or(0);
+  }
+
+  /**
+   * @brief Gets the dense ordinal of a key, checking that it is named.
+   *
+   * @param key The enum value.
+   * @return The dense ordinal of the value.
+   * @throws std::out_of_range if the value is not named.
+   */
+  static auto checked_index(Enum key) -> std::size_t {
+    auto index = enum_index<Enum, Min, Max>(key);
+    if (!index) {
+      throw std::out_of_range("enum_map::at: the key is not a named value");
+    }
+    return *index;
+  }
+
+  array_type m_values; /**< The mapped values, by dense ordinal. */
+};
+
+/**
+ * @brief A perfect hash of the values of an enum, usable as the Hash of
+ * unordered containers.
+ *
+ * A named value hashes to its dense ordinal, below enum_count(), so named
+ * values never collide. Any other value hashes to enum_count() plus its
+ * underlying bits, which stays clear of the ordinals unless the sum wraps
+ * around (64-bit values close to the top of the type).
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+struct enum_hash {
+  /**
+   * @brief Hashes an enum value.
+   *
+   * @param key The enum value.
+   * @return The hash of the value.
+   */
+  MGUTILITY_CNSTXPR auto operator()(Enum key) const noexcept -> std::size_t {
+    auto index = enum_index<Enum, Min, Max>(key);
+    return index ? *index
+                 : enum_count<Enum, Min, Max>() +
+                       static_cast<std::size_t>(detail::flag_value(key));
+  }
+};
+
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_MAP_HPP
+
+/*
+MIT License
+
+Copyright (c) 2024 mguludag
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_SET_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_SET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+
+namespace mgutility {
+
+/**
+ * @brief A set of the named values of an enum, packed one bit per value.
+ *
+ * Bit i of the set stands for the value with dense ordinal i (see
+ * enum_index()), so size() is a popcount per word, iteration walks the set
+ * bits with count-trailing-zeros in ascending order, and the set algebra
+ * works on whole words. Names are written straight from the reflected name
+ * table and parsed with its hash index, without a string per element.
+ *
+ * Bitmask and flag enums are sets of bits already and are not supported.
+ * The set has enum_count<Enum>() bits in C++14 and later; C++11 sizes it
+ * for the whole range.
+ *
+ * @tparam Enum The enum type.
+ * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
+ * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
+ */
+template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
+          int Max = static_cast<int>(enum_range<Enum>::max)>
+class enum_set {
+  static_assert(!detail::has_bit_or<Enum>::value && !enum_flags<Enum>::value,
+                "enum_set does not support bitmask and flag enums!");
+
+  using word_type = std::uint64_t;
+
+  static constexpr std::size_t word_bits = 64;
+  static constexpr auto capacity = detail::enum_capacity<Enum, Min, Max>();
+  static constexpr auto word_count =
+      capacity == 0 ? std::size_t{1} : (capacity + word_bits - 1) / word_bits;
+
+  using array_type = std::array<word_type, word_count>;
+
+  /**
+   * @brief A forward iterator over the values of the set, ascending.
+   */
+  class set_iter {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Enum;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Enum;
+
+    /**
+     * @brief Default constructor, creating an end iterator.
+     */
+    constexpr set_iter() noexcept : m_words{}, m_word{word_count}, m_bits{} {}
+
+    /**
+     * @brief Constructor initializing the iterator to the first set bit at
+     * or after a word.
+     *
+     * @param words The words of the set.
+     * @param word The first word to look at.
+     */
+    MGUTILITY_CNSTXPR set_iter(const array_type *words,
+                               std::size_t word) noexcept
+        : m_words{words}, m_word{word}, m_bits{} {
+      skip_empty();
+    }
+
+    /**
+     * @brief Pre-increment operator.
+     *
+     * @return A reference to the incremented iterator.
+     */
+    MGUTILITY_CNSTXPR auto operator++() noexcept -> set_iter & {
+      m_bits &= m_bits - 1;
+      if (m_bits == 0) {
+        ++m_word;
+        skip_empty();
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Post-increment operator.
+     *
+     * @return A copy of the iterator before incrementing.
+     */
+    MGUTILITY_CNSTXPR auto operator++(int) noexcept -> set_iter {
+      auto prev = *this;
+      ++*this;
+      return prev;
+    }
+
+    /**
+     * @brief Equality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are equal, otherwise false.
+     */
+    constexpr auto operator==(const set_iter &other) const noexcept -> bool {
+      return m_word == other.m_word && m_bits == other.m_bits;
+    }
+
+    /**
+     * @brief Inequality comparison operator.
+     *
+     * @param other The other iterator to compare with.
+     * @return True if the iterators are not equal, otherwise false.
+     */
+    constexpr auto operator!=(const set_iter &other) const noexcept -> bool {
+      return !(*this == other);
+    }
+
+    /**
+     * @brief Dereference operator.
+     *
+     * @return The current enum value.
+     */
+    MGUTILITY_CNSTXPR auto operator*() const noexcept -> Enum {
+      return detail::nth_enum_value<Enum, Min, Max>(
+          m_word * word_bits + detail::count_trailing_zeros(m_bits));
+    }
+
+  private:
+    /**
+     * @brief Moves to the first non-empty word, or to the end.
+     */
+    MGUTILITY_CNSTXPR void skip_empty() noexcept {
+      for (; m_word < word_count; ++m_word) {
+        m_bits = (*m_words)[m_word];
+        if (m_bits != 0) {
+          return;
+        }
+      }
+      m_bits = 0;
+    }
+
+    const array_type *m_words; /**< The words of the set. */
+    std::size_t m_word;        /**< The current word. */
+    word_type m_bits;          /**< The bits of the word not visited yet. */
+  };
+
+  /**
+   * @brief Adds the ordinals of the names scan_names() visits to a set.
+   */
+  struct name_collector {
+    enum_set &set; /**< The set being parsed into. */
+
+    /**
+     * @brief Looks a name up and adds its value to the set.
+     *
+     * @param name The name.
+     * @param hash The name_hash() of the name.
+     * @return True if the name was found, otherwise false.
+     */
+    MGUTILITY_CNSTXPR auto operator()(mgutility::string_view name,
+                                      std::uint64_t hash) noexcept -> bool {
+#if MGUTILITY_CPLUSPLUS > 201402L
+      const auto &index = detail::enum_array_cache<Enum, Min, Max>::name_index;
+#else
+      const auto &index =
+          detail::enum_array_cache<Enum, Min, Max>::name_index();
+#endif
+      const auto slot =
+          index.find(name, hash, detail::get_enum_array<Enum, Min, Max>());
+      if (slot == static_cast<std::size_t>(-1)) {
+        return false;
+      }
+      set.set_bit(detail::rank_enum_value<Enum, Min, Max>(
+                      static_cast<Enum>(static_cast<int>(slot) + Min))
+                      .before);
+      return true;
+    }
+  };
+
+public:
+  using key_type = Enum;
+  using value_type = Enum;
+  using size_type = std::size_t;
+  using iterator = set_iter;
+  using const_iterator = set_iter;
+
+  /**
+   * @brief Default constructor, creating an empty set.
+   */
+  constexpr enum_set() noexcept : m_words{} {}
+
+  /**
+   * @brief Constructor adding a list of values; values without a name are
+   * skipped.
+   *
+   * @param values The values.
+   */
+  MGUTILITY_CNSTXPR enum_set(std::initializer_list<Enum> values) noexcept
+      : m_words{} {
+    for (const auto value : values) {
+      insert(value);
+    }
+  }
+
+  /**
+   * @brief Gets the set of every named value.
+   *
+   * @return The full set.
+   */
+  static MGUTILITY_CNSTXPR auto all() noexcept -> enum_set {
+    enum_set set;
+    const auto count = enum_count<Enum, Min, Max>();
+    for (std::size_t word = 0; word < word_count; ++word) {
+      const auto first = word * word_bits;
+      set.m_words[word] = count >= first + word_bits ? ~word_type{0}
+                          : count > first
+                              ? (word_type{1} << (count - first)) - 1
+                              : word_type{0};
+    }
+    return set;
+  }
+
+  /**
+   * @brief Parses separated names into a set.
+   *
+   * Accepts the same syntax as the bitmask to_enum(): blanks around names
+   * and separators are ignored, and every name must be known. An empty
+   * string gives an empty set.
+   *
+   * @param str The names.
+   * @param separator The separator between names, default is "|".
+   * @return The set, empty if any name is unknown.
+   */
+  static MGUTILITY_CNSTXPR auto
+  parse(mgutility::string_view str,
+        mgutility::string_view separator = "|") noexcept
+      -> mgutility::optional<enum_set> {
+    enum_set set;
+    if (detail::trim_blanks(str).empty()) {
+      return mgutility::optional<enum_set>{set};
+    }
+    name_collector collector{set};
+    if (!detail::scan_names(str, separator, collector)) {
+      return mgutility::nullopt;
+    }
+    return mgutility::optional<enum_set>{set};
+  }
+
+  /**
+   * @brief Adds a value to the set.
+   *
+   * @param value The value.
+   * @return True if the value is named and was added or already present,
+   * otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto insert(Enum value) noexcept -> bool {
+    const auto rank = detail::rank_enum_value<Enum, Min, Max>(value);
+    if (rank.named) {
+      set_bit(rank.before);
+    }
+    return rank.named;
+  }
+
+  /**
+   * @brief Removes a value from the set.
+   *
+   * @param value The value.
+   * @return True if the value was in the set, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto erase(Enum value) noexcept -> bool {
+    const auto rank = detail::rank_enum_value<Enum, Min, Max>(value);
+    if (!rank.named) {
+      return false;
+    }
+    const auto mask = word_type{1} << (rank.before % word_bits);
+    auto &word = m_words[rank.before / word_bits];
+    const auto present = (word & mask) != 0;
+    word &= ~mask;
+    return present;
+  }
+
+  /**
+   * @brief Checks whether a value is in the set.
+   *
+   * @param value The value.
+   * @return True if the value is in the set, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto contains(Enum value) const noexcept -> bool {
+    const auto rank = detail::rank_enum_value<Enum, Min, Max>(value);
+    return rank.named && ((m_words[rank.before / word_bits] >>
+                           (rank.before % word_bits)) &
+                          1U) != 0;
+  }
+
+  /**
+   * @brief Gets the number of values in the set.
+   *
+   * @return The number of values.
+   */
+  MGUTILITY_CNSTXPR auto size() const noexcept -> size_type {
+    size_type count = 0;
+    for (const auto word : m_words) {
+      count += detail::count_bits(word);
+    }
+    return count;
+  }
+
+  /**
+   * @brief Checks whether the set is empty.
+   *
+   * @return True if the set has no value, otherwise false.
+   */
+  MGUTILITY_CNSTXPR auto empty() const noexcept -> bool {
+    for (const auto word : m_words) {
+      if (word != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Removes every value from the set.
+   */
+  MGUTILITY_CNSTXPR void clear() noexcept {
+    for (auto &word : m_words) {
+      word = 0;
+    }
+  }
+
+  /**
+   * @brief Returns an iterator to the smallest value of the set.
+   *
+   * @return The beginning iterator.
+   */
+  MGUTILITY_CNSTXPR auto begin() const noexcept -> const_iterator {
+    return const_iterator{&m_words, 0};
+  }
+
+  /**
+   * @brief Returns an iterator past the largest value of the set.
+   *
+   * @return The end iterator.
+   */
+  constexpr auto end() const noexcept -> const_iterator {
+    return const_iterator{};
+  }
+
+  /**
+   * @brief Adds the values of another set.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator|=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] |= other.m_words[word];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Keeps the values that are also in another set.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator&=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] &= other.m_words[word];
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Keeps the values that are in exactly one of the sets.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator^=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] ^= other.m_words[word];
+    }
+    return *this;
+  }
 
-// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
-namespace mgutility {
-namespace detail {
+  /**
+   * @brief Removes the values of another set.
+   *
+   * @param other The other set.
+   * @return A reference to this set.
+   */
+  MGUTILITY_CNSTXPR auto operator-=(const enum_set &other) noexcept
+      -> enum_set & {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      m_words[word] &= ~other.m_words[word];
+    }
+    return *this;
+  }
 
-#ifndef MGUTILITY_STRLEN
-// NOLINTNEXTLINE [cppcoreguidelines-macro-usage]
-#define MGUTILITY_STRLEN(x) sizeof(x) - 1
-#endif
+  /**
+   * @brief Gets the union of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return The union.
+   */
+  friend MGUTILITY_CNSTXPR auto operator|(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs |= rhs;
+  }
 
-/**
- * @brief Parse result for enum names.
- *
- * Templated on the underlying type U instead of the enum type itself,
- * so all enums with the same underlying type (e.g., all 'int'-based enums)
- * share the same struct type. The strings buffer is a fixed size
- * (MGUTILITY_GLOBAL_ENUM_BLOB_SIZE) rather than a per-enum-type
- * fixed_string, reducing template bloat.
- *
- * @tparam U The underlying type of the enum (e.g., int, unsigned int).
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- */
-template <typename U, int Min, int Max> struct enum_name_parse_result {
-  static constexpr auto size = std::size_t{Max - Min};
-  fixed_string<MGUTILITY_GLOBAL_ENUM_BLOB_SIZE> strings;
-  std::array<pair<std::size_t, std::size_t>, size> ranges;
-};
+  /**
+   * @brief Gets the intersection of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return The intersection.
+   */
+  friend MGUTILITY_CNSTXPR auto operator&(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs &= rhs;
+  }
 
-template <typename T, int Min, int Max>
-using enum_name_array =
-    std::array<mgutility::string_view, static_cast<std::size_t>(Max - Min)>;
+  /**
+   * @brief Gets the symmetric difference of two sets.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return The symmetric difference.
+   */
+  friend MGUTILITY_CNSTXPR auto operator^(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs ^= rhs;
+  }
 
-/**
- * @brief Provides functionality to extract and parse enum names at
- * compile-time.
- */
-struct enum_type {
-private:
   /**
-   * @brief Extracts raw name from compiler's __PRETTY_FUNCTION__.
+   * @brief Gets the difference of two sets.
    *
-   * @tparam Enum The enum type.
-   * @tparam e The enum value.
-   * @return The raw string_view from __PRETTY_FUNCTION__.
+   * @param lhs The first set.
+   * @param rhs The set whose values are removed.
+   * @return The difference.
    */
-  template <typename Enum, Enum... e>
-  MGUTILITY_CNSTXPR static auto
-  raw_name(detail::enum_sequence<Enum, e...> /*unused*/) noexcept
-      -> mgutility::string_view {
-#if defined(__GNUC__) && !defined(__clang__) && MGUTILITY_CPLUSPLUS >= 201402L
-#define PREFIX                                                                 \
-  MGUTILITY_STRLEN("static constexpr mgutility::string_view "                  \
-                   "mgutility::detail::enum_type::raw_name(mgutility::detail:" \
-                   ":enum_sequence<Enum, e ...>) [with Enum = ")
-#elif defined(__clang__) || defined(__GNUC__)
-#define PREFIX                                                                 \
-  MGUTILITY_STRLEN("static mgutility::string_view "                            \
-                   "mgutility::detail::enum_type::raw_name(mgutility::detail:" \
-                   ":enum_sequence<Enum, e ...>) [with Enum = ")
-#elif defined(_MSC_VER)
-#if MGUTILITY_CPLUSPLUS > 201402L
-#define PREFIX                                                                 \
-  MGUTILITY_STRLEN(                                                            \
-      "class std::basic_string_view<char,struct std::char_traits<char> > "     \
-      "__cdecl mgutility::detail::enum_type::raw_name")
-#else
-#define PREFIX                                                                 \
-  MGUTILITY_STRLEN("class mgutility::basic_string_view<char> __cdecl "         \
-                   "mgutility::detail::enum_type::raw_name")
-#endif
-#else
-#define PREFIX 0
-#endif
+  friend MGUTILITY_CNSTXPR auto operator-(enum_set lhs,
+                                          const enum_set &rhs) noexcept
+      -> enum_set {
+    return lhs -= rhs;
+  }
 
-    return mgutility::string_view(__PRETTY_FUNCTION__ + PREFIX,
-                                  MGUTILITY_STRLEN(__PRETTY_FUNCTION__) -
-                                      PREFIX + 1);
+  /**
+   * @brief Gets the complement of a set among the named values.
+   *
+   * @param set The set.
+   * @return The named values that are not in the set.
+   */
+  friend MGUTILITY_CNSTXPR auto operator~(const enum_set &set) noexcept
+      -> enum_set {
+    return all() - set;
   }
 
   /**
-   * @brief Parses the enum name from the raw string based on compiler.
+   * @brief Equality comparison operator.
    *
-   * @param str The raw string from __PRETTY_FUNCTION__.
-   * @return The parsed enum name.
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return True if the sets have the same values, otherwise false.
    */
-  template <typename Enum, int Min, int Max>
-  MGUTILITY_CNSTXPR static auto parse() noexcept
-      -> enum_name_parse_result<detail::underlying_type_t<Enum>, Min, Max> {
-    using U = detail::underlying_type_t<Enum>;
-    using result_type = enum_name_parse_result<U, Min, Max>;
+  friend MGUTILITY_CNSTXPR auto operator==(const enum_set &lhs,
+                                           const enum_set &rhs) noexcept
+      -> bool {
+    for (std::size_t word = 0; word < word_count; ++word) {
+      if (lhs.m_words[word] != rhs.m_words[word]) {
+        return false;
+      }
+    }
+    return true;
+  }
 
-    MGUTILITY_CNSTXPR auto str =
-        raw_name<Enum>(detail::make_enum_sequence<Enum, Min, Max>{});
+  /**
+   * @brief Inequality comparison operator.
+   *
+   * @param lhs The first set.
+   * @param rhs The second set.
+   * @return True if the sets differ, otherwise false.
+   */
+  friend MGUTILITY_CNSTXPR auto operator!=(const enum_set &lhs,
+                                           const enum_set &rhs) noexcept
+      -> bool {
+    return !(lhs == rhs);
+  }
 
-#if defined(__clang__) || defined(__GNUC__)
-#if defined(__clang__)
-    auto end = str.rfind(']');
-#elif defined(__GNUC__) && !defined(__clang__)
-    auto end = str.rfind(';');
-#endif
+  /**
+   * @brief Writes the names of the values, ascending, into a buffer.
+   *
+   * Like enum_name_to, at most cap bytes are written, no terminating '\0' is
+   * added and the result is the full length of the names.
+   *
+   * @param out The buffer.
+   * @param cap The capacity of the buffer.
+   * @param separator The separator between names, default is "|".
+   * @return The number of bytes the names need.
+   */
+  auto names_to(char *out, std::size_t cap,
+                mgutility::string_view separator = "|") const noexcept
+      -> std::size_t {
+    detail::buffer_sink sink{out, cap, 0};
+    write_names(sink, separator);
+    return sink.size;
+  }
 
-    auto enum_names = str.substr(0, end);
+  /**
+   * @brief Appends the names of the values, ascending, to a string.
+   *
+   * @param out The string to append to.
+   * @param separator The separator between names, default is "|".
+   * @return The number of bytes appended.
+   */
+  auto names_to(std::string &out,
+                mgutility::string_view separator = "|") const
+      -> std::size_t {
+    const auto size = out.size();
+    detail::string_sink sink{out};
+    write_names(sink, separator);
+    return out.size() - size;
+  }
 
-#elif defined(_MSC_VER)
-    // MSVC: different format
-    auto pos = str.find(',');
-    if (pos == mgutility::string_view::npos)
-      return {};
+  /**
+   * @brief Gets the names of the values, ascending, as one string.
+   *
+   * @param separator The separator between names, default is "|".
+   * @return The names.
+   */
+  auto to_string(mgutility::string_view separator = "|") const
+      -> std::string {
+    std::string str;
+    names_to(str, separator);
+    return str;
+  }
 
-    ++pos;
+private:
+  /**
+   * @brief Sets the bit of an ordinal.
+   *
+   * @param ordinal The ordinal.
+   */
+  MGUTILITY_CNSTXPR void set_bit(std::size_t ordinal) noexcept {
+    m_words[ordinal / word_bits] |= word_type{1} << (ordinal % word_bits);
+  }
 
-    auto end = str.rfind('>');
-    auto enum_names = str.substr(pos, end - pos);
+  /**
+   * @brief Writes the names of the values to a sink.
+   *
+   * @param sink The sink the names are appended to.
+   * @param separator The separator between names.
+   */
+  template <typename Sink>
+  void write_names(Sink &sink, mgutility::string_view separator) const {
+    const auto &values = detail::get_enum_values<Enum, Min, Max>();
+    const auto &names = detail::get_enum_array<Enum, Min, Max>();
+    auto first = true;
+    for (std::size_t word = 0; word < word_count; ++word) {
+      for (auto bits = m_words[word]; bits != 0; bits &= bits - 1) {
+        const auto ordinal =
+            word * word_bits + detail::count_trailing_zeros(bits);
+        if (!first) {
+          sink.append(separator);
+        }
+        first = false;
+        sink.append(names[static_cast<std::size_t>(values.items[ordinal])]);
+      }
+    }
+  }
 
-#else
-    return {};
-#endif
+  array_type m_words; /**< The bits of the set, by dense ordinal. */
+};
 
-    if (enum_names.empty()) {
-      return {};
-    }
+} // namespace mgutility
 
-    result_type result{};
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_SET_HPP
 
-    std::size_t idx = 0;
+/*
+MIT License
 
-    while (!enum_names.empty() && idx < result.ranges.size()) {
-      auto pos = enum_names.find(',');
-      if (pos != mgutility::string_view::npos) {
-        auto token = enum_names.substr(0, pos);
+Copyright (c) 2024 mguludag
 
-        // remove whitespace
-        while (!token.empty() && token.front() == ' ') {
-          token = token.substr(1);
-        }
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
 
-        while (!token.empty() && token.back() == ' ') {
-          token = token.substr(0, token.size() - 1);
-        }
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
 
-        std::size_t begin = token.find('(');
-        std::size_t end = token.rfind(')');
-        if (begin != mgutility::string_view::npos ||
-            end != mgutility::string_view::npos) {
-          result.ranges[idx++] = {0, 0};
-          enum_names = enum_names.substr(pos + 1);
-          continue;
-        }
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
 
-        std::size_t start = 0;
-        if (token.find(':') != mgutility::string_view::npos) {
-          start = token.find(':') + 2;
-          token = token.substr(start);
-        }
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_STREAM_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_STREAM_HPP
 
-        // Write into the fixed-size global buffer
-        auto offset = result.strings.size();
-        result.strings.append(token);
-        result.ranges[idx++] = {offset, token.size()};
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <locale>
+#include <ostream>
+#include <streambuf>
+#include <string>
 
-        enum_names = enum_names.substr(pos + 1);
-        continue;
-      }
-      enum_names = {};
-    }
+// NOLINTNEXTLINE [modernize-concat-nested-namespaces]
+namespace mgutility {
+namespace detail {
 
-    return result;
-  }
+/**
+ * @brief Writes names to an output stream, one write() per name.
+ */
+struct ostream_sink {
+  std::ostream &os; /**< The output stream. */
 
-public:
   /**
-   * @brief Gets the name of the enum value, checking custom names first.
+   * @brief Appends a string.
    *
-   * @tparam Enum The enum type.
-   * @tparam e The enum value.
-   * @return The name of the enum value.
+   * @param str The string.
+   * @return This sink.
    */
-  template <typename Enum, int Min, int Max>
-  MGUTILITY_CNSTXPR static auto name() noexcept
-      -> enum_name_parse_result<detail::underlying_type_t<Enum>, Min, Max> {
-    return parse<Enum, Min, Max>();
+  auto append(mgutility::string_view str) -> ostream_sink & {
+    os.write(str.data(), static_cast<std::streamsize>(str.size()));
+    return *this;
   }
 };
 
 /**
- * @brief Caches an array of enum names for a given enum sequence.
+ * @brief Writes a name padded to the width of an output stream, honoring its
+ * fill character and left or right adjustment, and resets the width.
  *
- * @tparam Enum The enum type.
- * @tparam Seq The enum sequence.
+ * @param os The output stream.
+ * @param name The name.
  */
-template <typename Enum, int Min, int Max> struct enum_array_cache;
+inline void write_padded(std::ostream &os, mgutility::string_view name) {
+  const auto width = static_cast<std::size_t>(os.width());
+  auto pad = width > name.size() ? width - name.size() : 0;
+  const auto left =
+      (os.flags() & std::ios_base::adjustfield) == std::ios_base::left;
+  os.width(0);
+  for (; !left && pad > 0; --pad) {
+    os.put(os.fill());
+  }
+  os.write(name.data(), static_cast<std::streamsize>(name.size()));
+  for (; pad > 0; --pad) {
+    os.put(os.fill());
+  }
+}
 
 /**
- * @brief Specialization of enum_array_cache for enum_sequence.
- *
- * @tparam Enum The enum type.
- * @tparam Is The enum values.
+ * @brief Exposes the get area of a stream buffer, which std::streambuf only
+ * shows to derived classes.
  */
-template <typename Enum, int Min, int Max> struct enum_array_cache {
-  using underlying = detail::underlying_type_t<Enum>;
-  using parse_result_t = enum_name_parse_result<underlying, Min, Max>;
-
-#if MGUTILITY_CPLUSPLUS > 201402L
-
-  static constexpr auto parse_result =
-      enum_type::template name<Enum, Min, Max>();
-
-#else
-  // C++11: lazy runtime array
-  static parse_result_t &value() {
-    static parse_result_t arr = enum_type::template name<Enum, Min, Max>();
-
-    return arr;
+class streambuf_access : public std::streambuf {
+public:
+  /**
+   * @brief Gets the next character of the get area.
+   *
+   * @param buf The stream buffer.
+   * @return The current position in the get area.
+   */
+  static auto next(std::streambuf &buf) -> char * {
+    return (buf.*&streambuf_access::gptr)();
   }
-#endif
-
-  static MGUTILITY_CNSTXPR auto
-  apply_custom(const parse_result_t &result) noexcept
-      -> enum_name_array<Enum, Min, Max> {
-    enum_name_array<Enum, Min, Max> arr{};
-
-    for (std::size_t idx = 0; idx < result.ranges.size(); ++idx) {
-      arr[idx] = result.strings.view().substr(result.ranges[idx].first,
-                                              result.ranges[idx].second);
-    }
 
-#if MGUTILITY_CPLUSPLUS >= 201402L
-    constexpr auto map = mgutility::custom_enum<Enum>::map;
-    for (const auto &pair : map) {
-#else
-    for (const auto &pair : mgutility::custom_enum<Enum>::map) {
-#endif
-      if (pair.first >= static_cast<Enum>(Min) &&
-          pair.first < static_cast<Enum>(Max)) {
-        arr[static_cast<std::size_t>(pair.first) - Min] = pair.second;
-      }
-    }
+  /**
+   * @brief Gets the end of the get area.
+   *
+   * @param buf The stream buffer.
+   * @return The end of the get area.
+   */
+  static auto end(std::streambuf &buf) -> char * {
+    return (buf.*&streambuf_access::egptr)();
+  }
 
-    return arr;
+  /**
+   * @brief Consumes characters of the get area.
+   *
+   * @param buf The stream buffer.
+   * @param count The number of characters, at most the ones left.
+   */
+  static void consume(std::streambuf &buf, std::size_t count) {
+    (buf.*&streambuf_access::gbump)(static_cast<int>(count));
   }
 };
 
 /**
- * @brief Gets an array of enum names for the enum type within the specified
- * range.
+ * @brief Reads a whitespace-delimited name from an input stream and hands
+ * it to a lookup.
  *
- * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @return An array of string_views containing the enum names.
- */
-template <typename Enum, int Min = mgutility::enum_range<Enum>::min,
-          int Max = mgutility::enum_range<Enum>::max>
-MGUTILITY_CNSTXPR auto get_enum_array() noexcept
-    -> enum_name_array<Enum, Min, Max> {
-#if MGUTILITY_CPLUSPLUS > 201402L
-  constexpr auto &cache = enum_array_cache<Enum, Min, Max>::parse_result;
-  return enum_array_cache<Enum, Min, Max>::apply_custom(cache);
-#else
-  return enum_array_cache<Enum, Min, Max>::apply_custom(
-      enum_array_cache<Enum, Min, Max>::value());
-#endif
-}
-
-/**
- * @brief Converts a string to an enum value.
+ * Leading whitespace is skipped as for any formatted input, and whitespace
+ * is whatever the ctype facet of the stream's locale classifies as space.
+ * When the name and the whitespace after it are already in the get area of
+ * the stream buffer, the lookup sees the buffer itself; otherwise the name is
+ * copied into a stack buffer of Capacity characters, moving to a string that
+ * grows as needed when it is longer, e.g. a long '|'-joined bitmask. Names
+ * that are empty or rejected by the lookup set failbit; running into the end
+ * of the stream sets eofbit.
  *
- * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @param str The string view representing the enum name.
- * @return An optional enum value.
+ * @tparam Capacity The length up to which a name is copied to the stack.
+ * @tparam Lookup The lookup, called as lookup(name) and returning whether it
+ * found the name.
+ * @param is The input stream.
+ * @param lookup The lookup.
  */
-template <typename Enum, int Min, int Max>
-MGUTILITY_CNSTXPR inline auto to_enum_impl(mgutility::string_view str) noexcept
-    -> mgutility::optional<Enum> {
-  MGUTILITY_CNSTXPR_CLANG_WA auto arr = get_enum_array<Enum, Min, Max>();
+template <std::size_t Capacity, typename Lookup>
+void extract_name(std::istream &is, Lookup lookup) {
+  using traits = std::istream::traits_type;
+  const std::istream::sentry sentry(is);
+  if (!sentry) {
+    return;
+  }
+
+  const auto &ctype = std::use_facet<std::ctype<char>>(is.getloc());
+  auto &buf = *is.rdbuf();
+  auto *const first = streambuf_access::next(buf);
+  auto *const last = streambuf_access::end(buf);
+  auto *pos = first;
+  while (pos != last && !ctype.is(std::ctype_base::space, *pos)) {
+    ++pos;
+  }
+  if (pos != first && pos != last) {
+    const auto size = static_cast<std::size_t>(pos - first);
+    streambuf_access::consume(buf, size);
+    if (!lookup(mgutility::string_view(first, size))) {
+      is.setstate(std::ios_base::failbit);
+    }
+    return;
+  }
 
-  const auto index{detail::find(arr, str)};
-  return index == 0 ? mgutility::nullopt
-                    : mgutility::optional<Enum>{static_cast<Enum>(index + Min)};
+  std::array<char, Capacity> scratch{};
+  std::string spill;
+  std::size_t size = 0;
+  auto state = std::ios_base::goodbit;
+  for (auto chr = buf.sgetc();; chr = buf.snextc()) {
+    if (traits::eq_int_type(chr, traits::eof())) {
+      state |= std::ios_base::eofbit;
+      break;
+    }
+    const auto value = traits::to_char_type(chr);
+    if (ctype.is(std::ctype_base::space, value)) {
+      break;
+    }
+    if (size < Capacity) {
+      scratch[size] = value;
+    } else {
+      if (size == Capacity) {
+        spill.assign(scratch.data(), Capacity);
+      }
+      spill.push_back(value);
+    }
+    ++size;
+  }
+  const auto name = size <= Capacity
+                        ? mgutility::string_view(scratch.data(), size)
+                        : mgutility::string_view(spill.data(), spill.size());
+  if (size == 0 || !lookup(name)) {
+    state |= std::ios_base::failbit;
+  }
+  is.setstate(state);
 }
 
-/**
- * @brief Converts a string to an enum bitmask value.
- *
- * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @param str The string view representing the enum name.
- * @return An optional enum bitmask value.
- */
-template <typename Enum, int Min, int Max>
-MGUTILITY_CNSTXPR auto to_enum_bitmask_impl(mgutility::string_view str) noexcept
-    -> mgutility::optional<Enum> {
+} // namespace detail
+} // namespace mgutility
 
-  // Check if the string contains a '|' character
-  if (str.find('|') == mgutility::string_view::npos) {
-    return to_enum_impl<Enum, Min, Max>(str);
-  }
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_STREAM_HPP
 
-  mgutility::optional<Enum> result{mgutility::nullopt};
-  std::size_t index = 0;
+/*
+MIT License
 
-  for (std::size_t i = 0; i < str.size(); ++i) {
-    if (str[i] == '|') {
-      auto name = str.substr(index, i - index);
-      auto maybe_enum = to_enum_impl<Enum, Min, Max>(name);
+Copyright (c) 2024 mguludag
 
-      if (!name.empty() && maybe_enum) {
-        result.emplace(result ? static_cast<Enum>(*result | *maybe_enum)
-                              : *maybe_enum);
-      }
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
 
-      index = i + 1;
-    }
-  }
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
 
-  auto maybe_enum = to_enum_impl<Enum, Min, Max>(str.substr(index));
-  if (result && maybe_enum) {
-    result.emplace(static_cast<Enum>(*result | *maybe_enum));
-  } else {
-    result.reset();
-  }
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
 
-  return result;
-}
+#ifndef MGUTILITY_REFLECTION_DETAIL_ENUM_SUGGEST_HPP
+#define MGUTILITY_REFLECTION_DETAIL_ENUM_SUGGEST_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace mgutility {
 
 /**
- * @brief Gets the name of an enum value.
+ * @brief A name suggested for a string that is not a name of an enum.
  *
  * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @param e The enum value.
- * @return A string view representing the name of the enum value.
  */
-template <typename Enum, int Min, int Max,
-          detail::enable_if_t<!detail::has_bit_or<Enum>::value, bool> = true>
-MGUTILITY_CNSTXPR auto enum_name_impl(Enum enumValue) noexcept
-    -> mgutility::string_view {
-  MGUTILITY_CNSTXPR_CLANG_WA auto arr = get_enum_array<Enum, Min, Max>();
-  const auto index{(Min < 0 ? -Min : Min) + static_cast<int>(enumValue)};
-  if (index < Min || index > static_cast<int>(arr.size()) - 1) {
-    return mgutility::string_view{};
-  }
+template <typename Enum> struct enum_suggestion {
+  Enum value;                  /**< The suggested value. */
+  mgutility::string_view name; /**< The name of the value. */
+  std::size_t distance;        /**< The edit distance from the string. */
+};
 
-  return arr[static_cast<size_t>(index)];
-}
+namespace detail {
 
 /**
- * @brief Gets the name of an enum bitmask value.
+ * @brief The per-character match masks of a pattern of at most 64 bytes,
+ * for Myers' bit-parallel edit distance.
  *
- * @tparam Enum The enum type.
- * @tparam Min The minimum enum value.
- * @tparam Max The maximum enum value.
- * @param e The enum value.
- * @return A string view or string representing the name of the enum bitmask
- * value.
+ * Bit i of the mask of a character is set if the pattern has that character
+ * at position i. Clearing only touches the characters of the pattern, so
+ * one table can be reused for many patterns.
+ *
+ * @tparam Hasher The name hash whose fold() maps the characters.
  */
-// NOLINTNEXTLINE [modernize-use-constraints]
-template <typename Enum, int Min, int Max,
-          detail::enable_if_t<detail::has_bit_or<Enum>::value, bool> = true>
-MGUTILITY_CNSTXPR_CLANG_WA auto enum_name_impl(Enum enumValue) noexcept
-    -> mgutility::fixed_string<enum_name_buffer<Enum>::size> {
-
-  // Get the array of enum names
-  MGUTILITY_CNSTXPR_CLANG_WA auto arr = get_enum_array<Enum, Min, Max>();
-
-  // Calculate the index in the array
-  const auto index = (Min < 0 ? -Min : Min) + static_cast<int>(enumValue);
+template <typename Hasher> struct myers_pattern {
+  static constexpr std::size_t max_size = 64;
 
-  mgutility::fixed_string<enum_name_buffer<Enum>::size> bitmasked_name;
+  std::array<std::uint64_t, 256> masks{}; /**< The mask of each character. */
+  std::array<char, max_size> chars{};     /**< A copy of the pattern. */
+  std::size_t size{};                     /**< The length of the pattern. */
 
-  if (index >= 0 && index < static_cast<int>(arr.size())) {
-    bitmasked_name.append(arr[static_cast<size_t>(index)]);
+  /**
+   * @brief Gets the table index of a character.
+   *
+   * @param chr The character.
+   * @return The index.
+   */
+  static constexpr auto index(char chr) noexcept -> std::size_t {
+    return static_cast<unsigned char>(Hasher::fold(chr));
   }
 
-  if (!bitmasked_name.empty()) {
-    return bitmasked_name;
+  /**
+   * @brief Sets the pattern.
+   *
+   * @param str The pattern, at most max_size bytes.
+   */
+  void assign(mgutility::string_view str) noexcept {
+    clear();
+    size = str.size();
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      chars[idx] = str[idx];
+      masks[index(str[idx])] |= std::uint64_t{1} << idx;
+    }
   }
 
-  for (auto i = 0; i < Max - Min; ++i) {
-    if (i >= 0 && i < static_cast<int>(arr.size()) && arr[i].size() > 0 &&
-        (enumValue & static_cast<Enum>(i)) == static_cast<Enum>(i)) {
-      bitmasked_name.append(arr[i]).append("|");
+  /**
+   * @brief Clears the masks of the current pattern.
+   */
+  void clear() noexcept {
+    for (std::size_t idx = 0; idx < size; ++idx) {
+      masks[index(chars[idx])] = 0;
     }
+    size = 0;
   }
 
-  // Remove the trailing '|' if present
-  if (!bitmasked_name.empty()) {
-    bitmasked_name.pop_back();
-  }
+  /**
+   * @brief Computes the edit distance between the pattern and a text,
+   * giving up early once it cannot be at most a bound.
+   *
+   * The pattern is one column of the dynamic programming matrix held in two
+   * bit vectors of vertical deltas, so each character of the text costs a
+   * few word operations (Myers 1999, in Hyyrö's formulation for the global
+   * distance).
+   *
+   * @param text The text.
+   * @param bound The largest distance of interest.
+   * @return The distance, or a value greater than bound.
+   */
+  auto distance(mgutility::string_view text, std::size_t bound) const noexcept
+      -> std::size_t {
+    if (size == 0) {
+      return text.size();
+    }
 
-  return bitmasked_name;
-}
-} // namespace detail
-} // namespace mgutility
+    const auto last = std::uint64_t{1} << (size - 1);
+    auto positive = size == max_size ? ~std::uint64_t{0} : (last << 1) - 1;
+    std::uint64_t negative = 0;
+    auto score = size;
+
+    for (std::size_t idx = 0; idx < text.size(); ++idx) {
+      const auto equal = masks[index(text[idx])];
+      const auto vertical = equal | negative;
+      const auto diagonal =
+          (((equal & positive) + positive) ^ positive) | equal;
+      auto horizontal_pos = negative | ~(diagonal | positive);
+      auto horizontal_neg = positive & diagonal;
+
+      if ((horizontal_pos & last) != 0) {
+        ++score;
+      } else if ((horizontal_neg & last) != 0) {
+        --score;
+      }
 
-#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_NAME_IMPL_HPP
-namespace mgutility {
+      // Every remaining character lowers the score by at most one
+      const auto remaining = text.size() - idx - 1;
+      if (score > remaining && score - remaining > bound) {
+        return bound + 1;
+      }
 
-/**
- * @brief Converts an enum value to its underlying integer value.
- *
- * @tparam Enum The enum type.
- * @param e The enum value.
- * @return The underlying integer value of the enum.
- */
-template <typename Enum,
-          // NOLINTNEXTLINE [modernize-type-traits]
-          detail::enable_if_t<std::is_enum<Enum>::value, bool> = true>
-constexpr auto to_underlying(Enum enumValue) noexcept
-    -> detail::underlying_type_t<Enum> {
-  // NOLINTNEXTLINE [modernize-type-traits]
-  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
-  return static_cast<detail::underlying_type_t<Enum>>(enumValue);
-}
+      horizontal_pos = (horizontal_pos << 1) | 1;
+      horizontal_neg <<= 1;
+      positive = horizontal_neg | ~(vertical | horizontal_pos);
+      negative = horizontal_pos & vertical;
+    }
+    return score;
+  }
+};
 
 /**
- * @brief Gets the name of an enum value.
+ * @brief Suggests the names of an enum closest to a string.
+ *
+ * The string is the Myers pattern when it fits one word; otherwise each
+ * name that fits is the pattern in turn, and pairs where neither fits are
+ * skipped. Names whose length alone puts them past the worst kept
+ * suggestion are not compared at all.
  *
+ * @tparam Enum The enum type.
  * @tparam Min The minimum enum value.
  * @tparam Max The maximum enum value.
- * @tparam Enum The enum type.
- * @param e The enum value.
- * @return A string view or string representing the name of the enum value.
+ * @tparam Hasher The name hash whose fold() maps the characters.
+ * @param str The string.
+ * @param out The suggestions, closest first.
+ * @param count The maximum number of suggestions.
+ * @param max_distance The largest edit distance suggested.
+ * @return The number of suggestions written.
  */
-template <int Min, int Max, typename Enum>
-MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
-    -> detail::string_or_view_t<Enum> {
-  static_assert(Min < Max, "Max must be greater than Min!");
-  // NOLINTNEXTLINE [modernize-type-traits]
-  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
-  return detail::enum_name_impl<Enum, Min, Max>(enumValue);
-}
+template <typename Enum, int Min, int Max, typename Hasher>
+auto suggest_impl(mgutility::string_view str, enum_suggestion<Enum> *out,
+                  std::size_t count, std::size_t max_distance) noexcept
+    -> std::size_t {
+  using pattern_type = myers_pattern<Hasher>;
+  if (count == 0) {
+    return 0;
+  }
 
-/**
- * @brief Gets the name of an enum value.
- *
- * @tparam Enum The enum type.
- * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
- * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
- * @param e The enum value.
- * @return A string view or string representing the name of the enum value.
- */
-template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
-          int Max = static_cast<int>(enum_range<Enum>::max)>
-MGUTILITY_CNSTXPR auto enum_name(Enum enumValue) noexcept
-    -> detail::string_or_view_t<Enum> {
-  static_assert(Min < Max, "Max must be greater than Min!");
-  // NOLINTNEXTLINE [modernize-type-traits]
-  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
-  return detail::enum_name_impl<Enum, Min, Max>(enumValue);
-}
+  pattern_type pattern;
+  const auto fixed = str.size() <= pattern_type::max_size;
+  if (fixed) {
+    pattern.assign(str);
+  }
 
-/**
- * @brief Gets the enum value and its name.
- *
- * @tparam Enum The enum type.
- * @return A pair of the enum value and its name.
- */
-template <typename Enum>
-auto enum_for_each<Enum>::enum_iter::operator*() const -> value_type {
-  auto value = static_cast<Enum>(m_pos);
-  return detail::enum_pair<Enum>{value, enum_name(value)};
+  const auto &names = get_enum_array<Enum, Min, Max>();
+  const auto &values = get_enum_values<Enum, Min, Max>();
+  std::size_t found = 0;
+  for (std::size_t idx = 0; idx < values.size; ++idx) {
+    const auto slot = static_cast<std::size_t>(values.items[idx]);
+    const auto name = names[slot];
+    if (found == count && out[count - 1].distance == 0) {
+      break;
+    }
+    const auto bound =
+        found == count ? out[count - 1].distance - 1 : max_distance;
+    const auto gap = name.size() > str.size() ? name.size() - str.size()
+                                              : str.size() - name.size();
+    if (gap > bound) {
+      continue;
+    }
+
+    std::size_t distance = 0;
+    if (fixed) {
+      distance = pattern.distance(name, bound);
+    } else if (name.size() <= pattern_type::max_size) {
+      pattern.assign(name);
+      distance = pattern.distance(str, bound);
+    } else {
+      continue;
+    }
+    if (distance > bound) {
+      continue;
+    }
+
+    // Insert after the suggestions not farther away, dropping the last one
+    // when the buffer is full
+    auto pos = found < count ? found++ : count - 1;
+    for (; pos > 0 && out[pos - 1].distance > distance; --pos) {
+      out[pos] = out[pos - 1];
+    }
+    out[pos] = enum_suggestion<Enum>{
+        static_cast<Enum>(static_cast<int>(slot) + Min), name, distance};
+  }
+  return found;
 }
 
+} // namespace detail
+
 /**
- * @brief Converts a string to an enum value.
+ * @brief Suggests the names of an enum closest to a string, e.g. for a "did
+ * you mean" message after to_enum failed.
+ *
+ * Names are ranked by edit distance, ties by value. Only the failure path
+ * pays for this: to_enum itself is unchanged.
  *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
  * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
- * @param str The string view representing the enum name.
- * @return An optional enum value.
+ * @param str The string.
+ * @param out The suggestions, closest first.
+ * @param count The maximum number of suggestions.
+ * @param max_distance The largest edit distance suggested, default is no
+ * limit.
+ * @return The number of suggestions written.
  */
 template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
           int Max = static_cast<int>(enum_range<Enum>::max),
-          detail::enable_if_t<!detail::has_bit_or<Enum>::value, bool> = true>
-MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str) noexcept
-    -> mgutility::optional<Enum> {
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+auto suggest(mgutility::string_view str, enum_suggestion<Enum> *out,
+             std::size_t count,
+             std::size_t max_distance = static_cast<std::size_t>(-1)) noexcept
+    -> std::size_t {
   static_assert(Min < Max, "Max must be greater than Min!");
   // NOLINTNEXTLINE [modernize-type-traits]
   static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
-  return detail::to_enum_impl<Enum, Min, Max>(str);
+  return detail::suggest_impl<Enum, Min, Max, detail::fnv_name_hasher>(
+      str, out, count, max_distance);
 }
 
 /**
- * @brief Converts a string to an enum bitmask value.
+ * @brief Suggests the names of an enum closest to a string, ignoring ASCII
+ * case.
  *
  * @tparam Enum The enum type.
  * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
  * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
- * @param str The string view representing the enum name.
- * @return An optional enum bitmask value.
+ * @param str The string.
+ * @param out The suggestions, closest first.
+ * @param count The maximum number of suggestions.
+ * @param max_distance The largest edit distance suggested, default is no
+ * limit.
+ * @return The number of suggestions written.
  */
 template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
           int Max = static_cast<int>(enum_range<Enum>::max),
-          detail::enable_if_t<detail::has_bit_or<Enum>::value, bool> = true>
-MGUTILITY_CNSTXPR auto to_enum(mgutility::string_view str) noexcept
-    -> mgutility::optional<Enum> {
+          detail::enable_if_t<!detail::has_bit_or<Enum>::value &&
+                                  !enum_flags<Enum>::value,
+                              bool> = true>
+auto suggest(mgutility::string_view str, case_insensitive_t /*unused*/,
+             enum_suggestion<Enum> *out, std::size_t count,
+             std::size_t max_distance = static_cast<std::size_t>(-1)) noexcept
+    -> std::size_t {
   static_assert(Min < Max, "Max must be greater than Min!");
   // NOLINTNEXTLINE [modernize-type-traits]
   static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
-  return detail::to_enum_bitmask_impl<Enum, Min, Max>(str);
+  return detail::suggest_impl<Enum, Min, Max, detail::folded_name_hasher>(
+      str, out, count, max_distance);
 }
 
+} // namespace mgutility
+
+#endif // MGUTILITY_REFLECTION_DETAIL_ENUM_SUGGEST_HPP
+
 /**
- * @brief Casts an integer value to an enum value.
+ * @brief Outputs the name of an enum value to an output stream.
+ *
+ * Each name, and each flag name and separator of a bitmask value, is one
+ * write() to the stream; nothing is buffered first. A width set on the
+ * stream is honored.
  *
  * @tparam Enum The enum type.
- * @tparam Min The minimum enum value, default is enum_range<Enum>::min.
- * @tparam Max The maximum enum value, default is enum_range<Enum>::max.
- * @param value The integer value to cast.
- * @return An optional enum value.
+ * @param outStream The output stream.
+ * @param enumVal The enum value.
+ * @return The output stream.
  */
-template <typename Enum, int Min = static_cast<int>(enum_range<Enum>::min),
-          int Max = static_cast<int>(enum_range<Enum>::max)>
-MGUTILITY_CNSTXPR auto enum_cast(int value) noexcept
-    -> mgutility::optional<Enum> {
-  static_assert(Min < Max, "Max must be greater than Min!");
-  // NOLINTNEXTLINE [modernize-type-traits]
-  static_assert(std::is_enum<Enum>::value, "Type is not an Enum type!");
-  if (enum_name(static_cast<Enum>(value)).empty()) {
-    return mgutility::nullopt;
-  }
-  return mgutility::optional<Enum>{static_cast<Enum>(value)};
-}
-
-namespace operators {
-template <typename Enum, mgutility::detail::enable_if_t<
-                             // NOLINTNEXTLINE [modernize-type-traits]
-                             std::is_enum<Enum>::value, bool> = true>
-constexpr auto operator&(const Enum &lhs, const Enum &rhs) -> Enum {
-  return static_cast<Enum>(mgutility::to_underlying(lhs) &
-                           mgutility::to_underlying(rhs));
-}
-
 template <typename Enum, mgutility::detail::enable_if_t<
                              // NOLINTNEXTLINE [modernize-type-traits]
                              std::is_enum<Enum>::value, bool> = true>
-constexpr auto operator|(const Enum &lhs, const Enum &rhs) -> Enum {
-  return static_cast<Enum>(mgutility::to_underlying(lhs) |
-                           mgutility::to_underlying(rhs));
+auto operator<<(std::ostream &outStream, Enum enumVal) -> std::ostream & {
+  // NOLINTNEXTLINE [modernize-type-traits]
+  static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
+  if (outStream.width() != 0) {
+    const auto name = mgutility::enum_name(enumVal);
+    mgutility::detail::write_padded(
+        outStream, static_cast<mgutility::string_view>(name));
+    return outStream;
+  }
+  mgutility::detail::ostream_sink sink{outStream};
+  mgutility::detail::write_enum_name<
+      Enum, static_cast<int>(mgutility::enum_range<Enum>::min),
+      static_cast<int>(mgutility::enum_range<Enum>::max)>(enumVal, sink);
+  return outStream;
 }
-} // namespace operators
-
-} // namespace mgutility
 
 /**
- * @brief Outputs the name of an enum value to an output stream.
+ * @brief Reads an enum value by name from an input stream.
+ *
+ * Reads one whitespace-delimited name, masks joined with '|' for bitmask
+ * and flag enums, straight from the stream buffer without allocating. On an
+ * unknown name failbit is set and the value is left unchanged.
  *
  * @tparam Enum The enum type.
- * @param os The output stream.
- * @param e The enum value.
- * @return The output stream.
+ * @param inStream The input stream.
+ * @param enumVal The enum value to store into.
+ * @return The input stream.
  */
 template <typename Enum, mgutility::detail::enable_if_t<
                              // NOLINTNEXTLINE [modernize-type-traits]
                              std::is_enum<Enum>::value, bool> = true>
-auto operator<<(std::ostream &outStream, Enum enumVal) -> std::ostream & {
+auto operator>>(std::istream &inStream, Enum &enumVal) -> std::istream & {
   // NOLINTNEXTLINE [modernize-type-traits]
   static_assert(std::is_enum<Enum>::value, "Value is not an Enum type!");
-  outStream << mgutility::enum_name(enumVal);
-  return outStream;
+  mgutility::detail::extract_name<mgutility::enum_name_buffer<Enum>::size>(
+      inStream, [&enumVal](mgutility::string_view name) {
+        auto value = mgutility::to_enum<Enum>(name);
+        if (value.has_value()) {
+          enumVal = value.value();
+        }
+        return value.has_value();
+      });
+  return inStream;
 }
 
 #if defined(__cpp_lib_format)
@@ -2278,15 +9341,53 @@ auto operator<<(std::ostream &outStream, Enum enumVal) -> std::ostream & {
 /**
  * @brief Formatter for enum types for use with std::format.
  *
+ * `{}` and string specs such as `{:>10}` format the name, `{:d}`, `{:x}`,
+ * `{:X}`, `{:o}`, `{:b}` and `{:B}` (with any integer spec before them) the
+ * underlying value, and `{:q}` the name in double quotes, optionally with a
+ * single-character fill, an alignment and a width (`{:*^12q}`). The name is
+ * handed over with its length, so nothing is measured or copied first.
+ *
  * @tparam Enum The enum type.
  */
 template <typename Enum>
   requires std::is_enum_v<Enum>
-struct std::formatter<Enum> : formatter<std::string_view> {
+struct std::formatter<Enum> {
+  constexpr auto parse(std::format_parse_context &ctx)
+      -> std::format_parse_context::iterator {
+    const auto last = mgutility::detail::find_spec_end(ctx.begin(), ctx.end());
+    m_spec.presentation =
+        mgutility::detail::enum_presentation_of(ctx.begin(), last);
+    switch (m_spec.presentation) {
+    case mgutility::detail::enum_presentation::value:
+      return m_value.parse(ctx);
+    case mgutility::detail::enum_presentation::quoted:
+      if (!mgutility::detail::parse_quoted_spec(ctx.begin(), last, m_spec)) {
+        throw std::format_error("Invalid format spec for a quoted enum name!");
+      }
+      return last;
+    default:
+      return m_name.parse(ctx);
+    }
+  }
+
+  template <typename FormatContext>
   // NOLINTNEXTLINE [readability-identifier-length]
-  auto constexpr format(Enum e, format_context &ctx) const {
-    return formatter<std::string_view>::format(mgutility::enum_name(e), ctx);
+  auto format(Enum e, FormatContext &ctx) const -> decltype(ctx.out()) {
+    if (m_spec.presentation == mgutility::detail::enum_presentation::value) {
+      return m_value.format(mgutility::to_underlying(e), ctx);
+    }
+    const auto name = mgutility::enum_name(e);
+    const auto view = static_cast<mgutility::string_view>(name);
+    if (m_spec.presentation == mgutility::detail::enum_presentation::quoted) {
+      return mgutility::detail::write_quoted(view, m_spec, ctx.out());
+    }
+    return m_name.format(std::string_view(view.data(), view.size()), ctx);
   }
+
+private:
+  std::formatter<std::string_view> m_name;
+  std::formatter<std::underlying_type_t<Enum>> m_value;
+  mgutility::detail::enum_format_spec m_spec;
 };
 
 #endif
@@ -2295,17 +9396,59 @@ struct std::formatter<Enum> : formatter<std::string_view> {
     (defined(MGUTILITY_HAS_HAS_INCLUDE) && __has_include(<fmt/format.h>))
 #include <fmt/format.h>
 
+/**
+ * @brief Formatter for enum types for use with fmt::format.
+ *
+ * Takes the same specs as the std::format one: `{}` and string specs format
+ * the name, integer specs ending in `d`, `x`, `X`, `o`, `b` or `B` the
+ * underlying value, and `{:q}` the quoted name. It works with FMT_COMPILE
+ * and fmt::format_to_n.
+ *
+ * @tparam Enum The enum type.
+ */
 template <class Enum>
 struct fmt::formatter<Enum, char,
                       // NOLINTNEXTLINE [modernize-type-traits]
-                      mgutility::detail::enable_if_t<std::is_enum<Enum>::value>>
-    : formatter<string_view> {
+                      mgutility::detail::enable_if_t<std::is_enum<Enum>::value>> {
+  template <typename ParseContext>
+  FMT_CONSTEXPR auto parse(ParseContext &ctx) -> decltype(ctx.begin()) {
+    const auto last = mgutility::detail::find_spec_end(ctx.begin(), ctx.end());
+    m_spec.presentation =
+        mgutility::detail::enum_presentation_of(ctx.begin(), last);
+    switch (m_spec.presentation) {
+    case mgutility::detail::enum_presentation::value:
+      return m_value.parse(ctx);
+    case mgutility::detail::enum_presentation::quoted:
+      if (!mgutility::detail::parse_quoted_spec(ctx.begin(), last, m_spec)) {
+        FMT_THROW(format_error("Invalid format spec for a quoted enum name!"));
+      }
+      return last;
+    default:
+      return m_name.parse(ctx);
+    }
+  }
+
+  template <typename FormatContext>
   // NOLINTNEXTLINE [readability-identifier-length]
-  auto format(const Enum e, format_context &ctx) const -> appender {
-    return formatter<string_view>::format(
-        static_cast<mgutility::string_view>(mgutility::enum_name(e)).data(),
-        ctx);
+  auto format(const Enum e, FormatContext &ctx) const -> decltype(ctx.out()) {
+    if (m_spec.presentation == mgutility::detail::enum_presentation::value) {
+      return m_value.format(mgutility::to_underlying(e), ctx);
+    }
+    const auto name = mgutility::enum_name(e);
+    const auto view = static_cast<mgutility::string_view>(name);
+    if (m_spec.presentation == mgutility::detail::enum_presentation::quoted) {
+      return mgutility::detail::write_quoted(view, m_spec, ctx.out());
+    }
+    return m_name.format(string_view(view.data(), view.size()), ctx);
   }
+
+private:
+  // NOLINTNEXTLINE [modernize-type-traits]
+  using underlying_type = typename std::underlying_type<Enum>::type;
+
+  formatter<string_view> m_name;
+  formatter<underlying_type> m_value;
+  mgutility::detail::enum_format_spec m_spec;
 };
 #endif // MGUTILITY_USE_FMT || __has_include(<fmt/format.h>)
 
@@ -2,7 +2,26 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest/doctest.h"
 #include "mgutility/reflection/enum_name.hpp"
+#include "mgutility/reflection/enum_column.hpp"
+#include <array>
+#include <atomic>
+#include <algorithm>
 #include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(ENUM_NAME_USE_FMT)
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#endif
 
 // ======================================================================
 // Enum 1: color (uint32_t underlying) with custom naming
@@ -227,6 +246,29 @@ template <> struct mgutility::enum_range<bitmask_flags> {
   static constexpr auto max = 8;
 };
 
+// ======================================================================
+// Enum 4b: file_access (int underlying) with operator| — tests bitmask
+// names made of composite and single-bit values
+// ======================================================================
+// NOLINTNEXTLINE [performance-enum-size]
+enum class file_access : int {
+  none = 0,
+  read = 1,
+  write = 2,
+  execute = 4,
+  all = 7
+};
+
+constexpr auto operator|(file_access lhs, file_access rhs) -> file_access {
+  return static_cast<file_access>(static_cast<int>(lhs) |
+                                  static_cast<int>(rhs));
+}
+
+template <> struct mgutility::enum_range<file_access> {
+  static constexpr auto min = 0;
+  static constexpr auto max = 8;
+};
+
 // ======================================================================
 // Enum 5: unscoped enum (int underlying) — tests unscoped enum support
 // ======================================================================
@@ -260,6 +302,168 @@ template <> struct mgutility::enum_range<signed_values> {
   static constexpr auto max = static_cast<int>(signed_values::pos_two) + 1;
 };
 
+// ======================================================================
+// Enum 7: enum in a namespace — tests qualified names are stripped
+// ======================================================================
+namespace outer {
+// NOLINTNEXTLINE [performance-enum-size]
+enum class nested : int { first, second, third };
+} // namespace outer
+
+template <> struct mgutility::enum_range<outer::nested> {
+  static constexpr auto min = 0;
+  static constexpr auto max = 4;
+};
+
+// ======================================================================
+// Enum 8: wide_range (short underlying) — tests a range probed in several
+// chunks, with values on both sides of the chunk boundaries
+// ======================================================================
+enum class wide_range : short {
+  lowest = -1000,
+  below_zero = -1,
+  zero = 0,
+  chunk_end = MGUTILITY_ENUM_PROBE_CHUNK - 1,
+  chunk_begin = MGUTILITY_ENUM_PROBE_CHUNK,
+  highest = 2999
+};
+
+template <> struct mgutility::enum_range<wide_range> {
+  static constexpr auto min = -1000;
+  static constexpr auto max = 3000;
+};
+
+// ======================================================================
+// Enum 9: wide_flags (uint64_t underlying) — tests flag reflection over the
+// full width of the underlying type
+// ======================================================================
+enum class wide_flags : uint64_t {
+  none = 0,
+  low = 1ULL << 0,
+  mid = 1ULL << 12,
+  upper = 1ULL << 32,
+  top = 1ULL << 63
+};
+
+template <> struct mgutility::enum_flags<wide_flags> {
+  static constexpr auto value = true;
+};
+
+template <> struct mgutility::custom_enum<wide_flags> {
+  static constexpr flat_map<wide_flags> map{
+      {wide_flags::top, "TOP"},
+      {static_cast<wide_flags>((1ULL << 0) | (1ULL << 12)), "LOW_MID"}};
+};
+
+// ======================================================================
+// Enum 10: permission (uint32_t underlying) — tests the 32nd bit as a flag
+// ======================================================================
+// NOLINTNEXTLINE [performance-enum-size]
+enum class permission : uint32_t {
+  read = 1U << 0,
+  write = 1U << 1,
+  admin = 1U << 31
+};
+
+template <> struct mgutility::enum_flags<permission> {
+  static constexpr auto value = true;
+};
+
+// ======================================================================
+// Enum 11: shared_prefix — tests 256 names that differ only in their last
+// characters, filling the whole default range
+// ======================================================================
+#define SHARED_PREFIX_X4(p) p##0, p##1, p##2, p##3
+#define SHARED_PREFIX_X16(p)                                                   \
+  SHARED_PREFIX_X4(p##0), SHARED_PREFIX_X4(p##1), SHARED_PREFIX_X4(p##2),      \
+      SHARED_PREFIX_X4(p##3)
+#define SHARED_PREFIX_X64(p)                                                   \
+  SHARED_PREFIX_X16(p##0), SHARED_PREFIX_X16(p##1), SHARED_PREFIX_X16(p##2),   \
+      SHARED_PREFIX_X16(p##3)
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class shared_prefix : int {
+  SHARED_PREFIX_X64(shared_prefix_name_0),
+  SHARED_PREFIX_X64(shared_prefix_name_1),
+  SHARED_PREFIX_X64(shared_prefix_name_2),
+  SHARED_PREFIX_X64(shared_prefix_name_3)
+};
+
+// ======================================================================
+// Enum 12: first_use / first_use_flags — only used by the concurrency test,
+// so that its threads are the first to touch the name tables
+// ======================================================================
+// NOLINTNEXTLINE [performance-enum-size]
+enum class first_use : int { alpha, beta = 3, gamma = 200 };
+
+template <> struct mgutility::custom_enum<first_use> {
+  static constexpr flat_map<first_use> map{{first_use::beta, "BETA"}};
+};
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class first_use_flags : uint16_t { none = 0, one = 1U << 0, last = 1U << 15 };
+
+template <> struct mgutility::enum_flags<first_use_flags> {
+  static constexpr auto value = true;
+};
+
+// ======================================================================
+// Enum 13: localized / localized_perm — display names published at runtime
+// ======================================================================
+// NOLINTNEXTLINE [performance-enum-size]
+enum class localized : int { ok, retry, failed = 7 };
+
+template <> struct mgutility::enum_name_overlay<localized> {
+  static constexpr auto value = true;
+};
+
+// NOLINTNEXTLINE [performance-enum-size]
+enum class localized_perm : uint8_t { none = 0, read = 1, write = 2 };
+
+template <> struct mgutility::enum_flags<localized_perm> {
+  static constexpr auto value = true;
+};
+
+template <> struct mgutility::enum_name_overlay<localized_perm> {
+  static constexpr auto value = true;
+};
+
+// ======================================================================
+// Enum 14: channel_flags / channel_flags_wide — flag names that, all set,
+// are longer than the default name buffer
+// ======================================================================
+enum class channel_flags : uint32_t {
+  none = 0,
+  alpha_channel = 1U << 0,
+  beta_channel = 1U << 1,
+  gamma_channel = 1U << 2,
+  delta_channel = 1U << 3,
+  epsilon_channel = 1U << 4,
+  zeta_channel = 1U << 5
+};
+
+template <> struct mgutility::enum_flags<channel_flags> {
+  static constexpr auto value = true;
+};
+
+enum class channel_flags_wide : uint32_t {
+  none = 0,
+  alpha_channel = 1U << 0,
+  beta_channel = 1U << 1,
+  gamma_channel = 1U << 2,
+  delta_channel = 1U << 3,
+  epsilon_channel = 1U << 4,
+  zeta_channel = 1U << 5
+};
+
+template <> struct mgutility::enum_flags<channel_flags_wide> {
+  static constexpr auto value = true;
+};
+
+template <> struct mgutility::enum_name_buffer<channel_flags_wide> {
+  static constexpr auto size = 128U;
+};
+
 // ======================================================================
 // Test: enum name serialization for color (original + custom name)
 // ======================================================================
@@ -338,15 +542,28 @@ TEST_CASE("status enum name serialization") {
   CHECK(mgutility::enum_name(status::paused) == "paused");
   CHECK(mgutility::enum_name(status::completed) == "DONE");
   CHECK(mgutility::enum_name(status::failed) == "ERROR");
+  CHECK(mgutility::enum_name<1, 5>(status::idle) == "idle");
+  CHECK(mgutility::enum_name<1, 5>(status::paused) == "paused");
+  CHECK(mgutility::enum_name<1, 5>(status::unknown) == "");
+}
+
+TEST_CASE("status name table is materialized once") {
+  const auto &first = mgutility::detail::get_enum_array<status>();
+  const auto &second = mgutility::detail::get_enum_array<status>();
+  CHECK(&first == &second);
+  CHECK(first[static_cast<std::size_t>(status::completed)] == "DONE");
 }
 
 TEST_CASE("status enum name deserialization") {
-  // skip index-0 (unknown) — find treats 0 as not-found
+  CHECK(mgutility::to_enum<status>("unknown").value() == status::unknown);
   CHECK(mgutility::to_enum<status>("idle").value() == status::idle);
   CHECK(mgutility::to_enum<status>("running").value() == status::running);
   CHECK(mgutility::to_enum<status>("paused").value() == status::paused);
   CHECK(mgutility::to_enum<status>("DONE").value() == status::completed);
   CHECK(mgutility::to_enum<status>("ERROR").value() == status::failed);
+  CHECK_FALSE(mgutility::to_enum<status>("completed").has_value());
+  CHECK_FALSE(mgutility::to_enum<status>("").has_value());
+  CHECK_FALSE(mgutility::to_enum<status>("idl").has_value());
 }
 
 // ======================================================================
@@ -363,7 +580,7 @@ TEST_CASE("weekday enum name serialization") {
 }
 
 TEST_CASE("weekday enum name deserialization") {
-  // skip index-0 (monday/MON) — find treats 0 as not-found
+  CHECK(mgutility::to_enum<weekday>("MON").value() == weekday::monday);
   CHECK(mgutility::to_enum<weekday>("tuesday").value() == weekday::tuesday);
   CHECK(mgutility::to_enum<weekday>("wednesday").value() == weekday::wednesday);
   CHECK(mgutility::to_enum<weekday>("thursday").value() == weekday::thursday);
@@ -390,6 +607,99 @@ TEST_CASE("bitmask_flags bitwise or") {
   CHECK(mgutility::enum_name(bitmask_flags::write) == "write");
 }
 
+TEST_CASE("file_access composite name serialization") {
+  CHECK(mgutility::enum_name(file_access::read | file_access::write) ==
+        "read|write");
+  CHECK(mgutility::enum_name(file_access::all) == "all");
+  CHECK(mgutility::enum_name(file_access::none) == "none");
+  CHECK(mgutility::enum_name(static_cast<file_access>(15)) == "all|0x8");
+  CHECK(mgutility::enum_name(static_cast<file_access>(48)) == "0x30");
+}
+
+TEST_CASE("file_access enum name deserialization") {
+  CHECK(mgutility::to_enum<file_access>("read|write").value() ==
+        (file_access::read | file_access::write));
+  CHECK(mgutility::to_enum<file_access>(" read | execute ").value() ==
+        (file_access::read | file_access::execute));
+  CHECK(mgutility::to_enum<file_access>("all|none").value() ==
+        file_access::all);
+  CHECK(mgutility::to_enum<file_access>("read, write", ", ").value() ==
+        (file_access::read | file_access::write));
+  CHECK(mgutility::to_enum<file_access>("read,write", ", ").value() ==
+        (file_access::read | file_access::write));
+  CHECK_FALSE(mgutility::to_enum<file_access>("read|bogus|write").has_value());
+  CHECK_FALSE(mgutility::to_enum<file_access>("read||write").has_value());
+  CHECK_FALSE(mgutility::to_enum<file_access>("re ad").has_value());
+  CHECK_FALSE(mgutility::to_enum<file_access>("").has_value());
+}
+
+// ======================================================================
+// Test: flag enums
+// ======================================================================
+TEST_CASE("wide_flags enum name serialization") {
+  CHECK(mgutility::enum_name(wide_flags::none) == "none");
+  CHECK(mgutility::enum_name(wide_flags::low) == "low");
+  CHECK(mgutility::enum_name(wide_flags::mid) == "mid");
+  CHECK(mgutility::enum_name(wide_flags::upper) == "upper");
+  CHECK(mgutility::enum_name(wide_flags::top) == "TOP");
+  CHECK(mgutility::enum_name(static_cast<wide_flags>((1ULL << 12) |
+                                                     (1ULL << 63))) ==
+        "mid|TOP");
+  CHECK(mgutility::enum_name(static_cast<wide_flags>(1ULL << 5)) == "0x20");
+  CHECK(mgutility::enum_name(static_cast<wide_flags>(0xFULL << 40)) ==
+        "0xf0000000000");
+
+  // All 64 bits: the hex suffix makes the name longer than the buffer
+  std::string all;
+  mgutility::enum_name_to(all, static_cast<wide_flags>(~0ULL));
+  CHECK(all == "LOW_MID|upper|TOP|0x7ffffffeffffeffe");
+  CHECK(mgutility::enum_name(static_cast<wide_flags>(~0ULL)) ==
+        mgutility::string_view(all).substr(
+            0, mgutility::enum_name_buffer<wide_flags>::size - 1));
+  CHECK(mgutility::enum_name(static_cast<wide_flags>((1ULL << 5) |
+                                                     (1ULL << 63))) ==
+        "TOP|0x20");
+  CHECK(mgutility::enum_name(static_cast<wide_flags>(
+            (1ULL << 0) | (1ULL << 12) | (1ULL << 32))) == "LOW_MID|upper");
+}
+
+TEST_CASE("wide_flags enum name deserialization") {
+  CHECK(mgutility::to_enum<wide_flags>("none").value() == wide_flags::none);
+  CHECK(mgutility::to_enum<wide_flags>("upper").value() == wide_flags::upper);
+  CHECK(mgutility::to_enum<wide_flags>("TOP").value() == wide_flags::top);
+  CHECK(mgutility::to_enum<wide_flags>("low|upper|TOP").value() ==
+        static_cast<wide_flags>(1ULL | (1ULL << 32) | (1ULL << 63)));
+  CHECK(mgutility::to_enum<wide_flags>("LOW_MID | TOP").value() ==
+        static_cast<wide_flags>(1ULL | (1ULL << 12) | (1ULL << 63)));
+  CHECK_FALSE(mgutility::to_enum<wide_flags>("top").has_value());
+  CHECK_FALSE(mgutility::to_enum<wide_flags>("low|").has_value());
+}
+
+TEST_CASE("flag names longer than the name buffer") {
+  constexpr auto all = "alpha_channel|beta_channel|gamma_channel|"
+                       "delta_channel|epsilon_channel|zeta_channel";
+  const auto bits = static_cast<channel_flags>(0x3FU);
+  const auto name = mgutility::enum_name(bits);
+  CHECK(name.size() == mgutility::enum_name_buffer<channel_flags>::size - 1);
+  CHECK(mgutility::string_view(all).substr(0, name.size()) ==
+        static_cast<mgutility::string_view>(name));
+
+  std::string full;
+  CHECK(mgutility::enum_name_to(full, bits) == full.size());
+  CHECK(full == all);
+  CHECK(mgutility::to_enum<channel_flags>(full).value() == bits);
+
+  CHECK(mgutility::enum_name(static_cast<channel_flags_wide>(0x3FU)) == all);
+}
+
+TEST_CASE("permission enum name serialization") {
+  CHECK(mgutility::enum_name(permission::admin) == "admin");
+  CHECK(mgutility::enum_name(static_cast<permission>(3U)) == "read|write");
+  CHECK(mgutility::to_enum<permission>("write|admin").value() ==
+        static_cast<permission>((1U << 1) | (1U << 31)));
+  CHECK(mgutility::enum_name(static_cast<permission>(0U)) == "");
+}
+
 // ======================================================================
 // Test: unscoped enum
 // ======================================================================
@@ -411,7 +721,8 @@ TEST_CASE("signed_values enum name serialization") {
 }
 
 TEST_CASE("signed_values enum name deserialization") {
-  // skip index-0 (neg_two) — find treats 0 as not-found
+  CHECK(mgutility::to_enum<signed_values>("neg_two").value() ==
+        signed_values::neg_two);
   CHECK(mgutility::to_enum<signed_values>("neg_one").value() ==
         signed_values::neg_one);
   CHECK(mgutility::to_enum<signed_values>("zero").value() ==
@@ -422,6 +733,41 @@ TEST_CASE("signed_values enum name deserialization") {
         signed_values::pos_two);
 }
 
+// ======================================================================
+// Test: namespaced enum
+// ======================================================================
+TEST_CASE("namespaced enum name serialization") {
+  CHECK(mgutility::enum_name(outer::nested::first) == "first");
+  CHECK(mgutility::enum_name(outer::nested::third) == "third");
+  CHECK(mgutility::to_enum<outer::nested>("second").value() ==
+        outer::nested::second);
+}
+
+// ======================================================================
+// Test: wide range enum
+// ======================================================================
+TEST_CASE("wide_range enum name serialization") {
+  CHECK(mgutility::enum_name(wide_range::lowest) == "lowest");
+  CHECK(mgutility::enum_name(wide_range::below_zero) == "below_zero");
+  CHECK(mgutility::enum_name(wide_range::zero) == "zero");
+  CHECK(mgutility::enum_name(wide_range::chunk_end) == "chunk_end");
+  CHECK(mgutility::enum_name(wide_range::chunk_begin) == "chunk_begin");
+  CHECK(mgutility::enum_name(wide_range::highest) == "highest");
+  CHECK(mgutility::enum_name(static_cast<wide_range>(1)) == "");
+}
+
+TEST_CASE("wide_range enum name deserialization") {
+  CHECK(mgutility::to_enum<wide_range>("lowest").value() ==
+        wide_range::lowest);
+  CHECK(mgutility::to_enum<wide_range>("chunk_end").value() ==
+        wide_range::chunk_end);
+  CHECK(mgutility::to_enum<wide_range>("chunk_begin").value() ==
+        wide_range::chunk_begin);
+  CHECK(mgutility::to_enum<wide_range>("highest").value() ==
+        wide_range::highest);
+  CHECK_FALSE(mgutility::to_enum<wide_range>("wide_range").has_value());
+}
+
 // ======================================================================
 // Test: enum_for_each iteration
 // ======================================================================
@@ -434,6 +780,402 @@ TEST_CASE("enum_for_each iteration") {
   }
 }
 
+TEST_CASE("enum_for_each visits named values only") {
+  constexpr mgutility::enum_for_each<wide_range> values;
+  CHECK(values.size() == 6);
+  CHECK(std::distance(values.begin(), values.end()) == 6);
+  CHECK(values[0].first == wide_range::lowest);
+  CHECK(values[0].second == "lowest");
+  CHECK(values[5].first == wide_range::highest);
+  CHECK(values[5].second == "highest");
+
+  auto iter = values.end();
+  --iter;
+  CHECK((*iter).first == wide_range::highest);
+  iter -= 2;
+  CHECK(iter[0].second == "chunk_end");
+  CHECK(iter[-1].second == "zero");
+  CHECK(values.begin() + 3 == iter);
+  CHECK(iter - values.begin() == 3);
+  CHECK(values.begin() < iter);
+
+  auto previous = signed_values::neg_two;
+  auto ascending = true;
+  for (auto &&pair : mgutility::enum_for_each<signed_values>()) {
+    ascending = ascending && (pair.first == signed_values::neg_two ||
+                              previous < pair.first);
+    previous = pair.first;
+  }
+  CHECK(ascending);
+  CHECK(mgutility::enum_for_each<signed_values>().size() == 5);
+}
+
+TEST_CASE("enum_for_each over bitmask and flag enums") {
+  const mgutility::enum_for_each<file_access> access;
+  CHECK(access.size() == 5);
+  CHECK(access[3].first == file_access::execute);
+  CHECK(access[3].second == "execute");
+  CHECK(access[4].second == "all");
+
+  const mgutility::enum_for_each<wide_flags> flags;
+  CHECK(flags.size() == 6);
+  CHECK(flags[0].second == "none");
+  CHECK(flags[1].second == "low");
+  CHECK(flags[3].first == static_cast<wide_flags>((1ULL << 0) | (1ULL << 12)));
+  CHECK(flags[3].second == "LOW_MID");
+  CHECK(flags[5].first == wide_flags::top);
+  CHECK(flags[5].second == "TOP");
+}
+
+// ======================================================================
+// Test: dense ordinals
+// ======================================================================
+TEST_CASE("enum_index and enum_value over a sparse range") {
+  CHECK(mgutility::enum_count<wide_range>() == 6);
+  CHECK(mgutility::enum_index(wide_range::lowest).value() == 0);
+  CHECK(mgutility::enum_index(wide_range::chunk_begin).value() == 4);
+  CHECK(mgutility::enum_index(wide_range::highest).value() == 5);
+  CHECK_FALSE(mgutility::enum_index(static_cast<wide_range>(7)).has_value());
+  CHECK(mgutility::enum_value<wide_range>(3).value() == wide_range::chunk_end);
+  CHECK_FALSE(mgutility::enum_value<wide_range>(6).has_value());
+
+  const mgutility::enum_for_each<wide_range> values;
+  auto round_trip = true;
+  for (std::size_t idx = 0; idx < values.size(); ++idx) {
+    auto index = mgutility::enum_index(values[idx].first);
+    round_trip = round_trip && index.has_value() && *index == idx;
+  }
+  CHECK(round_trip);
+}
+
+TEST_CASE("enum_next and enum_prev") {
+  CHECK(mgutility::enum_next(wide_range::zero).value() ==
+        wide_range::chunk_end);
+  CHECK(mgutility::enum_next(static_cast<wide_range>(7)).value() ==
+        wide_range::chunk_end);
+  CHECK(mgutility::enum_prev(static_cast<wide_range>(7)).value() ==
+        wide_range::zero);
+  CHECK(mgutility::enum_prev(wide_range::below_zero).value() ==
+        wide_range::lowest);
+  CHECK_FALSE(mgutility::enum_prev(wide_range::lowest).has_value());
+  CHECK_FALSE(mgutility::enum_next(wide_range::highest).has_value());
+  CHECK(mgutility::enum_next(static_cast<wide_range>(-2000)).value() ==
+        wide_range::lowest);
+  CHECK(mgutility::enum_prev(static_cast<wide_range>(3500)).value() ==
+        wide_range::highest);
+}
+
+TEST_CASE("dense ordinals of codes far outside the range") {
+  const auto above = static_cast<localized>(std::numeric_limits<int>::max());
+  const auto below = static_cast<localized>(std::numeric_limits<int>::min());
+  CHECK_FALSE(mgutility::enum_index(above).has_value());
+  CHECK_FALSE(mgutility::enum_index(below).has_value());
+  CHECK(mgutility::enum_prev(above).value() == localized::failed);
+  CHECK_FALSE(mgutility::enum_next(above).has_value());
+  CHECK(mgutility::enum_next(below).value() == localized::ok);
+  CHECK_FALSE(mgutility::enum_prev(below).has_value());
+}
+
+TEST_CASE("dense ordinals of a flag enum") {
+  CHECK(mgutility::enum_count<wide_flags>() == 6);
+  CHECK(mgutility::enum_index(wide_flags::none).value() == 0);
+  CHECK(mgutility::enum_index(wide_flags::mid).value() == 2);
+  CHECK(mgutility::enum_index(static_cast<wide_flags>((1ULL << 0) |
+                                                      (1ULL << 12)))
+            .value() == 3);
+  CHECK(mgutility::enum_index(wide_flags::top).value() == 5);
+  CHECK_FALSE(mgutility::enum_index(static_cast<wide_flags>(2)).has_value());
+  CHECK(mgutility::enum_value<wide_flags>(4).value() == wide_flags::upper);
+  CHECK(mgutility::enum_next(static_cast<wide_flags>(2)).value() ==
+        wide_flags::mid);
+  CHECK(mgutility::enum_prev(wide_flags::upper).value() ==
+        static_cast<wide_flags>((1ULL << 0) | (1ULL << 12)));
+}
+
+// ======================================================================
+// Test: enum_map
+// ======================================================================
+TEST_CASE("enum_map keyed by a sparse enum") {
+  mgutility::enum_map<wide_range, int> counters;
+  CHECK(counters.size() == 6);
+  CHECK(counters[wide_range::highest] == 0);
+
+  counters[wide_range::zero] += 2;
+  ++counters[wide_range::highest];
+  CHECK(counters.contains(wide_range::chunk_end));
+  CHECK_FALSE(counters.contains(static_cast<wide_range>(7)));
+  CHECK(counters.find(static_cast<wide_range>(7)) == nullptr);
+  CHECK(*counters.find("zero") == 2);
+  CHECK(counters.find("missing") == nullptr);
+  CHECK(counters.data()[2] == 2);
+
+  std::string visited;
+  auto total = 0;
+  for (auto &&entry : counters) {
+    visited.append(entry.name.data(), entry.name.size()).append(",");
+    entry.value += 10;
+    total += entry.value;
+  }
+  CHECK(visited == "lowest,below_zero,zero,chunk_end,chunk_begin,highest,");
+  CHECK(total == 63);
+
+  const auto &view = counters;
+  CHECK((*(view.end() - 1)).value == 11);
+  CHECK(view.begin()[2].key == wide_range::zero);
+  CHECK(*view.find("highest") == 11);
+}
+
+TEST_CASE("enum_map checked access") {
+  mgutility::enum_map<wide_range, int> counters;
+  counters.at(wide_range::zero) = 4;
+  CHECK(counters[wide_range::zero] == 4);
+
+  const auto &view = counters;
+  CHECK(view.at(wide_range::zero) == 4);
+  CHECK_THROWS_AS(counters.at(static_cast<wide_range>(7)), std::out_of_range);
+  CHECK_THROWS_AS(view.at(static_cast<wide_range>(7)), std::out_of_range);
+}
+
+TEST_CASE("enum_map keyed by a flag enum") {
+  mgutility::enum_map<wide_flags, const char *> labels;
+  labels.fill("unset");
+  labels[wide_flags::top] = "top";
+  CHECK(labels.size() == 6);
+  CHECK(std::string{labels[wide_flags::none]} == "unset");
+  CHECK(std::string{*labels.find("TOP")} == "top");
+  CHECK(labels.begin()[3].name == "LOW_MID");
+}
+
+TEST_CASE("enum_hash is collision-free over the named values") {
+  const mgutility::enum_hash<wide_range> hash;
+  CHECK(hash(wide_range::lowest) == 0);
+  CHECK(hash(wide_range::highest) == 5);
+  CHECK(hash(static_cast<wide_range>(7)) == 6 + 7);
+
+  std::unordered_map<weekday, int, mgutility::enum_hash<weekday>> days;
+  days[weekday::monday] = 1;
+  days[weekday::sunday] = 7;
+  CHECK(days.size() == 2);
+  CHECK(days.bucket_count() >= 2);
+  CHECK(days.at(weekday::sunday) == 7);
+}
+
+// ======================================================================
+// Test: enum_set
+// ======================================================================
+TEST_CASE("enum_set of a sparse enum") {
+  mgutility::enum_set<wide_range> set;
+  CHECK(set.empty());
+  CHECK(set.insert(wide_range::highest));
+  CHECK(set.insert(wide_range::lowest));
+  CHECK(set.insert(wide_range::zero));
+  CHECK(set.insert(wide_range::zero));
+  CHECK_FALSE(set.insert(static_cast<wide_range>(7)));
+  CHECK(set.size() == 3);
+  CHECK(set.contains(wide_range::zero));
+  CHECK_FALSE(set.contains(wide_range::chunk_end));
+  CHECK(set.to_string() == "lowest|zero|highest");
+  CHECK(set.to_string(", ") == "lowest, zero, highest");
+
+  std::vector<wide_range> visited(set.begin(), set.end());
+  CHECK(visited == std::vector<wide_range>{wide_range::lowest, wide_range::zero,
+                                           wide_range::highest});
+
+  CHECK(set.erase(wide_range::zero));
+  CHECK_FALSE(set.erase(wide_range::zero));
+  CHECK(set.size() == 2);
+
+  char buffer[8];
+  CHECK(set.names_to(buffer, sizeof(buffer)) == 14);
+  CHECK(std::string(buffer, sizeof(buffer)) == "lowest|h");
+
+  set.clear();
+  CHECK(set.empty());
+  CHECK(set.begin() == set.end());
+  CHECK(set.to_string().empty());
+}
+
+TEST_CASE("enum_set algebra") {
+  using days = mgutility::enum_set<weekday>;
+  const days weekend{weekday::saturday, weekday::sunday};
+  const days some{weekday::monday, weekday::saturday};
+
+  CHECK((weekend | some).size() == 3);
+  CHECK((weekend & some) == days{weekday::saturday});
+  CHECK((weekend ^ some) == days{weekday::monday, weekday::sunday});
+  CHECK((weekend - some) == days{weekday::sunday});
+  CHECK((~weekend).size() == 5);
+  CHECK_FALSE((~weekend).contains(weekday::sunday));
+  CHECK(~days{} == days::all());
+  CHECK(days::all().size() == mgutility::enum_count<weekday>());
+  CHECK(weekend != some);
+}
+
+TEST_CASE("enum_set parsing") {
+  using days = mgutility::enum_set<weekday>;
+  auto parsed = days::parse(" saturday | MON|SUN ");
+  REQUIRE(parsed.has_value());
+  CHECK(parsed.value() ==
+        days{weekday::monday, weekday::saturday, weekday::sunday});
+  CHECK(parsed.value().to_string() == "MON|saturday|SUN");
+
+  auto spaced = days::parse("MON, tuesday", ",");
+  REQUIRE(spaced.has_value());
+  CHECK(spaced.value().size() == 2);
+
+  auto empty = days::parse("");
+  REQUIRE(empty.has_value());
+  CHECK(empty.value().empty());
+
+  CHECK_FALSE(days::parse("MON|funday").has_value());
+  CHECK_FALSE(days::parse("MON||SUN").has_value());
+
+  mgutility::enum_set<shared_prefix> many;
+  for (auto &&pair : mgutility::enum_for_each<shared_prefix>()) {
+    if (static_cast<int>(pair.first) % 3 == 0) {
+      many.insert(pair.first);
+    }
+  }
+  auto round_trip = mgutility::enum_set<shared_prefix>::parse(many.to_string());
+  REQUIRE(round_trip.has_value());
+  CHECK(round_trip.value() == many);
+  CHECK(many.size() == 86);
+}
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+TEST_CASE("enum_for_each in constant expressions") {
+  constexpr mgutility::enum_for_each<weekday> days;
+  static_assert(days.size() == 7, "");
+  static_assert(days[0].second == "MON", "");
+  static_assert(days[6].first == weekday::sunday, "");
+  static_assert(mgutility::enum_count<weekday>() == 7, "");
+  static_assert(*mgutility::enum_index(weekday::friday) == 4, "");
+  static_assert(*mgutility::enum_value<weekday>(2) == weekday::wednesday, "");
+  static_assert(*mgutility::enum_next(weekday::friday) == weekday::saturday,
+                "");
+  static_assert(mgutility::enum_set<weekday>{weekday::monday, weekday::sunday}
+                        .size() == 2,
+                "");
+  static_assert((~mgutility::enum_set<weekday>{weekday::monday}).contains(
+                    weekday::sunday),
+                "");
+  static_assert(*(days.end() - 2) == std::make_pair(weekday::saturday,
+                                                    mgutility::string_view{
+                                                        "saturday"}),
+                "");
+  CHECK(days[1].second == "tuesday");
+}
+#endif
+
+// ======================================================================
+// Test: enum_name_to
+// ======================================================================
+TEST_CASE("enum_name_to buffer") {
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  char buffer[32]{};
+  auto size = mgutility::enum_name_to(buffer, sizeof(buffer), color::light_blue);
+  CHECK(mgutility::string_view(buffer, size) == "light_blue");
+
+  size = mgutility::enum_name_to(buffer, sizeof(buffer),
+                                 static_cast<file_access>(15));
+  CHECK(mgutility::string_view(buffer, size) == "all|0x8");
+
+  size = mgutility::enum_name_to(
+      buffer, sizeof(buffer),
+      static_cast<wide_flags>(1ULL | (1ULL << 12) | (1ULL << 63)));
+  CHECK(mgutility::string_view(buffer, size) == "LOW_MID|TOP");
+
+  // A short buffer gets the beginning of the name and the full size.
+  // NOLINTNEXTLINE [cppcoreguidelines-avoid-c-arrays]
+  char small[4]{'x', 'x', 'x', 'x'};
+  size = mgutility::enum_name_to(small, 3, file_access::read | file_access::write);
+  CHECK(size == 10);
+  CHECK(mgutility::string_view(small, 4) == "reax");
+  CHECK(mgutility::enum_name_to(nullptr, 0, color::light_blue) == 10);
+}
+
+TEST_CASE("enum_name_to string and iterator") {
+  std::string str = "color=";
+  CHECK(mgutility::enum_name_to(str, color::light_blue) == 10);
+  CHECK(str == "color=light_blue");
+  CHECK(mgutility::enum_name_to(str, static_cast<file_access>(0)) == 4);
+  CHECK(str == "color=light_bluenone");
+
+  std::string out;
+  auto it = mgutility::enum_name_to(std::back_inserter(out),
+                                    file_access::read | file_access::execute);
+  *it++ = ';';
+  mgutility::enum_name_to(it, static_cast<wide_flags>(0));
+  CHECK(out == "read|execute;none");
+}
+
+// ======================================================================
+// Test: batch conversions
+// ======================================================================
+TEST_CASE("enum_names batch") {
+  const std::array<color, 4> values{
+      {color::light_blue, color::alice_blue, static_cast<color>(999),
+       color::light_blue}};
+  std::array<mgutility::string_view, 4> names{};
+  mgutility::enum_names(values.data(), values.size(), names.data());
+  CHECK(names[0] == "light_blue");
+  CHECK(names[1] == mgutility::enum_name(color::alice_blue));
+  CHECK(names[2].empty());
+  CHECK(names[3] == "light_blue");
+
+  std::string joined = "[";
+  const auto appended =
+      mgutility::enum_names_join(values.data(), values.size(), ", ", joined);
+  CHECK(joined == "[light_blue, " +
+                      std::string(names[1].data(), names[1].size()) +
+                      ", , light_blue");
+  CHECK(appended == joined.size() - 1);
+
+  const std::array<file_access, 3> masks{
+      {file_access::read | file_access::write, file_access::all,
+       file_access::none}};
+  std::string masks_joined;
+  mgutility::enum_names_join(masks.data(), masks.size(), ";", masks_joined);
+  CHECK(masks_joined == "read|write;all;none");
+
+  // Codes far outside a range that starts below zero get an empty name
+  const std::array<localized, 3> codes{
+      {static_cast<localized>(std::numeric_limits<int>::max()),
+       localized::retry,
+       static_cast<localized>(std::numeric_limits<int>::min())}};
+  std::array<mgutility::string_view, 3> code_names{};
+  mgutility::enum_names(codes.data(), codes.size(), code_names.data());
+  CHECK(code_names[0].empty());
+  CHECK(code_names[1] == "retry");
+  CHECK(code_names[2].empty());
+  std::string codes_joined;
+  mgutility::enum_names_join(codes.data(), codes.size(), "/", codes_joined);
+  CHECK(codes_joined == "/retry/");
+}
+
+TEST_CASE("to_enums batch") {
+  const std::array<mgutility::string_view, 4> names{
+      {"light_blue", "unknown", "alice_blue", ""}};
+  std::array<color, 4> values{};
+  std::array<bool, 4> found{};
+  CHECK(mgutility::to_enums(names.data(), names.size(), values.data(),
+                            found.data()) == 2);
+  CHECK(values[0] == color::light_blue);
+  CHECK(values[2] == color::alice_blue);
+  CHECK(found[0]);
+  CHECK_FALSE(found[1]);
+  CHECK(found[2]);
+  CHECK_FALSE(found[3]);
+
+  const std::array<mgutility::string_view, 3> masks{
+      {"read|write", "all", "read|bogus"}};
+  std::array<file_access, 3> parsed{};
+  CHECK(mgutility::to_enums(masks.data(), masks.size(), parsed.data()) == 2);
+  CHECK(parsed[0] == (file_access::read | file_access::write));
+  CHECK(parsed[1] == file_access::all);
+  CHECK(parsed[2] == file_access{});
+}
+
 // ======================================================================
 // Test: enum_cast
 // ======================================================================
@@ -455,3 +1197,649 @@ TEST_CASE("to_underlying") {
   CHECK(mgutility::to_underlying(weekday::monday) == 0);
   CHECK(mgutility::to_underlying(signed_values::neg_two) == -2);
 }
+
+// ======================================================================
+// Test: names sharing a long prefix still get a perfect hash index
+// ======================================================================
+TEST_CASE("shared_prefix round trip") {
+  auto resolved = 0;
+  for (auto &&pair : mgutility::enum_for_each<shared_prefix>()) {
+    auto value = mgutility::to_enum<shared_prefix>(
+        static_cast<mgutility::string_view>(pair.second));
+    resolved += value.has_value() && *value == pair.first ? 1 : 0;
+  }
+  CHECK(resolved == 256);
+  CHECK(mgutility::enum_name(shared_prefix::shared_prefix_name_3333) ==
+        "shared_prefix_name_3333");
+  CHECK(mgutility::to_enum<shared_prefix>("shared_prefix_name_0123").value() ==
+        shared_prefix::shared_prefix_name_0123);
+  CHECK_FALSE(
+      mgutility::to_enum<shared_prefix>("shared_prefix_name_0124").has_value());
+}
+
+// ======================================================================
+// Test: case-insensitive to_enum
+// ======================================================================
+TEST_CASE("to_enum ignoring case") {
+  using mgutility::case_insensitive;
+  CHECK(mgutility::to_enum<color>("CYAN", case_insensitive).value() ==
+        color::cyan);
+  CHECK(mgutility::to_enum<color>("Alice_Blue", case_insensitive).value() ==
+        color::alice_blue);
+  CHECK_FALSE(mgutility::to_enum<color>("CYAN").has_value());
+  CHECK_FALSE(mgutility::to_enum<color>("cyan ", case_insensitive).has_value());
+  CHECK_FALSE(mgutility::to_enum<color>("", case_insensitive).has_value());
+
+  // Custom names fold too
+  CHECK(mgutility::to_enum<status>("done", case_insensitive).value() ==
+        status::completed);
+  CHECK(mgutility::to_enum<weekday>("Mon", case_insensitive).value() ==
+        weekday::monday);
+  CHECK_FALSE(mgutility::to_enum<weekday>("sunday", case_insensitive));
+
+  auto resolved = 0;
+  for (auto &&pair : mgutility::enum_for_each<shared_prefix>()) {
+    std::string upper(pair.second.data(), pair.second.size());
+    for (auto &chr : upper) {
+      chr = static_cast<char>(chr >= 'a' && chr <= 'z' ? chr - 'a' + 'A' : chr);
+    }
+    auto value = mgutility::to_enum<shared_prefix>(upper, case_insensitive);
+    resolved += value.has_value() && *value == pair.first ? 1 : 0;
+  }
+  CHECK(resolved == 256);
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static_assert(
+      mgutility::to_enum<weekday>("FRIDAY", case_insensitive).value() ==
+          weekday::friday,
+      "");
+#endif
+}
+
+TEST_CASE("to_enum of bitmask and flag enums ignoring case") {
+  using mgutility::case_insensitive;
+  CHECK(mgutility::to_enum<file_access>("READ | Write", case_insensitive)
+            .value() == (file_access::read | file_access::write));
+  CHECK(mgutility::to_enum<bitmask_flags>("All", case_insensitive).value() ==
+        bitmask_flags::all);
+  CHECK(mgutility::to_enum<permission>("admin,READ", case_insensitive, ",")
+            .value() ==
+        static_cast<permission>((1U << 31) | (1U << 0)));
+  CHECK(mgutility::to_enum<wide_flags>("top|low_mid", case_insensitive)
+            .value() == static_cast<wide_flags>((1ULL << 63) | (1ULL << 0) |
+                                                (1ULL << 12)));
+  CHECK_FALSE(
+      mgutility::to_enum<wide_flags>("top|lowmid", case_insensitive).has_value());
+}
+
+// ======================================================================
+// Test: to_enum_prefix
+// ======================================================================
+TEST_CASE("to_enum_prefix") {
+  // A name equal to the prefix wins over the longer names
+  auto match = mgutility::to_enum_prefix<color>("blue");
+  CHECK(match.value.value() == color::blue);
+  CHECK(match.count == 2);
+  CHECK_FALSE(match.ambiguous());
+
+  match = mgutility::to_enum_prefix<color>("blu");
+  CHECK_FALSE(match.value.has_value());
+  CHECK(match.count == 2);
+  CHECK(match.ambiguous());
+
+  CHECK(mgutility::to_enum_prefix<color>("blue_").value.value() ==
+        color::blue_violet);
+  CHECK(mgutility::to_enum_prefix<color>("cr").value.value() == color::crimson);
+  CHECK(mgutility::to_enum_prefix<color>("a").count == 5);
+
+  match = mgutility::to_enum_prefix<color>("zz");
+  CHECK_FALSE(match.value.has_value());
+  CHECK(match.count == 0);
+  CHECK_FALSE(match.ambiguous());
+  CHECK(mgutility::to_enum_prefix<color>("").count == 0);
+  CHECK(mgutility::to_enum_prefix<color>("cyans").count == 0);
+
+  // Custom names are matched, the names they replace are not
+  CHECK(mgutility::to_enum_prefix<weekday>("th").value.value() ==
+        weekday::thursday);
+  CHECK(mgutility::to_enum_prefix<weekday>("t").ambiguous());
+  CHECK(mgutility::to_enum_prefix<weekday>("S").value.value() ==
+        weekday::sunday);
+  CHECK(mgutility::to_enum_prefix<weekday>("mon").count == 0);
+
+  CHECK(mgutility::to_enum_prefix<shared_prefix>("shared_prefix_name_012")
+            .count == 4);
+  CHECK(mgutility::to_enum_prefix<shared_prefix>("shared_prefix_name_3")
+            .count == 64);
+  CHECK(mgutility::to_enum_prefix<shared_prefix>("shared_prefix_name_0123")
+            .value.value() == shared_prefix::shared_prefix_name_0123);
+
+#if MGUTILITY_CPLUSPLUS > 201402L
+  static_assert(
+      mgutility::to_enum_prefix<weekday>("we").value.value() ==
+          weekday::wednesday,
+      "");
+#endif
+}
+
+TEST_CASE("to_enum_prefix ignoring case") {
+  using mgutility::case_insensitive;
+  CHECK(mgutility::to_enum_prefix<color>("BLUE_V", case_insensitive)
+            .value.value() == color::blue_violet);
+  CHECK(mgutility::to_enum_prefix<weekday>("Mo", case_insensitive)
+            .value.value() == weekday::monday);
+  CHECK(mgutility::to_enum_prefix<weekday>("Sun", case_insensitive)
+            .value.value() == weekday::sunday);
+  auto match = mgutility::to_enum_prefix<weekday>("s", case_insensitive);
+  CHECK(match.ambiguous());
+  CHECK(match.count == 2);
+}
+
+// ======================================================================
+// Test: suggest
+// ======================================================================
+TEST_CASE("suggest") {
+  std::array<mgutility::enum_suggestion<color>, 3> out{};
+  auto count = mgutility::suggest<color>("bleu", out.data(), out.size());
+  REQUIRE(count == 3);
+  CHECK(out[0].value == color::blue);
+  CHECK(out[0].name == "blue");
+  CHECK(out[0].distance == 2);
+  CHECK(out[1].distance >= 2);
+  CHECK(out[2].distance >= out[1].distance);
+
+  count = mgutility::suggest<color>("cyan", out.data(), out.size());
+  CHECK(count == 3);
+  CHECK(out[0].value == color::cyan);
+  CHECK(out[0].distance == 0);
+
+  CHECK(mgutility::suggest<color>("blue", out.data(), 0) == 0);
+  CHECK(mgutility::suggest<color>("qqqqqqqq", out.data(), out.size(), 2) == 0);
+
+  count = mgutility::suggest<color>("CYNA", mgutility::case_insensitive,
+                                    out.data(), 1);
+  REQUIRE(count == 1);
+  CHECK(out[0].value == color::cyan);
+  CHECK(out[0].distance == 2);
+
+  // Custom names are suggested, the names they replace are not
+  std::array<mgutility::enum_suggestion<weekday>, 2> days{};
+  count = mgutility::suggest<weekday>("SAN", days.data(), days.size(), 1);
+  REQUIRE(count == 1);
+  CHECK(days[0].value == weekday::sunday);
+
+  // Ties are ranked by value
+  std::array<mgutility::enum_suggestion<shared_prefix>, 4> many{};
+  count = mgutility::suggest<shared_prefix>("shared_prefix_name_0124",
+                                            many.data(), many.size());
+  REQUIRE(count == 4);
+  CHECK(many[0].value == shared_prefix::shared_prefix_name_0120);
+  CHECK(many[3].value == shared_prefix::shared_prefix_name_0123);
+  CHECK(many[3].distance == 1);
+
+  // Input longer than one word is compared against each name instead
+  const std::string long_input(70, 'a');
+  count = mgutility::suggest<color>(long_input, out.data(), out.size());
+  REQUIRE(count == 3);
+  CHECK(out[0].value == color::aquamarine);
+  CHECK(out[0].distance == 70 - 3);
+}
+
+// ======================================================================
+// Test: fmt and std::format specs
+// ======================================================================
+#if defined(ENUM_NAME_USE_FMT)
+TEST_CASE("fmt formatter") {
+  CHECK(fmt::format("{}", weekday::monday) == "MON");
+  CHECK(fmt::format("{:>8}|{:<6}|", color::cyan, weekday::friday) ==
+        "    cyan|friday|");
+  CHECK(fmt::format("{:d} {:x} {:#X} {:04o}", color::cyan, color::cyan,
+                    color::cyan, color::cyan) == "20 14 0X14 0024");
+  CHECK(fmt::format("{:d}", signed_values::neg_two) == "-2");
+  CHECK(fmt::format("{:q} {:*^10q}", weekday::sunday, color::aqua) ==
+        "\"SUN\" **\"aqua\"**");
+  CHECK(fmt::format("{:{}}|", weekday::monday, 5) == "MON  |");
+  CHECK(fmt::format("{}", file_access::read | file_access::write) ==
+        "read|write");
+  CHECK(fmt::format("{:q}", file_access::read | file_access::write) ==
+        "\"read|write\"");
+  CHECK(fmt::format(FMT_COMPILE("{}-{:d}"), weekday::friday,
+                    weekday::friday) == "friday-4");
+
+  std::array<char, 4> buffer{};
+  const auto result =
+      fmt::format_to_n(buffer.data(), buffer.size(), "{}", color::cyan);
+  CHECK(result.size == 4);
+  CHECK(std::string(buffer.data(), buffer.size()) == "cyan");
+}
+#endif
+
+#if defined(__cpp_lib_format)
+TEST_CASE("std::format formatter") {
+  CHECK(std::format("{}", weekday::monday) == "MON");
+  CHECK(std::format("{:>8}|", color::cyan) == "    cyan|");
+  CHECK(std::format("{:d} {:x}", color::cyan, color::cyan) == "20 14");
+  CHECK(std::format("{:*^10q}", color::aqua) == "**\"aqua\"**");
+
+  std::array<char, 3> buffer{};
+  const auto result =
+      std::format_to_n(buffer.data(), buffer.size(), "{}", color::cyan);
+  CHECK(result.size == 4);
+  CHECK(std::string(buffer.data(), buffer.size()) == "cya");
+}
+#endif
+
+// ======================================================================
+// Test: iostream insertion and extraction
+// ======================================================================
+namespace {
+// Serves a string a few characters at a time, so names straddle refills
+class chunked_buf : public std::streambuf {
+public:
+  chunked_buf(std::string text, std::size_t chunk)
+      : m_text(std::move(text)), m_chunk(chunk) {}
+
+protected:
+  auto underflow() -> int_type override {
+    if (m_pos == m_text.size()) {
+      return traits_type::eof();
+    }
+    auto *first = &m_text[m_pos];
+    const auto size = std::min(m_chunk, m_text.size() - m_pos);
+    m_pos += size;
+    setg(first, first, first + size);
+    return traits_type::to_int_type(*first);
+  }
+
+private:
+  std::string m_text;
+  std::size_t m_chunk;
+  std::size_t m_pos{};
+};
+
+// A ctype facet that also classifies ',' as whitespace.
+class comma_space_ctype : public std::ctype<char> {
+public:
+  comma_space_ctype() : std::ctype<char>(make_table()) {}
+
+private:
+  static auto make_table() -> const mask * {
+    static std::vector<mask> table(classic_table(),
+                                   classic_table() + table_size);
+    table[static_cast<unsigned char>(',')] |= space;
+    return table.data();
+  }
+};
+} // namespace
+
+TEST_CASE("ostream insertion") {
+  std::ostringstream out;
+  out << weekday::monday << ' ' << color::cyan << ' '
+      << (file_access::read | file_access::write) << ' '
+      << static_cast<wide_flags>((1ULL << 63) | (1ULL << 32));
+  CHECK(out.str() == "MON cyan read|write upper|TOP");
+
+  out.str("");
+  out << std::setw(6) << weekday::monday << '|' << std::left << std::setw(6)
+      << std::setfill('.') << color::cyan << '|' << weekday::friday;
+  CHECK(out.str() == "   MON|cyan..|friday");
+}
+
+TEST_CASE("istream extraction") {
+  std::istringstream in("  MON\tcyan read|write\nupper|TOP");
+  auto day = weekday::friday;
+  auto col = color::black;
+  auto access = file_access::none;
+  auto flags = wide_flags::none;
+  in >> day >> col >> access >> flags;
+  CHECK(in);
+  CHECK(in.eof());
+  CHECK(day == weekday::monday);
+  CHECK(col == color::cyan);
+  CHECK(access == (file_access::read | file_access::write));
+  CHECK(flags == static_cast<wide_flags>((1ULL << 63) | (1ULL << 32)));
+
+  std::istringstream bad("monday friday");
+  day = weekday::tuesday;
+  bad >> day;
+  CHECK(bad.fail());
+  CHECK(day == weekday::tuesday);
+
+  std::istringstream empty("   ");
+  empty >> day;
+  CHECK(empty.fail());
+  CHECK(empty.eof());
+
+  chunked_buf buf("antique_white  blue_violet x" + std::string(200, 'y'), 3);
+  std::istream chunked(&buf);
+  chunked >> col;
+  CHECK(col == color::antique_white);
+  chunked >> col;
+  CHECK(col == color::blue_violet);
+  CHECK(chunked);
+  chunked >> col;
+  CHECK(chunked.fail());
+  CHECK(col == color::blue_violet);
+}
+
+TEST_CASE("istream extraction across refills and with locale whitespace") {
+  const std::string joined =
+      "alpha_channel|beta_channel|gamma_channel|delta_channel";
+  chunked_buf buf(joined + " zeta_channel", 5);
+  std::istream chunked(&buf);
+  auto flags = channel_flags::none;
+  chunked >> flags;
+  CHECK(chunked);
+  CHECK(flags == static_cast<channel_flags>(0xF));
+  chunked >> flags;
+  CHECK(flags == channel_flags::zeta_channel);
+  CHECK(chunked.eof());
+
+  std::istringstream tail(joined);
+  flags = channel_flags::none;
+  tail >> flags;
+  CHECK_FALSE(tail.fail());
+  CHECK(flags == static_cast<channel_flags>(0xF));
+
+  std::istringstream commas("MON,cyan");
+  commas.imbue(std::locale(commas.getloc(), new comma_space_ctype));
+  auto day = weekday::friday;
+  auto col = color::black;
+  commas >> day >> col;
+  CHECK_FALSE(commas.fail());
+  CHECK(day == weekday::monday);
+  CHECK(col == color::cyan);
+}
+
+// ======================================================================
+// Test: parsing a column of a delimited text
+// ======================================================================
+TEST_CASE("parse_enum_column") {
+  mgutility::enum_column_options options{};
+  options.column = 1;
+  options.header = true;
+  const auto csv = mgutility::parse_enum_column<weekday>(
+      "id,day,note\n1,MON,x\n2,\"friday\",y\r\n3,funday,z\n4\n5,SUN",
+      options);
+  CHECK(csv.values == std::vector<weekday>{weekday::monday, weekday::friday,
+                                           weekday{}, weekday{},
+                                           weekday::sunday});
+  CHECK(csv.unknown_rows == std::vector<std::size_t>{4, 5});
+
+  options.column = 0;
+  options.delimiter = '\t';
+  options.header = false;
+  const auto tsv = mgutility::parse_enum_column<file_access>(
+      "read|write\t1\nexecute\t2\n", options);
+  CHECK(tsv.values == std::vector<file_access>{file_access::read |
+                                                   file_access::write,
+                                               file_access::execute});
+  CHECK(tsv.unknown_rows.empty());
+
+  CHECK(mgutility::parse_enum_column<weekday>("").values.empty());
+
+  // Large enough to be split into chunks for several threads
+  std::string text;
+  std::vector<color> expected;
+  for (std::size_t row = 0; row < 100000; ++row) {
+    const auto value = static_cast<color>(row % 140);
+    text += std::to_string(row);
+    text += ',';
+    text.append(mgutility::enum_name(value).data(),
+                mgutility::enum_name(value).size());
+    text += row % 9973 == 0 ? "_x\n" : "\n";
+    expected.push_back(row % 9973 == 0 ? color{} : value);
+  }
+  options.column = 1;
+  options.delimiter = ',';
+  options.threads = 4;
+  const auto colors = mgutility::parse_enum_column<color>(text, options);
+  CHECK(colors.values == expected);
+  REQUIRE(colors.unknown_rows.size() == 11);
+  CHECK(colors.unknown_rows.front() == 1);
+  CHECK(colors.unknown_rows.back() == 99731);
+}
+
+#if defined(MGUTILITY_ENUM_COLUMN_MMAP)
+TEST_CASE("parse_enum_column_file") {
+  char path[] = "/tmp/enum_column_XXXXXX";
+  const auto fd = ::mkstemp(path);
+  REQUIRE(fd >= 0);
+  const std::string text = "day\nMON\ntuesday\nnoday\n";
+  REQUIRE(::write(fd, text.data(), text.size()) ==
+          static_cast<ssize_t>(text.size()));
+  ::close(fd);
+
+  mgutility::enum_column_options options{};
+  options.header = true;
+  const auto column = mgutility::parse_enum_column_file<weekday>(path, options);
+  ::unlink(path);
+  CHECK(column.values == std::vector<weekday>{weekday::monday,
+                                              weekday::tuesday, weekday{}});
+  CHECK(column.unknown_rows == std::vector<std::size_t>{4});
+
+  CHECK_THROWS_AS(mgutility::parse_enum_column_file<weekday>(path),
+                  std::system_error);
+}
+#endif
+
+TEST_CASE("parse_enum_column rethrows worker exceptions") {
+  std::atomic<int> ran{0};
+  auto task = [&ran](std::size_t chunk) {
+    ++ran;
+    if (chunk == 2) {
+      throw std::length_error("chunk 2");
+    }
+  };
+  CHECK_THROWS_AS(mgutility::detail::run_chunks(4, task), std::length_error);
+  CHECK(ran.load() == 4);
+}
+
+// ======================================================================
+// Test: name tables are constant-initialized in every standard
+// ======================================================================
+static_assert(mgutility::detail::get_enum_array<weekday>()[0].size() == 3, "");
+static_assert(mgutility::detail::get_enum_array<weekday>()[1].size() == 7, "");
+static_assert(mgutility::detail::get_enum_flags<wide_flags>()[64].size() == 3,
+              "");
+
+// ======================================================================
+// Test: threads racing on the first use of an enum
+// ======================================================================
+TEST_CASE("concurrent first use") {
+  constexpr auto thread_count = 8;
+  constexpr auto rounds = 500;
+  std::atomic<int> waiting{thread_count};
+  std::atomic<int> mismatches{0};
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (auto idx = 0; idx < thread_count; ++idx) {
+    threads.emplace_back([&waiting, &mismatches] {
+      // Start together, so that the first lookups race with each other
+      --waiting;
+      while (waiting.load() != 0) {
+        std::this_thread::yield();
+      }
+      const auto both = static_cast<first_use_flags>((1U << 0) | (1U << 15));
+      for (auto round = 0; round < rounds; ++round) {
+        auto ok = mgutility::enum_name(first_use::beta) == "BETA" &&
+                  mgutility::enum_name(first_use::gamma) == "gamma" &&
+                  mgutility::to_enum<first_use>("gamma").value_or(
+                      first_use::alpha) == first_use::gamma &&
+                  mgutility::enum_count<first_use>() == 3 &&
+                  mgutility::enum_name(both) == "one|last" &&
+                  mgutility::to_enum<first_use_flags>("last|one").value_or(
+                      first_use_flags::none) == both;
+        mismatches += ok ? 0 : 1;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  CHECK(mismatches.load() == 0);
+}
+
+// ======================================================================
+// Test: runtime name overlay
+// ======================================================================
+TEST_CASE("enum_name_overlay falls back to the reflected names") {
+  mgutility::clear_enum_overlay<localized>();
+  CHECK(mgutility::enum_name(localized::retry) == "retry");
+  CHECK(mgutility::enum_name(static_cast<localized>(300)).empty());
+
+  mgutility::publish_enum_overlay(
+      mgutility::enum_overlay<localized>{}.set(localized::retry, "erneut"));
+  CHECK(mgutility::enum_name(localized::ok) == "ok");
+  CHECK(mgutility::enum_name(localized::retry) == "erneut");
+  CHECK(mgutility::enum_name(localized::failed) == "failed");
+
+  // to_enum keeps the reflected names
+  CHECK(mgutility::to_enum<localized>("retry").value_or(localized::ok) ==
+        localized::retry);
+  CHECK_FALSE(mgutility::to_enum<localized>("erneut").has_value());
+  mgutility::clear_enum_overlay<localized>();
+}
+
+TEST_CASE("enum_overlay entries") {
+  mgutility::enum_overlay<localized> overlay;
+  CHECK(overlay.empty());
+  overlay.set(localized::failed, "fehler")
+      .set(static_cast<localized>(300), "future")
+      .set(localized::ok, "gut")
+      .set(localized::failed, "fehlgeschlagen");
+  CHECK(overlay.size() == 3);
+  CHECK(overlay.find(localized::failed) == "fehlgeschlagen");
+  CHECK(overlay.find(localized::retry).empty());
+
+  overlay.set(localized::ok, "");
+  CHECK(overlay.size() == 2);
+  CHECK(overlay.find(localized::ok).empty());
+  CHECK(overlay.find(localized::failed) == "fehlgeschlagen");
+  CHECK(overlay.find(static_cast<localized>(300)) == "future");
+
+  for (auto round = 0; round < 64; ++round) {
+    overlay.set(localized::retry, round % 2 == 0 ? "erneut" : "nochmal");
+  }
+  CHECK(overlay.size() == 3);
+  CHECK(overlay.find(localized::retry) == "nochmal");
+  CHECK(overlay.find(localized::failed) == "fehlgeschlagen");
+  overlay.set(localized::retry, "");
+
+  mgutility::publish_enum_overlay(overlay);
+  CHECK(mgutility::enum_name(localized::ok) == "ok");
+  CHECK(mgutility::enum_name(static_cast<localized>(300)) == "future");
+  std::string out;
+  mgutility::enum_name_to(out, localized::failed);
+  CHECK(out == "fehlgeschlagen");
+  mgutility::clear_enum_overlay<localized>();
+}
+
+TEST_CASE("enum_name_overlay replaces the published names") {
+  mgutility::publish_enum_overlay(
+      mgutility::enum_overlay<localized>{}.set(localized::ok, "bien"));
+  const auto before = mgutility::enum_name(localized::ok);
+
+  mgutility::publish_enum_overlay(
+      mgutility::enum_overlay<localized>{}.set(localized::ok, "gut"));
+  CHECK(mgutility::enum_name(localized::ok) == "gut");
+  // Views into a replaced overlay stay valid
+  CHECK(before == "bien");
+
+  mgutility::clear_enum_overlay<localized>();
+  CHECK(mgutility::enum_name(localized::ok) == "ok");
+}
+
+TEST_CASE("enum_name_overlay in the batch functions and iteration") {
+  mgutility::publish_enum_overlay(mgutility::enum_overlay<localized>{}
+                                      .set(localized::retry, "erneut")
+                                      .set(static_cast<localized>(300), "neu"));
+  const localized values[] = {localized::ok, localized::retry,
+                              static_cast<localized>(300), localized::failed};
+  mgutility::string_view names[4];
+  mgutility::enum_names(values, 4, names);
+  CHECK(names[0] == "ok");
+  CHECK(names[1] == "erneut");
+  CHECK(names[2] == "neu");
+  CHECK(names[3] == "failed");
+
+  std::string joined;
+  CHECK(mgutility::enum_names_join(values, 4, ", ", joined) == 23);
+  CHECK(joined == "ok, erneut, neu, failed");
+
+  std::string listed;
+  for (const auto pair : mgutility::enum_for_each<localized>()) {
+    listed.append(pair.second.data(), pair.second.size()).append(" ");
+  }
+  CHECK(listed == "ok erneut failed ");
+
+  const auto both = static_cast<localized_perm>(3);
+  const localized_perm flags[] = {localized_perm::read, both};
+  mgutility::publish_enum_overlay(
+      mgutility::enum_overlay<localized_perm>{}.set(localized_perm::read,
+                                                    "lesen"));
+  std::string flag_names;
+  mgutility::enum_names_join(flags, 2, ",", flag_names);
+  CHECK(flag_names == "lesen,read|write");
+  mgutility::clear_enum_overlay<localized_perm>();
+  mgutility::clear_enum_overlay<localized>();
+}
+
+TEST_CASE("reclaim_enum_overlays keeps the current overlay") {
+  for (auto round = 0; round < 8; ++round) {
+    mgutility::publish_enum_overlay(mgutility::enum_overlay<localized>{}.set(
+        localized::ok, round % 2 == 0 ? "gut" : "bien"));
+  }
+  const auto current = mgutility::enum_name(localized::ok);
+  mgutility::reclaim_enum_overlays<localized>();
+  CHECK(current == "bien");
+  CHECK(mgutility::enum_name(localized::ok) == "bien");
+
+  mgutility::clear_enum_overlay<localized>();
+  mgutility::reclaim_enum_overlays<localized>();
+  CHECK(mgutility::enum_name(localized::ok) == "ok");
+}
+
+TEST_CASE("enum_name_overlay of a flag enum") {
+  const auto both = static_cast<localized_perm>(3);
+  mgutility::publish_enum_overlay(mgutility::enum_overlay<localized_perm>{}
+                                      .set(localized_perm::none, "keine")
+                                      .set(both, "lesen+schreiben"));
+  CHECK(mgutility::enum_name(localized_perm::none) == "keine");
+  CHECK(mgutility::enum_name(both) == "lesen+schreiben");
+  // Only exact values are replaced; others are joined from reflected names
+  CHECK(mgutility::enum_name(localized_perm::read) == "read");
+  mgutility::clear_enum_overlay<localized_perm>();
+  CHECK(mgutility::enum_name(both) == "read|write");
+}
+
+TEST_CASE("enum_name_overlay with concurrent readers") {
+  constexpr auto reader_count = 4;
+  constexpr auto rounds = 2000;
+  std::atomic<bool> done{false};
+  std::atomic<int> mismatches{0};
+
+  std::vector<std::thread> readers;
+  readers.reserve(reader_count);
+  for (auto idx = 0; idx < reader_count; ++idx) {
+    readers.emplace_back([&done, &mismatches] {
+      while (!done.load()) {
+        const auto name = mgutility::enum_name(localized::retry);
+        auto ok = name == "retry" || name == "erneut" || name == "encore";
+        mismatches += ok ? 0 : 1;
+      }
+    });
+  }
+  for (auto round = 0; round < rounds; ++round) {
+    mgutility::publish_enum_overlay(mgutility::enum_overlay<localized>{}.set(
+        localized::retry, round % 2 == 0 ? "erneut" : "encore"));
+  }
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  CHECK(mismatches.load() == 0);
+  mgutility::clear_enum_overlay<localized>();
+  mgutility::reclaim_enum_overlays<localized>();
+}